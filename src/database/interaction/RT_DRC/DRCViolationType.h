@@ -35,6 +35,9 @@ enum class ViolationEnumType
   kNotch,
   kConnectivity,
   kCornerFill,
+  kCutSpacing,
+  kCutEOLSpacing,
+  kEnclosure,
   kMax
 };
 
@@ -65,6 +68,12 @@ struct GetViolationTypeName
         return "Metal Notch Spacing";
       case ViolationEnumType::kCornerFill:
         return "Corner Fill";
+      case ViolationEnumType::kCutSpacing:
+        return "Cut Spacing";
+      case ViolationEnumType::kCutEOLSpacing:
+        return "Cut EOL Spacing";
+      case ViolationEnumType::kEnclosure:
+        return "Enclosure";
       default:
         return "None";
     }
@@ -25,7 +25,7 @@ namespace tcl {
 
 TclDrcCheckDef::TclDrcCheckDef(const char* cmd_name) : TclCmd(cmd_name)
 {
-  //   addOptionForJSON();
+  addOptionForJSON();
   addOptionForTCL();
 }
 
@@ -35,8 +35,14 @@ unsigned TclDrcCheckDef::exec()
     return 0;
   }
 
+  std::string config = "";
+  TclOption* config_option = getOptionOrArg("-config");
+  if (config_option != nullptr && config_option->is_set_val()) {
+    config = config_option->getStringVal();
+  }
+
   idrc::DrcApi drc_api;
-  drc_api.init();
+  drc_api.init(config);
   auto violations = drc_api.checkDef();
 
   for (auto& [enum_type, violation_list] : violations) {
@@ -48,10 +54,10 @@ unsigned TclDrcCheckDef::exec()
 
 // private
 
-// void TclDrcCheckDef::addOptionForJSON()
-// {
-//   TclUtil::addOption(this, "-config", ValueType::kString);
-// }
+void TclDrcCheckDef::addOptionForJSON()
+{
+  TclUtil::addOption(this, "-config", ValueType::kString);
+}
 
 void TclDrcCheckDef::addOptionForTCL()
 {
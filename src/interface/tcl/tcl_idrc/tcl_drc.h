@@ -92,6 +92,7 @@ class TclDrcCheckDef : public TclCmd
  private:
   // private function
   bool initConfigMapByTCL(std::map<std::string, std::any>& config_map);
+  void addOptionForJSON();
   void addOptionForTCL();
 
   // private data
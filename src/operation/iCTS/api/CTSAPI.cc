@@ -342,6 +342,7 @@ double CTSAPI::getSinkCap(icts::CtsInstance* sink) const
 
 double CTSAPI::getSinkCap(const std::string& load_pin_full_name) const
 {
+  std::lock_guard<std::mutex> lock(_sta_mutex);
   // remove all "\" in inst_name
   auto name = load_pin_full_name;
   name.erase(std::remove(name.begin(), name.end(), '\\'), name.end());
@@ -460,6 +461,7 @@ std::map<std::string, double> CTSAPI::elmoreDelay(const icts::EvalNet& eval_net)
 bool CTSAPI::cellLibExist(const std::string& cell_master, const std::string& query_field, const std::string& from_port,
                           const std::string& to_port)
 {
+  std::lock_guard<std::mutex> lock(_sta_mutex);
   std::vector<std::vector<double>> index_list;
   ista::LibTable::TableType table_type;
   if (query_field == "cell_rise") {
@@ -549,6 +551,15 @@ std::vector<double> CTSAPI::queryCellLibValue(const std::string& cell_master, co
 icts::CtsCellLib* CTSAPI::getCellLib(const std::string& cell_master, const std::string& from_port, const std::string& to_port,
                                      const bool& use_work_value)
 {
+  {
+    std::shared_lock<std::shared_mutex> lock(_lib_mutex);
+    CtsCellLib* lib = _libs->findLib(cell_master);
+    if (lib) {
+      return lib;
+    }
+  }
+  // concurrent solvers may miss the same cell, build it only once
+  std::scoped_lock lock(_lib_mutex, _sta_mutex);
   CtsCellLib* lib = _libs->findLib(cell_master);
   if (lib) {
     return lib;
@@ -24,6 +24,8 @@
 #include <cassert>
 #include <fstream>
 #include <map>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -167,6 +169,7 @@ class CTSAPI
   template <typename... Args>
   void saveToLog(const Args&... args)
   {
+    std::lock_guard<std::mutex> lock(_log_mutex);
     (*_log_ofs) << toString(args...) << std::endl;
   }
 
@@ -225,6 +228,10 @@ class CTSAPI
   icts::Evaluator* _evaluator = nullptr;
   icts::ModelFactory* _model_factory = nullptr;
   ista::TimingEngine* _timing_engine = nullptr;
+  // guard the shared state touched by concurrent solvers
+  mutable std::shared_mutex _lib_mutex;
+  mutable std::mutex _sta_mutex;
+  std::mutex _log_mutex;
 };
 
 }  // namespace icts
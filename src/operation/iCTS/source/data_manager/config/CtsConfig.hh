@@ -91,6 +91,7 @@ class CtsConfig
   const int& get_latency_opt_level() const { return _latency_opt_level; }
   const double& get_global_latency_opt_ratio() const { return _global_latency_opt_ratio; }
   const double& get_local_latency_opt_ratio() const { return _local_latency_opt_ratio; }
+  const int& get_thread_number() const { return _thread_number; }
   // file
   const std::string& get_work_dir() const { return _work_dir; }
   const std::string& get_output_def_path() const { return _output_def_path; }
@@ -133,6 +134,7 @@ class CtsConfig
   void set_latency_opt_level(const int& latency_opt_level) { _latency_opt_level = latency_opt_level; }
   void set_global_latency_opt_ratio(const double& global_latency_opt_ratio) { _global_latency_opt_ratio = global_latency_opt_ratio; }
   void set_local_latency_opt_ratio(const double& local_latency_opt_ratio) { _local_latency_opt_ratio = local_latency_opt_ratio; }
+  void set_thread_number(const int& thread_number) { _thread_number = thread_number; }
 
   // file
   void set_work_dir(const std::string& work_dir) { _work_dir = work_dir; }
@@ -246,6 +248,7 @@ class CtsConfig
   int _latency_opt_level = 1;
   double _global_latency_opt_ratio = 0.3;
   double _local_latency_opt_ratio = 0.4;
+  int _thread_number = 1;
 
   // file
   std::string _work_dir = "./result/cts";
@@ -187,6 +187,10 @@ void JsonParser::parse(const string& json_file, CtsConfig* config) const
       std::string local_latency_opt_ratio = COMUtil::getData(json, {"local_latency_opt_ratio"});
       config->set_local_latency_opt_ratio(std::stod(local_latency_opt_ratio));
     }
+    if (COMUtil::getData(json, {"thread_number"}) != nullptr) {
+      int thread_number = COMUtil::getData(json, {"thread_number"});
+      config->set_thread_number(std::max(1, thread_number));
+    }
 
     if (COMUtil::getData(json, {"use_netlist"}) != nullptr) {
       config->set_use_netlist(COMUtil::getData(json, {"use_netlist"}));
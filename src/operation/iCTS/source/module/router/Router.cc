@@ -23,6 +23,7 @@
 #include "CTSAPI.hh"
 #include "CtsDBWrapper.hh"
 #include "Solver.hh"
+#include "ThreadPool/ThreadPool.h"
 #include "TimingPropagator.hh"
 #include "usage/usage.hh"
 namespace icts {
@@ -56,23 +57,48 @@ void Router::build()
 {
   ieda::Stats stats;
   CTSAPIInst.saveToLog("--Clock Net Info--");
+  std::vector<CtsNet*> clk_nets;
   for (auto* clock : _clocks) {
-    auto* design = CTSAPIInst.get_design();
     auto& clock_nets = clock->get_clock_nets();
     for (auto* clk_net : clock_nets) {
       CTSAPIInst.saveToLog("Net name: ", clk_net->get_net_name());
       LOG_INFO << "Net name: " << clk_net->get_net_name();
-      design->resetId();
       auto sink_pins = getSinkPins(clk_net);
       auto buf_pins = getBufferPins(clk_net);
       CTSAPIInst.saveToLog("\tSink pins num: ", sink_pins.size());
       LOG_INFO << "\tSink pins num: " << sink_pins.size();
       CTSAPIInst.saveToLog("\tBuffer pins num: ", buf_pins.size());
       LOG_INFO << "\tBuffer pins num: " << buf_pins.size();
-      routing(clk_net);
-      clk_net->setClockRouted();
+      clk_nets.push_back(clk_net);
     }
   }
+  // clock nets are independent, synthesize them concurrently and share the rest threads with the clusters
+  int thread_num = CTSAPIInst.get_config()->get_thread_number();
+  int net_thread_num = std::clamp(static_cast<int>(clk_nets.size()), 1, std::max(1, thread_num));
+  int cluster_thread_num = std::clamp(thread_num / net_thread_num, 1, UINT8_MAX);
+  std::vector<std::vector<Net*>> solver_nets_list(clk_nets.size());
+  if (net_thread_num > 1) {
+    ThreadPool pool(net_thread_num);
+    std::vector<std::future<void>> results;
+    for (size_t i = 0; i < clk_nets.size(); ++i) {
+      results.emplace_back(pool.enqueue([&, i] { solver_nets_list[i] = routing(clk_nets[i], cluster_thread_num); }));
+    }
+    for (auto&& result : results) {
+      result.get();
+    }
+  } else {
+    for (size_t i = 0; i < clk_nets.size(); ++i) {
+      solver_nets_list[i] = routing(clk_nets[i], cluster_thread_num);
+    }
+  }
+  // merge in net order, keep the result independent of the thread number
+  for (size_t i = 0; i < clk_nets.size(); ++i) {
+    std::ranges::for_each(solver_nets_list[i], [&](Net* net) {
+      _solver_set.add_net(net);
+      std::ranges::for_each(net->get_pins(), [&](Pin* pin) { _solver_set.add_pin(pin); });
+    });
+    clk_nets[i]->setClockRouted();
+  }
   CTSAPIInst.saveToLog("");
 }
 void Router::update()
@@ -100,26 +126,19 @@ void Router::printLog()
   LOG_INFO << "Enter router!";
 }
 
-void Router::routing(CtsNet* clk_net)
+std::vector<Net*> Router::routing(CtsNet* clk_net, const int& max_thread)
 {
   auto pins = clk_net->get_load_pins();
   if (pins.empty()) {
     LOG_WARNING << "Net: " << clk_net->get_net_name() << " is empty!";
-    return;
+    return {};
   }
   auto net_name = clk_net->get_net_name();
   // total topology
   auto solver = Solver(net_name, clk_net->get_driver_pin(), pins);
-  solver.set_max_thread(1);
+  solver.set_max_thread(max_thread);
   solver.run();
-  auto clk_nets = solver.get_solver_nets();
-  if (clk_nets.empty()) {
-    return;
-  }
-  std::ranges::for_each(clk_nets, [&](Net* net) {
-    _solver_set.add_net(net);
-    std::ranges::for_each(net->get_pins(), [&](Pin* pin) { _solver_set.add_pin(pin); });
-  });
+  return solver.get_solver_nets();
 }
 
 std::vector<CtsPin*> Router::getSinkPins(CtsNet* clk_net)
@@ -92,7 +92,7 @@ class Router
 
  private:
   void printLog();
-  void routing(CtsNet* clk_net);
+  std::vector<Net*> routing(CtsNet* clk_net, const int& max_thread = 1);
   std::vector<CtsPin*> getSinkPins(CtsNet* clk_net);
   std::vector<CtsPin*> getBufferPins(CtsNet* clk_net);
 
@@ -66,7 +66,9 @@ class Solver
   Assign get_level_assign(const int& level) const;
   std::vector<Inst*> assignApply(const std::vector<Inst*>& insts, const Assign& assign);
   std::vector<Inst*> topGuide(const std::vector<Inst*>& insts, const Assign& assign);
-  Inst* netAssign(const std::vector<Inst*>& insts, const Assign& assign, const Point& guide_center, const bool& shift = true);
+  Inst* netAssign(const std::vector<Inst*>& insts, const Assign& assign, const Point& guide_center, const std::string& net_name,
+                  const bool& shift = true);
+  std::string genNetName();
   Net* saltOpt(const std::vector<Inst*>& insts, const Assign& assign);
   void higherDelayOpt(std::vector<std::vector<Inst*>>& clusters, std::vector<Point>& guide_centers, std::vector<Inst*>& level_insts) const;
   // report
@@ -83,6 +85,7 @@ class Solver
   Pin* _driver = nullptr;
   std::vector<Net*> _nets;
   int _level = 1;
+  int _id = 0;  // per net name id, private to this solver
   uint8_t _max_thread = 1;
   // config
   bool _root_buffer_required = true;
@@ -47,6 +47,8 @@ namespace icts {
   /**
    * @brief init timing parameters
    *       this function should be called before any other function
+   *       the parameters are read-only after init, so concurrent solvers can share them,
+   *       and the per-net mutable state (e.g. net name id) is kept in each solver
    *
    */
   void TimingPropagator::init()
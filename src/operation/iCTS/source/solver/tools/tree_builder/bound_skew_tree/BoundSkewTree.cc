@@ -22,6 +22,7 @@
 
 #include <filesystem>
 #include <numbers>
+#include <queue>
 #include <random>
 #include <stack>
 
@@ -133,26 +134,171 @@ void BoundSkewTree::convert()
     noneInputTopologyConvert();
   }
 }
-Match BoundSkewTree::getBestMatch(CostFunc cost_func) const
+/**
+ * @brief greedy merge the unmerged nodes by min cost pair
+ *
+ * pairs are ordered by (cost, earlier node, later node), same as scanning all pairs by insertion order.
+ * each node keeps its best partner among the nodes alive when it is searched, which covers every pair with a later node,
+ * so the best pair is always the best partner of one of its nodes and a lazy priority queue keeps the best partners.
+ * only the new parent and the nodes whose partner is merged search partners again after each merge.
+ *
+ * @param is_dist_cost cost is not less than the manhattan distance between merging regions,
+ *        partners are searched nearest first in an area grid and the search stops by the distance
+ * @param bound_func lower bound of cost to skip cost evaluations, used when the cost is not bounded by distance
+ */
+void BoundSkewTree::greedyMerge(CostFunc cost_func, const bool& is_dist_cost, CostFunc bound_func)
 {
-  auto min_cost = std::numeric_limits<double>::max();
-  Match best_match;
-  for (size_t i = 0; i < _unmerged_nodes.size(); ++i) {
-    for (size_t j = i + 1; j < _unmerged_nodes.size(); ++j) {
-      auto cost = cost_func(_unmerged_nodes[i], _unmerged_nodes[j]);
-      if (cost < min_cost) {
-        min_cost = cost;
-        best_match = {_unmerged_nodes[i], _unmerged_nodes[j], cost};
+  struct GreedyNode
+  {
+    Area* area = nullptr;
+    PtPair box;      // bounding box of merging region
+    size_t pos = 0;  // position in alive list
+    size_t partner = 0;  // node itself if no partner
+    double cost = std::numeric_limits<double>::infinity();
+  };
+  using Candidate = std::tuple<double, size_t, size_t>;  // cost, earlier node, later node
+
+  auto calc_box = [](Area* area) {
+    auto mr = area->get_mr().empty() ? Region{area->get_location()} : area->get_mr();
+    PtPair box = {mr.front(), mr.front()};
+    for (const auto& pt : mr) {
+      box[kMin] = Pt(std::min(box[kMin].x, pt.x), std::min(box[kMin].y, pt.y));
+      box[kMax] = Pt(std::max(box[kMax].x, pt.x), std::max(box[kMax].y, pt.y));
+    }
+    return box;
+  };
+  auto box_dist = [](const PtPair& box1, const PtPair& box2) {
+    auto gap_x = std::max({0.0, box1[kMin].x - box2[kMax].x, box2[kMin].x - box1[kMax].x});
+    auto gap_y = std::max({0.0, box1[kMin].y - box2[kMax].y, box2[kMin].y - box1[kMax].y});
+    return gap_x + gap_y;
+  };
+
+  PtPair extent = calc_box(_unmerged_nodes.front());
+  for (auto* area : _unmerged_nodes) {
+    auto box = calc_box(area);
+    extent[kMin] = Pt(std::min(extent[kMin].x, box[kMin].x), std::min(extent[kMin].y, box[kMin].y));
+    extent[kMax] = Pt(std::max(extent[kMax].x, box[kMax].x), std::max(extent[kMax].y, box[kMax].y));
+  }
+  AreaGrid grid(extent, _unmerged_nodes.size());
+  std::vector<GreedyNode> nodes;
+  std::vector<size_t> alive_list;
+  std::vector<std::vector<size_t>> partner_of_list;  // nodes which take the node as partner, may be outdated
+  std::vector<size_t> visit_stamp_list;
+  size_t visit_stamp = 0;
+  std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> candidate_queue;
+
+  auto add_node = [&](Area* area) {
+    auto node = nodes.size();
+    nodes.push_back(GreedyNode{area, calc_box(area), alive_list.size(), node});
+    alive_list.push_back(node);
+    partner_of_list.emplace_back();
+    visit_stamp_list.push_back(0);
+    if (is_dist_cost) {
+      grid.insert(node, nodes[node].box);
+    }
+  };
+  auto remove_node = [&](size_t node) {
+    auto pos = nodes[node].pos;
+    alive_list[pos] = alive_list.back();
+    nodes[alive_list[pos]].pos = pos;
+    alive_list.pop_back();
+    if (is_dist_cost) {
+      grid.remove(node, nodes[node].box);
+    }
+    nodes[node].area = nullptr;
+  };
+  auto get_best = [&](size_t node) {
+    return Candidate(nodes[node].cost, std::min(node, nodes[node].partner), std::max(node, nodes[node].partner));
+  };
+  auto try_partner = [&](size_t node, size_t other) {
+    if (other == node || nodes[other].area == nullptr) {
+      return;
+    }
+    auto left = std::min(node, other);
+    auto right = std::max(node, other);
+    auto bound = is_dist_cost ? box_dist(nodes[node].box, nodes[other].box)
+                 : bound_func ? bound_func(nodes[left].area, nodes[right].area)
+                              : std::numeric_limits<double>::lowest();
+    if (Candidate(bound, left, right) >= get_best(node)) {
+      return;
+    }
+    auto cost = cost_func(nodes[left].area, nodes[right].area);
+    if (Candidate(cost, left, right) >= get_best(node)) {
+      return;
+    }
+    nodes[node].partner = other;
+    nodes[node].cost = cost;
+  };
+  // search the best partner among alive nodes, or only among later nodes when the earlier ones are already covered
+  auto find_partner = [&](size_t node, const bool& later_only) {
+    nodes[node].partner = node;
+    nodes[node].cost = std::numeric_limits<double>::infinity();
+    if (is_dist_cost) {
+      ++visit_stamp;
+      grid.visitRings(
+          nodes[node].box, [&](const double& ring_dist) { return ring_dist > nodes[node].cost; },
+          [&](const size_t& other) {
+            if (visit_stamp_list[other] != visit_stamp && (!later_only || other > node)) {
+              visit_stamp_list[other] = visit_stamp;
+              try_partner(node, other);
+            }
+          });
+    } else {
+      for (auto other : alive_list) {
+        if (!later_only || other > node) {
+          try_partner(node, other);
+        }
       }
     }
+    if (nodes[node].partner != node) {
+      partner_of_list[nodes[node].partner].push_back(node);
+      candidate_queue.push(get_best(node));
+    }
+  };
+
+  for (auto* area : _unmerged_nodes) {
+    add_node(area);
+  }
+  for (size_t node = 0; node < nodes.size(); ++node) {
+    find_partner(node, true);
   }
-  return best_match;
+
+  while (alive_list.size() > 1) {
+    LOG_FATAL_IF(candidate_queue.empty()) << "no candidate pair to merge";
+    auto candidate = candidate_queue.top();
+    auto [cost, left, right] = candidate;
+    candidate_queue.pop();
+    // lazy invalidation, skip merged nodes and outdated partners
+    if (nodes[left].area == nullptr || nodes[right].area == nullptr || (get_best(left) != candidate && get_best(right) != candidate)) {
+      continue;
+    }
+    auto* parent = new Area(++_id);
+    // random select RCpattern
+    parent->set_pattern(_pattern);
+    merge(parent, nodes[left].area, nodes[right].area);
+    remove_node(left);
+    remove_node(right);
+    add_node(parent);
+    if (alive_list.size() < 2) {
+      break;
+    }
+    find_partner(nodes.size() - 1, false);
+    for (auto merged : {left, right}) {
+      auto partner_of = std::move(partner_of_list[merged]);
+      for (auto node : partner_of) {
+        if (nodes[node].area != nullptr && nodes[node].partner == merged) {
+          find_partner(node, false);
+        }
+      }
+    }
+  }
+  _unmerged_nodes = {nodes[alive_list.front()].area};
 }
 double BoundSkewTree::mergeCost(Area* left, Area* right) const
 {
   auto min_dist = std::numeric_limits<double>::max();
-  auto left_mr = left->get_mr();
-  auto right_mr = right->get_mr();
+  const auto& left_mr = left->get_mr();
+  const auto& right_mr = right->get_mr();
   Pt l_pt, r_pt;
   for (auto left_pt : left_mr) {
     for (auto right_pt : right_mr) {
@@ -174,11 +320,22 @@ double BoundSkewTree::mergeCost(Area* left, Area* right) const
   auto latency = left_max + 0.5 * _unit_h_res * _unit_h_cap * len_to_left * len_to_left + _unit_h_res * len_to_left * left->get_cap_load();
   return latency;
 }
+/**
+ * @brief lower bound of mergeCost, the wire length to left is not negative, so the latency is not less than the left max delay
+ *
+ */
+double BoundSkewTree::mergeCostBound(Area* left, Area* right) const
+{
+  if (left->get_mr().empty() || right->get_mr().empty()) {
+    return std::numeric_limits<double>::lowest();
+  }
+  return left->get_mr().back().max;
+}
 double BoundSkewTree::distanceCost(Area* left, Area* right) const
 {
   auto min_dist = std::numeric_limits<double>::max();
-  auto left_mr = left->get_mr();
-  auto right_mr = right->get_mr();
+  const auto& left_mr = left->get_mr();
+  const auto& right_mr = right->get_mr();
   for (auto left_pt : left_mr) {
     for (auto right_pt : right_mr) {
       min_dist = std::min(min_dist, Geom::distance(left_pt, right_pt));
@@ -516,32 +673,20 @@ void BoundSkewTree::bottomUp()
 void BoundSkewTree::bottomUpAllPairBased()
 {
   // none input topo
-  while (_unmerged_nodes.size() > 1) {
+  if (_unmerged_nodes.size() > 1) {
     // switch cost_func by topo_type
-    CostFunc cost_func;
     switch (_topo_type) {
       case TopoType::kGreedyDist:
-        cost_func = [&](Area* left, Area* right) { return distanceCost(left, right); };
+        greedyMerge([&](Area* left, Area* right) { return distanceCost(left, right); }, true);
         break;
       case TopoType::kGreedyMerge:
-        cost_func = [&](Area* left, Area* right) { return mergeCost(left, right); };
+        greedyMerge([&](Area* left, Area* right) { return mergeCost(left, right); }, false,
+                    [&](Area* left, Area* right) { return mergeCostBound(left, right); });
         break;
       default:
         LOG_FATAL << "topo type is not supported";
         break;
     }
-    auto best_match = getBestMatch(cost_func);
-    auto* left = best_match.left;
-    auto* right = best_match.right;
-    auto* parent = new Area(++_id);
-    // random select RCpattern
-    parent->set_pattern(_pattern);
-    merge(parent, left, right);
-    // erase left and right
-    _unmerged_nodes.erase(
-        std::remove_if(_unmerged_nodes.begin(), _unmerged_nodes.end(), [&](Area* node) { return node == left || node == right; }),
-        _unmerged_nodes.end());
-    _unmerged_nodes.push_back(parent);
   }
   _root = _unmerged_nodes.front();
 }
@@ -80,8 +80,9 @@ class BoundSkewTree
    *
    */
   using CostFunc = std::function<double(Area*, Area*)>;
-  Match getBestMatch(CostFunc cost_func) const;
+  void greedyMerge(CostFunc cost_func, const bool& is_dist_cost, CostFunc bound_func = nullptr);
   double mergeCost(Area* left, Area* right) const;
+  double mergeCostBound(Area* left, Area* right) const;
   double distanceCost(Area* left, Area* right) const;
   /**
    * @brief topology
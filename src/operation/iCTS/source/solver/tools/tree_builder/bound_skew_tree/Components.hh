@@ -20,6 +20,9 @@
  */
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+
 #include "TimingPropagator.hh"
 #include "log/Log.hh"
 namespace icts {
@@ -159,7 +162,7 @@ class Area
   Area* get_right() const { return _right; }
   Line get_line(const size_t& side) const { return _lines[side]; }
   Side<Line> get_lines() const { return _lines; }
-  Region get_mr() const { return _mr; }
+  const Region& get_mr() const { return _mr; }
   std::vector<Line> getMrLines() const
   {
     std::vector<Line> lines;
@@ -217,11 +220,96 @@ class Area
   Region _convex_hull;
 };
 
-struct Match
+/**
+ * @brief uniform grid over the bounding boxes of merging regions, visit areas ring by ring around a box
+ *
+ */
+class AreaGrid
 {
-  Area* left;
-  Area* right;
-  double merge_cost;
+ public:
+  AreaGrid(const PtPair& extent, const size_t& area_num) : _origin(extent[kMin])
+  {
+    auto width = extent[kMax].x - extent[kMin].x;
+    auto height = extent[kMax].y - extent[kMin].y;
+    auto num = static_cast<double>(std::max(area_num, static_cast<size_t>(1)));
+    _cell_size = std::max({std::sqrt(width * height / num), std::max(width, height) / num, kEpsilon});
+    _x_num = static_cast<size_t>(width / _cell_size) + 1;
+    _y_num = static_cast<size_t>(height / _cell_size) + 1;
+    _cells.resize(_x_num * _y_num);
+  }
+
+  void insert(const size_t& id, const PtPair& box)
+  {
+    forEachCell(box, [&](std::vector<size_t>& cell) { cell.push_back(id); });
+  }
+  void remove(const size_t& id, const PtPair& box)
+  {
+    forEachCell(box, [&](std::vector<size_t>& cell) {
+      auto it = std::ranges::find(cell, id);
+      if (it != cell.end()) {
+        *it = cell.back();
+        cell.pop_back();
+      }
+    });
+  }
+  /**
+   * @brief visit ids in the cells of box, then in the rings around them, an id may be visited more than once
+   *
+   * @param stop_func stop before visiting the ring whose boxes are not closer than the given manhattan distance
+   */
+  template <typename StopFunc, typename VisitFunc>
+  void visitRings(const PtPair& box, StopFunc stop_func, VisitFunc visit_func) const
+  {
+    auto [x_low, y_low] = cellIndex(box[kMin]);
+    auto [x_high, y_high] = cellIndex(box[kMax]);
+    auto max_ring = std::max({x_low, y_low, _x_num - 1 - x_high, _y_num - 1 - y_high});
+    for (size_t ring = 0; ring <= max_ring; ++ring) {
+      if (ring > 1 && stop_func((ring - 1) * _cell_size)) {
+        return;
+      }
+      // cell range of the ring, boundary cells only
+      auto x_begin = x_low >= ring ? x_low - ring : 0;
+      auto y_begin = y_low >= ring ? y_low - ring : 0;
+      auto x_end = std::min(x_high + ring, _x_num - 1);
+      auto y_end = std::min(y_high + ring, _y_num - 1);
+      for (auto y = y_begin; y <= y_end; ++y) {
+        auto is_row_boundary = ring == 0 || y + ring == y_low || y == y_high + ring;
+        for (auto x = x_begin; x <= x_end; ++x) {
+          if (!is_row_boundary && x + ring != x_low && x != x_high + ring) {
+            x = std::max(x, x_high + ring - 1);
+            continue;
+          }
+          std::ranges::for_each(_cells[y * _x_num + x], visit_func);
+        }
+      }
+    }
+  }
+
+ private:
+  std::pair<size_t, size_t> cellIndex(const Pt& pt) const
+  {
+    auto index = [&](const double& offset, const size_t& num) {
+      return static_cast<size_t>(std::clamp(std::floor(offset / _cell_size), 0.0, static_cast<double>(num - 1)));
+    };
+    return {index(pt.x - _origin.x, _x_num), index(pt.y - _origin.y, _y_num)};
+  }
+  template <typename CellFunc>
+  void forEachCell(const PtPair& box, CellFunc cell_func)
+  {
+    auto [x_low, y_low] = cellIndex(box[kMin]);
+    auto [x_high, y_high] = cellIndex(box[kMax]);
+    for (auto y = y_low; y <= y_high; ++y) {
+      for (auto x = x_low; x <= x_high; ++x) {
+        cell_func(_cells[y * _x_num + x]);
+      }
+    }
+  }
+
+  Pt _origin;
+  double _cell_size = 1;
+  size_t _x_num = 1;
+  size_t _y_num = 1;
+  std::vector<std::vector<size_t>> _cells;
 };
 
 class Interval
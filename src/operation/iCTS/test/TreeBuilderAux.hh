@@ -18,6 +18,7 @@
  * @file TreeBuilderAux.hh
  * @author Dawn Li (dawnli619215645@gmail.com)
  */
+#include <chrono>
 #include <filesystem>
 #include <random>
 
@@ -264,6 +265,26 @@ class TreeBuilderAux : public TestInterface
     return data_set;
   }
 
+  void runGreedyMergeScaleTest(const EnvInfo& env_info, const double& skew_bound) const
+  {
+    auto load_pins = genRandomPins(env_info);
+    auto topo_type_list = {TopoType::kGreedyDist, TopoType::kGreedyMerge};
+    LOG_INFO << std::endl;
+    LOG_INFO << "Run greedy merge scale test...";
+    LOG_INFO << "Skew bound: " << skew_bound;
+    LOG_INFO << "Pin num: " << load_pins.size();
+    std::ranges::for_each(topo_type_list, [&](const TopoType& topo_type) {
+      auto start = std::chrono::steady_clock::now();
+      auto* buf = TreeBuilder::boundSkewTree("GreedyMergeScale", load_pins, skew_bound, std::nullopt, topo_type);
+      auto runtime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      LOG_INFO << TopoTypeToString(topo_type) << " runtime: " << runtime << "s";
+      auto* net = TimingPropagator::genNet("GreedyMergeScale", buf->get_driver_pin(), load_pins);
+      TimingPropagator::resetNet(net);
+    });
+    std::ranges::for_each(load_pins, [](Pin* pin) { delete pin->get_inst(); });
+    LOG_INFO << "Run greedy merge scale test done";
+  }
+
   void runEstimationTest(const EnvInfo& env_info, const size_t& case_num, const double& skew_bound, const std::string& dir,
                          const std::string& suffix) const
   {
@@ -217,6 +217,16 @@ TEST_F(TreeBuilderTest, RegressionTreeBuilderTest)
   });
 }
 
+TEST_F(TreeBuilderTest, GreedyMergeScaleTest)
+{
+  TreeBuilderAux tree_builder("/home/liweiguo/project/iEDA/scripts/salsa20/iEDA_config/db_default_config.json",
+                              "/home/liweiguo/project/iEDA/scripts/salsa20/iEDA_config/cts_default_config.json");
+  double skew_bound = 0.08;
+  // design DB unit is 2000
+  EnvInfo env_info{0, 3000000, 0, 3000000, 10000, 10000, 0, 0, 0, 0};
+  tree_builder.runGreedyMergeScaleTest(env_info, skew_bound);
+}
+
 TEST_F(TreeBuilderTest, LowBoundEstimationTest)
 {
   TreeBuilderAux tree_builder("/home/liweiguo/project/iEDA/scripts/salsa20/iEDA_config/db_default_config.json",
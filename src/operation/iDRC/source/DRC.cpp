@@ -41,6 +41,7 @@
 #include "SpotParser.h"
 #include "Tech.h"
 #include "idm.h"
+#include "omp.h"
 
 namespace idrc {
 DRC* DRC::_drc_instance = nullptr;
@@ -287,6 +288,10 @@ void DRC::update()
  */
 void DRC::run()
 {
+  if (_config->get_thread_number() > 1) {
+    runParallel(_config->get_thread_number());
+    return;
+  }
   int index = 0;
   for (auto& drc_net : _drc_design->get_drc_net_list()) {
     if (index++ % 1000 == 0) {
@@ -398,6 +403,52 @@ void DRC::clearRoutingShapesInDrcNetList()
   }
 }
 
+/**
+ * @brief Run each design rule check module on nets in parallel
+ *        Each thread owns its check modules, shape rtrees in RegionQuery are only read during the check,
+ *        violations are buffered per thread and merged in net order at the end
+ *
+ * @param thread_number
+ */
+void DRC::runParallel(int thread_number)
+{
+  std::vector<DrcNet*>& drc_net_list = _drc_design->get_drc_net_list();
+  int net_num = static_cast<int>(drc_net_list.size());
+
+  _region_query->startParallelCheck(thread_number);
+#pragma omp parallel num_threads(thread_number)
+  {
+    RoutingSpacingCheck routing_sapcing_check(_tech, _region_query);
+    RoutingWidthCheck routing_width_check(_tech, _region_query);
+    RoutingAreaCheck routing_area_check(_tech, _region_query);
+    EnclosedAreaCheck enclosed_area_check(_tech, _region_query);
+    CutSpacingCheck cut_spacing_check(_tech, _region_query);
+    EOLSpacingCheck eol_spacing_check(_tech, _region_query);
+    NotchSpacingCheck notch_spacing_check(_tech, _region_query);
+    MinStepCheck min_step_check(_tech, _region_query);
+    CornerFillSpacingCheck corner_fill_spacing_check(_tech, _region_query);
+    CutEolSpacingCheck cut_eol_spacing_check(_tech, _region_query);
+    JogSpacingCheck jog_spacing_check(_tech, _region_query);
+#pragma omp for schedule(dynamic, 16)
+    for (int i = 0; i < net_num; ++i) {
+      DrcNet* drc_net = drc_net_list[i];
+      _region_query->setParallelCheckNet(i);
+      routing_sapcing_check.checkRoutingSpacing(drc_net);
+      routing_width_check.checkRoutingWidth(drc_net);
+      routing_area_check.checkArea(drc_net);
+      enclosed_area_check.checkEnclosedArea(drc_net);
+      cut_spacing_check.checkCutSpacing(drc_net);
+      eol_spacing_check.checkEOLSpacing(drc_net);
+      notch_spacing_check.checkNotchSpacing(drc_net);
+      min_step_check.checkMinStep(drc_net);
+      corner_fill_spacing_check.checkCornerFillSpacing(drc_net);
+      cut_eol_spacing_check.checkCutEolSpacing(drc_net);
+      jog_spacing_check.checkJogSpacing(drc_net);
+    }
+  }
+  _region_query->finishParallelCheck();
+}
+
 // void DRC::checkMultipatterning(int check_colorable_num)
 // {
 //   _multi_patterning->set_conflict_graph(_conflict_graph);
@@ -160,6 +160,7 @@ class DRC
   // function
 
   void clearRoutingShapesInDrcNetList();
+  void runParallel(int thread_number);
 
   // void addSegmentToDrcPolygon(const BoostSegment& segment, DrcPolygon* polygon);
   // void initNetMergePolyEdgeOuter(DrcPolygon* polygon, std::set<int>& x_value_list, std::set<int>& y_value_list);
@@ -35,6 +35,8 @@ class DrcConfig
   std::string& get_def_path() { return _def_path; }
   // OUTPUT
   std::string& get_output_dir_path() { return _output_dir_path; }
+  // PARAMETER
+  int get_thread_number() const { return _thread_number; }
 
   // setter
   // INPUT
@@ -42,6 +44,8 @@ class DrcConfig
   void set_def_path(const std::string& def_path) { _def_path = def_path; }
   // OUTPUT
   void set_output_dir_path(const std::string& output_dir_path) { _output_dir_path = output_dir_path; }
+  // PARAMETER
+  void set_thread_number(const int thread_number) { _thread_number = thread_number; }
   // function
 
  private:
@@ -50,6 +54,8 @@ class DrcConfig
   std::string _def_path;
   // OUTPUT
   std::string _output_dir_path;
+  // PARAMETER
+  int _thread_number = 1;
 };
 
 }  // namespace idrc
@@ -52,6 +52,10 @@ void DrcConfigurator::initConfigByJson(DrcConfig* config, nlohmann::json& json)
   config->set_def_path(getDataByJson(json, {"INPUT", "def_path"}));
   // ***************OUTPUT ***************
   // config->set_output_dir_path(getDataByJson(json, {"OUTPUT", "output_dir_path"}));
+  // *************** PARAMETER (optional) ***************
+  if (json.contains("PARAMETER") && json["PARAMETER"].contains("thread_number")) {
+    config->set_thread_number(json["PARAMETER"]["thread_number"].get<int>());
+  }
 }
 
 nlohmann::json DrcConfigurator::getDataByJson(nlohmann::json value, std::vector<std::string> ftag_list)
@@ -16,12 +16,12 @@
 // ***************************************************************************************
 #include "MultiPatterning.h"
 namespace idrc {
-// std::vector<std::vector<DrcConflictNode*>> MultiPatterning::checkDoublePatterning()
-// {
-//   std::vector<DrcConflictGraph*> connected_component_list = _connected_component_finder.getAllConnectedComponentInGraph(_conflict_graph);
-//   std::vector<std::vector<DrcConflictNode*>> odd_cycle_list = _odd_cycle_finder.findAllOddCycles(connected_component_list);
-//   return odd_cycle_list;
-// }
+std::vector<std::vector<DrcConflictNode*>> MultiPatterning::checkDoublePatterning()
+{
+  std::vector<DrcConflictGraph*> connected_component_list = _connected_component_finder.getAllConnectedComponentInGraph(_conflict_graph);
+  std::vector<std::vector<DrcConflictNode*>> odd_cycle_list = _odd_cycle_finder.findAllOddCycles(connected_component_list);
+  return odd_cycle_list;
+}
 
 std::vector<DrcConflictNode*> MultiPatterning::checkTriplePatterning()
 {
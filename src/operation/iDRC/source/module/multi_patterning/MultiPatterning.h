@@ -34,7 +34,7 @@ class MultiPatterning
   // setter
   void set_conflict_graph(DrcConflictGraph* graph) { _conflict_graph = graph; }
 
-  // std::vector<std::vector<DrcConflictNode*>> checkDoublePatterning();
+  std::vector<std::vector<DrcConflictNode*>> checkDoublePatterning();
   std::vector<DrcConflictNode*> checkTriplePatterning();
   std::vector<DrcConflictNode*> checkMultiPatterning(int check_colorable_num);
 
@@ -19,30 +19,80 @@ namespace idrc {
 
 std::vector<DrcConflictNode*>& ColorableChecker::colorable_check(const std::vector<DrcConflictGraph*>& sub_graph_list)
 {
-  int cnt = 0;
-  for (auto sub_graph : sub_graph_list) {
-    ++cnt;
-    std::cout << "check sub_graph :" << cnt << " of " << sub_graph_list.size() << " "
-              << "node num" << sub_graph->get_node_num() << std::endl;
+  // 各连通分量节点互不相交，并行染色，结果按分量顺序合并
+  std::vector<std::vector<DrcConflictNode*>> uncolorable_node_list_list(sub_graph_list.size());
+#pragma omp parallel for schedule(dynamic)
+  for (size_t i = 0; i < sub_graph_list.size(); ++i) {
+    ColorableChecker colorable_checker;
+    colorable_checker.set_optional_color_num(_optional_color_num);
+    colorable_checker.colorable_check(sub_graph_list[i]);
+    uncolorable_node_list_list[i] = std::move(colorable_checker._uncolorable_node_list);
+  }
+  for (auto& uncolorable_node_list : uncolorable_node_list_list) {
+    _uncolorable_node_list.insert(_uncolorable_node_list.end(), uncolorable_node_list.begin(), uncolorable_node_list.end());
+  }
+  return _uncolorable_node_list;
+}
 
-    _visited.clear();
+void ColorableChecker::colorable_check(DrcConflictGraph* sub_graph)
+{
+  _visited.clear();
+  _origin_subgraph_node_list.clear();
+  _temp_uncolorable_node_list.clear();
+  _colorable_node_num = 0;
+  _fewest_uncolorable_node_num = INT_MAX;
+  _graph_node_num = sub_graph->get_node_num();
+  _uncolorable_node_num = 0;
+  _record_uncolorable_num = false;
 
-    _origin_subgraph_node_list.clear();
-    // std::vector<DrcConflictNode*> subgraph_node_list = sub_graph->get_conflict_node_list();
-    // _origin_subgraph_node_list.insert(subgraph_node_list.begin(), subgraph_node_list.end());
+  // BFS贪心染色成功则无需回溯搜索，二染色时BFS结果即为精确判定
+  std::vector<DrcConflictNode*> bfs_uncolorable_node_list;
+  if (bfsColoring(sub_graph, bfs_uncolorable_node_list)) {
+    return;
+  }
+  // 回溯搜索深度为节点数，大分量直接使用BFS结果
+  if (_graph_node_num > kMaxSearchNodeNum) {
+    _uncolorable_node_list = bfs_uncolorable_node_list;
+    return;
+  }
+  for (auto node : sub_graph->get_conflict_node_list()) {
+    node->erase_color();
+  }
+  colorable_check_new(sub_graph);
+}
 
-    _temp_uncolorable_node_list.clear();
-    // _node_to_color.clear();
-    _colorable_node_num = 0;
-    _fewest_uncolorable_node_num = INT_MAX;
-    _graph_node_num = sub_graph->get_node_num();
-
-    _uncolorable_node_num = 0;
-    _record_uncolorable_num = false;
-    // colorable_check(sub_graph);
-    colorable_check_new(sub_graph);
+bool ColorableChecker::bfsColoring(DrcConflictGraph* sub_graph, std::vector<DrcConflictNode*>& uncolorable_node_list)
+{
+  for (auto node : sub_graph->get_conflict_node_list()) {
+    node->erase_color();
   }
-  return _uncolorable_node_list;
+  std::set<DrcConflictNode*> visited;
+  std::queue<DrcConflictNode*> node_queue;
+  for (auto start_node : sub_graph->get_conflict_node_list()) {
+    if (!visited.insert(start_node).second) {
+      continue;
+    }
+    node_queue.push(start_node);
+    while (!node_queue.empty()) {
+      DrcConflictNode* node = node_queue.front();
+      node_queue.pop();
+      for (int color = 1; color <= _optional_color_num; ++color) {
+        if (judgeIsColorable(node, color)) {
+          node->set_color(color);
+          break;
+        }
+      }
+      if (node->get_color() == 0) {
+        uncolorable_node_list.push_back(node);
+      }
+      for (auto conflict_node : node->get_conflict_node_list()) {
+        if (visited.insert(conflict_node).second) {
+          node_queue.push(conflict_node);
+        }
+      }
+    }
+  }
+  return uncolorable_node_list.empty();
 }
 
 void ColorableChecker::addRecordsOfUncolorableNode()
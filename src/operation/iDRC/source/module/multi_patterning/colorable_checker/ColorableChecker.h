@@ -18,9 +18,13 @@
 #define IDRC_SRC_MODULE_COLORABLE_CHECKER_H_
 #include <limits.h>
 
+#include <queue>
+
 #include "DrcConflictGraph.h"
 
 namespace idrc {
+// 超过该节点数的连通分量不做回溯搜索，避免递归过深
+constexpr int kMaxSearchNodeNum = 256;
 
 class ColorableChecker
 {
@@ -45,7 +49,8 @@ class ColorableChecker
   std::vector<DrcConflictNode*> _temp_uncolorable_node_list;
   std::vector<DrcConflictNode*> _uncolorable_node_list;
 
-  // void colorable_check(DrcConflictGraph* sub_graph);
+  void colorable_check(DrcConflictGraph* sub_graph);
+  bool bfsColoring(DrcConflictGraph* sub_graph, std::vector<DrcConflictNode*>& uncolorable_node_list);
   bool judgeIsColorable(DrcConflictNode* node, int color);
   bool dfs(DrcConflictNode* node);
   void storeUncolorableNode();
@@ -32,26 +32,44 @@ bool ConnectedComponentFinder::isInStack(DrcConflictNode* conflict_node)
   return _node_in_stack.find(conflict_node) != _node_in_stack.end();
 }
 
-void ConnectedComponentFinder::Tarjan(DrcConflictNode* node)
+void ConnectedComponentFinder::Tarjan(DrcConflictNode* root_node)
 {
-  _dfn[node] = _low[node] = ++_index;
-  _temp_stack.push_back(node);
-  _node_in_stack.insert(node);
-  for (auto conflict_node : node->get_conflict_node_list()) {
-    if (_dfn.find(conflict_node) == _dfn.end()) {
-      conflict_node->set_parent_node(node);
-      Tarjan(conflict_node);
-      _low[node] = std::min(_low[node], _low[conflict_node]);
-      conflict_node->erase_parent_node();
-    } else if (isInStack(conflict_node)) {
-      if (conflict_node != node->get_parent_node()) {
-        _low[node] = std::min(_low[node], _dfn[conflict_node]);
+  // 显式栈代替递归，避免大连通分量栈溢出，pair为节点和下一个待访问邻接点的下标
+  std::vector<std::pair<DrcConflictNode*, size_t>> search_stack;
+  auto visit = [&](DrcConflictNode* node) {
+    _dfn[node] = _low[node] = ++_index;
+    _temp_stack.push_back(node);
+    _node_in_stack.insert(node);
+    search_stack.emplace_back(node, 0);
+  };
+
+  visit(root_node);
+  while (!search_stack.empty()) {
+    DrcConflictNode* node = search_stack.back().first;
+    size_t& next_idx = search_stack.back().second;
+    std::vector<DrcConflictNode*>& conflict_node_list = node->get_conflict_node_list();
+    if (next_idx < conflict_node_list.size()) {
+      DrcConflictNode* conflict_node = conflict_node_list[next_idx++];
+      if (_dfn.find(conflict_node) == _dfn.end()) {
+        conflict_node->set_parent_node(node);
+        visit(conflict_node);
+      } else if (isInStack(conflict_node)) {
+        if (conflict_node != node->get_parent_node()) {
+          _low[node] = std::min(_low[node], _dfn[conflict_node]);
+        }
       }
+      continue;
     }
-  }
 
-  if (_low[node] == _dfn[node]) {
-    storeConnectedComponent(node);
+    search_stack.pop_back();
+    if (_low[node] == _dfn[node]) {
+      storeConnectedComponent(node);
+    }
+    if (!search_stack.empty()) {
+      DrcConflictNode* parent_node = search_stack.back().first;
+      _low[parent_node] = std::min(_low[parent_node], _low[node]);
+      node->erase_parent_node();
+    }
   }
 }
 
@@ -63,7 +81,7 @@ void ConnectedComponentFinder::storeConnectedComponent(DrcConflictNode* node)
     record_node = _temp_stack.back();
     record_node_list.push_back(record_node);
     _temp_stack.pop_back();
-    _node_in_stack.erase(node);
+    _node_in_stack.erase(record_node);
 
   } while (record_node != node);
 
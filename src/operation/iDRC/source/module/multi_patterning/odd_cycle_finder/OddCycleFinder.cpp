@@ -20,8 +20,16 @@ namespace idrc {
 
 std::vector<std::vector<DrcConflictNode*>>& OddCycleFinder::findAllOddCycles(std::vector<DrcConflictGraph*> connected_component_list)
 {
-  for (auto sub_graph : connected_component_list) {
-    findOddCyclesInConnectedComponent(sub_graph);
+  // 各连通分量互不相交，并行查找，结果按分量顺序合并
+  std::vector<std::vector<std::vector<DrcConflictNode*>>> odd_cycle_list_list(connected_component_list.size());
+#pragma omp parallel for schedule(dynamic)
+  for (size_t i = 0; i < connected_component_list.size(); ++i) {
+    OddCycleFinder odd_cycle_finder;
+    odd_cycle_finder.findOddCyclesInConnectedComponent(connected_component_list[i]);
+    odd_cycle_list_list[i] = std::move(odd_cycle_finder._odd_cycle_list);
+  }
+  for (auto& odd_cycle_list : odd_cycle_list_list) {
+    _odd_cycle_list.insert(_odd_cycle_list.end(), odd_cycle_list.begin(), odd_cycle_list.end());
   }
   return _odd_cycle_list;
 }
@@ -79,13 +87,18 @@ void OddCycleFinder::storeOddCycle(DrcConflictNode* start_node)
 void OddCycleFinder::unlock(DrcConflictNode* node)
 {
   _blocked_set.erase(node);
-  for (auto map_node : _blocked_map[node]) {
-    if (isBlock(map_node)) {
-      unlock(map_node);
+  std::vector<DrcConflictNode*> unlock_node_list{node};
+  while (!unlock_node_list.empty()) {
+    DrcConflictNode* unlock_node = unlock_node_list.back();
+    unlock_node_list.pop_back();
+    for (auto map_node : _blocked_map[unlock_node]) {
+      if (isBlock(map_node)) {
+        _blocked_set.erase(map_node);
+        unlock_node_list.push_back(map_node);
+      }
     }
+    _blocked_map.erase(unlock_node);
   }
-  _blocked_map[node].clear();
-  _blocked_map.erase(node);
 }
 
 void OddCycleFinder::storeBlockMap(DrcConflictNode* current_node)
@@ -99,31 +112,52 @@ void OddCycleFinder::storeBlockMap(DrcConflictNode* current_node)
 
 bool OddCycleFinder::findOddCyclesInConnectedComponent(DrcConflictNode* start_node, DrcConflictNode* current_node)
 {
-  bool findCycle = false;
-  _temp_stack.push_back(current_node);
-  _blocked_set.insert(current_node);
+  // 显式栈代替递归，_temp_stack为当前路径，search_stack记录每层的下一个邻接点和是否找到环
+  struct SearchFrame
+  {
+    DrcConflictNode* node;
+    size_t next_idx;
+    bool find_cycle;
+  };
+  std::vector<SearchFrame> search_stack;
+  auto enter = [&](DrcConflictNode* node) {
+    _temp_stack.push_back(node);
+    _blocked_set.insert(node);
+    search_stack.push_back(SearchFrame{node, 0, false});
+  };
 
-  for (auto conflict_node : current_node->get_conflict_node_list()) {
-    if (isIgnoredNode(conflict_node)) {
+  enter(current_node);
+  bool find_cycle = false;
+  while (!search_stack.empty()) {
+    SearchFrame& frame = search_stack.back();
+    std::vector<DrcConflictNode*>& conflict_node_list = frame.node->get_conflict_node_list();
+    if (frame.next_idx < conflict_node_list.size()) {
+      DrcConflictNode* conflict_node = conflict_node_list[frame.next_idx++];
+      if (isIgnoredNode(conflict_node)) {
+        continue;
+      }
+      if (conflict_node == start_node) {
+        frame.find_cycle = true;
+        storeOddCycle(start_node);
+      } else if (!isBlock(conflict_node) && _origin_subgraph_node_list.find(conflict_node) != _origin_subgraph_node_list.end()) {
+        enter(conflict_node);
+      }
       continue;
     }
 
-    if (conflict_node == start_node) {
-      findCycle = true;
-      storeOddCycle(start_node);
-    } else if (!isBlock(conflict_node) && _origin_subgraph_node_list.find(conflict_node) != _origin_subgraph_node_list.end()) {
-      bool getCycle = findOddCyclesInConnectedComponent(start_node, conflict_node);
-      findCycle = findCycle || getCycle;
+    DrcConflictNode* node = frame.node;
+    find_cycle = frame.find_cycle;
+    if (find_cycle) {
+      unlock(node);
+    } else {
+      storeBlockMap(node);
+    }
+    _temp_stack.pop_back();
+    search_stack.pop_back();
+    if (!search_stack.empty()) {
+      search_stack.back().find_cycle = search_stack.back().find_cycle || find_cycle;
     }
   }
-
-  if (findCycle) {
-    unlock(current_node);
-  } else {
-    storeBlockMap(current_node);
-  }
-
-  _temp_stack.pop_back();
-  return findCycle;
+  return find_cycle;
 }
 }  // namespace idrc
\ No newline at end of file
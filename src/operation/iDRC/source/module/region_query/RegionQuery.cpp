@@ -19,6 +19,7 @@
 #include "CornerFillSpacingCheck.hpp"
 #include "DrcConfig.h"
 #include "EOLSpacingCheck.hpp"
+#include "omp.h"
 
 namespace idrc {
 void RegionQuery::init(DrcConfig* config, DrcDesign* design)
@@ -32,18 +33,18 @@ void RegionQuery::queryIntersectsInRoutingLayer(int routingLayerId, RTreeBox que
                                                 std::vector<std::pair<RTreeBox, DrcRect*>>& query_result)
 {
   // _layer_to_routing_rects_tree_map[routingLayerId].query(bgi::intersects(query_box), std::back_inserter(query_result));
-  _layer_to_routing_rects_tree_map[routingLayerId].query(bgi::contains(query_box), std::back_inserter(query_result));
-  _layer_to_routing_rects_tree_map[routingLayerId].query(bgi::overlaps(query_box), std::back_inserter(query_result));
-  _layer_to_routing_rects_tree_map[routingLayerId].query(bgi::covers(query_box), std::back_inserter(query_result));
-  _layer_to_routing_rects_tree_map[routingLayerId].query(bgi::covered_by(query_box), std::back_inserter(query_result));
+  queryTree(_layer_to_routing_rects_tree_map, routingLayerId, bgi::contains(query_box), std::back_inserter(query_result));
+  queryTree(_layer_to_routing_rects_tree_map, routingLayerId, bgi::overlaps(query_box), std::back_inserter(query_result));
+  queryTree(_layer_to_routing_rects_tree_map, routingLayerId, bgi::covers(query_box), std::back_inserter(query_result));
+  queryTree(_layer_to_routing_rects_tree_map, routingLayerId, bgi::covered_by(query_box), std::back_inserter(query_result));
   // _layer_to_routing_rects_tree_map[routingLayerId].query(bgi::intersects(query_box), std::back_inserter(query_result));
   // _layer_to_routing_rects_tree_map[routingLayerId].query(bgi::disjoint(query_box), std::back_inserter(query_result));
   // _layer_to_routing_rects_tree_map[routingLayerId].query(bgi::within(query_box), std::back_inserter(query_result));
   // _layer_to_fixed_rects_tree_map[routingLayerId].query(bgi::intersects(query_box), std::back_inserter(query_result));
-  _layer_to_fixed_rects_tree_map[routingLayerId].query(bgi::contains(query_box), std::back_inserter(query_result));
-  _layer_to_fixed_rects_tree_map[routingLayerId].query(bgi::overlaps(query_box), std::back_inserter(query_result));
-  _layer_to_fixed_rects_tree_map[routingLayerId].query(bgi::covers(query_box), std::back_inserter(query_result));
-  _layer_to_fixed_rects_tree_map[routingLayerId].query(bgi::covered_by(query_box), std::back_inserter(query_result));
+  queryTree(_layer_to_fixed_rects_tree_map, routingLayerId, bgi::contains(query_box), std::back_inserter(query_result));
+  queryTree(_layer_to_fixed_rects_tree_map, routingLayerId, bgi::overlaps(query_box), std::back_inserter(query_result));
+  queryTree(_layer_to_fixed_rects_tree_map, routingLayerId, bgi::covers(query_box), std::back_inserter(query_result));
+  queryTree(_layer_to_fixed_rects_tree_map, routingLayerId, bgi::covered_by(query_box), std::back_inserter(query_result));
   // _layer_to_fixed_rects_tree_map[routingLayerId].query(bgi::intersects(query_box), std::back_inserter(query_result));
   // _layer_to_fixed_rects_tree_map[routingLayerId].query(bgi::disjoint(query_box), std::back_inserter(query_result));
   // _layer_to_fixed_rects_tree_map[routingLayerId].query(bgi::within(query_box), std::back_inserter(query_result));
@@ -55,7 +56,7 @@ void RegionQuery::queryContainsInRoutingLayer(int routingLayerId, RTreeBox query
   // _layer_to_routing_rects_tree_map[routingLayerId].query(bgi::intersects(query_box), std::back_inserter(query_result));
   // _layer_to_routing_rects_tree_map[routingLayerId].query(bgi::contains(query_box), std::back_inserter(query_result));
 
-  _layer_to_routing_rects_tree_map[routingLayerId].query(bgi::covers(query_box), std::back_inserter(query_result));
+  queryTree(_layer_to_routing_rects_tree_map, routingLayerId, bgi::covers(query_box), std::back_inserter(query_result));
 
   // _layer_to_routing_rects_tree_map[routingLayerId].query(bgi::intersects(query_box), std::back_inserter(query_result));
   // _layer_to_routing_rects_tree_map[routingLayerId].query(bgi::disjoint(query_box), std::back_inserter(query_result));
@@ -63,7 +64,7 @@ void RegionQuery::queryContainsInRoutingLayer(int routingLayerId, RTreeBox query
   // _layer_to_fixed_rects_tree_map[routingLayerId].query(bgi::intersects(query_box), std::back_inserter(query_result));
   // _layer_to_fixed_rects_tree_map[routingLayerId].query(bgi::contains(query_box), std::back_inserter(query_result));
 
-  _layer_to_fixed_rects_tree_map[routingLayerId].query(bgi::covers(query_box), std::back_inserter(query_result));
+  queryTree(_layer_to_fixed_rects_tree_map, routingLayerId, bgi::covers(query_box), std::back_inserter(query_result));
 
   // _layer_to_fixed_rects_tree_map[routingLayerId].query(bgi::intersects(query_box), std::back_inserter(query_result));
   // _layer_to_fixed_rects_tree_map[routingLayerId].query(bgi::disjoint(query_box), std::back_inserter(query_result));
@@ -92,8 +93,8 @@ void RegionQuery::queryInRoutingLayer(int routingLayerId, RTreeBox query_box, st
  */
 void RegionQuery::queryEnclosureInRoutingLayer(int LayerId, RTreeBox query_box, std::vector<std::pair<RTreeBox, DrcRect*>>& query_result)
 {
-  _layer_to_routing_rects_tree_map[LayerId].query(bgi::covers(query_box), std::back_inserter(query_result));
-  _layer_to_fixed_rects_tree_map[LayerId].query(bgi::intersects(query_box), std::back_inserter(query_result));
+  queryTree(_layer_to_routing_rects_tree_map, LayerId, bgi::covers(query_box), std::back_inserter(query_result));
+  queryTree(_layer_to_fixed_rects_tree_map, LayerId, bgi::intersects(query_box), std::back_inserter(query_result));
 }
 
 /**
@@ -105,7 +106,7 @@ void RegionQuery::queryEnclosureInRoutingLayer(int LayerId, RTreeBox query_box,
  */
 void RegionQuery::searchRoutingRect(int routingLayerId, RTreeBox query_box, std::vector<std::pair<RTreeBox, DrcRect*>>& query_result)
 {
-  _layer_to_routing_rects_tree_map[routingLayerId].query(bgi::overlaps(query_box), std::back_inserter(query_result));
+  queryTree(_layer_to_routing_rects_tree_map, routingLayerId, bgi::overlaps(query_box), std::back_inserter(query_result));
 }
 
 /**
@@ -117,7 +118,7 @@ void RegionQuery::searchRoutingRect(int routingLayerId, RTreeBox query_box, std:
  */
 void RegionQuery::searchFixedRect(int routingLayerId, RTreeBox query_box, std::vector<std::pair<RTreeBox, DrcRect*>>& query_result)
 {
-  _layer_to_fixed_rects_tree_map[routingLayerId].query(bgi::overlaps(query_box), std::back_inserter(query_result));
+  queryTree(_layer_to_fixed_rects_tree_map, routingLayerId, bgi::overlaps(query_box), std::back_inserter(query_result));
 }
 
 // 下面的目前没用到
@@ -128,14 +129,14 @@ void RegionQuery::queryInCutLayer(int cutLayerId, RTreeBox query_box, std::vecto
 
 void RegionQuery::searchCutRect(int cutLayerId, RTreeBox query_box, std::vector<std::pair<RTreeBox, DrcRect*>>& query_result)
 {
-  _layer_to_cut_rects_tree_map[cutLayerId].query(bgi::overlaps(query_box), std::back_inserter(query_result));
+  queryTree(_layer_to_cut_rects_tree_map, cutLayerId, bgi::overlaps(query_box), std::back_inserter(query_result));
 }
 
 void RegionQuery::queryInMaxScope(int layer_id, RTreeBox check_rect,
                                   std::map<void*, std::map<ScopeType, std::vector<DrcRect*>>>& query_result)
 {
   std::vector<std::pair<RTreeBox, DrcRect*>> origin_result;
-  _layer_to_routing_max_region_tree_map[layer_id].query(bgi::overlaps(check_rect), std::back_inserter(origin_result));
+  queryTree(_layer_to_routing_max_region_tree_map, layer_id, bgi::overlaps(check_rect), std::back_inserter(origin_result));
   for (auto& [rtree_box, drc_rect] : origin_result) {
     query_result[drc_rect->get_scope_owner()][drc_rect->getScopeType()].push_back(drc_rect);
   }
@@ -145,7 +146,7 @@ void RegionQuery::queryInMinScope(int layer_id, RTreeBox check_rect,
                                   std::map<void*, std::map<ScopeType, std::vector<DrcRect*>>>& query_result)
 {
   std::vector<std::pair<RTreeBox, DrcRect*>> origin_result;
-  _layer_to_routing_min_region_tree_map[layer_id].query(bgi::overlaps(check_rect), std::back_inserter(origin_result));
+  queryTree(_layer_to_routing_min_region_tree_map, layer_id, bgi::overlaps(check_rect), std::back_inserter(origin_result));
   for (auto& [rtree_box, drc_rect] : origin_result) {
     query_result[drc_rect->get_scope_owner()][drc_rect->getScopeType()].push_back(drc_rect);
   }
@@ -255,6 +256,9 @@ void RegionQuery::printFixedRectsRTree()
 
 bool RegionQuery::addCutSpacingViolation(DrcRect* target_rect, DrcRect* result_rect)
 {
+  if (RegionViolationBuffer* buffer = getViolationBuffer()) {
+    return insertViolationPair(buffer->cut_spacing_vio_set, target_rect, result_rect);
+  }
   if (target_rect > result_rect) {
     return _cut_spacing_vio_set.insert(std::make_pair(target_rect, result_rect)).second;
   } else {
@@ -265,6 +269,9 @@ bool RegionQuery::addCutSpacingViolation(DrcRect* target_rect, DrcRect* result_r
 
 bool RegionQuery::addCutDiffLayerSpacingViolation(DrcRect* target_rect, DrcRect* result_rect)
 {
+  if (RegionViolationBuffer* buffer = getViolationBuffer()) {
+    return insertViolationPair(buffer->cut_diff_layer_spacing_vio_set, target_rect, result_rect);
+  }
   if (target_rect > result_rect) {
     return _cut_diff_layer_spacing_vio_set.insert(std::make_pair(target_rect, result_rect)).second;
   } else {
@@ -336,6 +343,9 @@ void RegionQuery::initShortVioSpot()
 
 bool RegionQuery::addCutEOLSpacingViolation(DrcRect* target_rect, DrcRect* result_rect)
 {
+  if (RegionViolationBuffer* buffer = getViolationBuffer()) {
+    return insertViolationPair(buffer->cut_eol_spacing_vio_set, target_rect, result_rect);
+  }
   if (target_rect > result_rect) {
     return _cut_eol_spacing_vio_set.insert(std::make_pair(target_rect, result_rect)).second;
   } else {
@@ -346,6 +356,10 @@ bool RegionQuery::addCutEOLSpacingViolation(DrcRect* target_rect, DrcRect* resul
 
 void RegionQuery::addPRLRunLengthSpacingViolation(int layer_id, RTreeBox span_box)
 {
+  if (RegionViolationBuffer* buffer = getViolationBuffer()) {
+    buffer->vio_box_list.emplace_back(buffer->net_order, ViolationType::kRoutingSpacing, layer_id, span_box);
+    return;
+  }
   std::vector<RTreeBox> query_result;
   _layer_to_prl_vio_box_tree[layer_id].query(bgi::intersects(span_box), std::back_inserter(query_result));
   for (auto& box : query_result) {
@@ -366,6 +380,9 @@ void RegionQuery::addPRLRunLengthSpacingViolation(int layer_id, RTreeBox span_bo
 
 bool RegionQuery::addPRLRunLengthSpacingViolation(DrcRect* target_rect, DrcRect* result_rect)
 {
+  if (RegionViolationBuffer* buffer = getViolationBuffer()) {
+    return insertViolationPair(buffer->prl_spacing_vio_set, target_rect, result_rect);
+  }
   if (target_rect > result_rect) {
     return _prl_spacing_vio_set.insert(std::make_pair(target_rect, result_rect)).second;
   } else {
@@ -376,6 +393,10 @@ bool RegionQuery::addPRLRunLengthSpacingViolation(DrcRect* target_rect, DrcRect*
 
 void RegionQuery::addMetalEOLSpacingViolation(int layer_id, RTreeBox span_box)
 {
+  if (RegionViolationBuffer* buffer = getViolationBuffer()) {
+    buffer->vio_box_list.emplace_back(buffer->net_order, ViolationType::kEOLSpacing, layer_id, span_box);
+    return;
+  }
   std::vector<RTreeBox> query_result;
   _layer_to_metal_EOL_vio_box_tree[layer_id].query(bgi::intersects(span_box), std::back_inserter(query_result));
   for (auto& box : query_result) {
@@ -396,6 +417,10 @@ void RegionQuery::addMetalEOLSpacingViolation(int layer_id, RTreeBox span_box)
 
 void RegionQuery::addShortViolation(int layer_id, RTreeBox span_box)
 {
+  if (RegionViolationBuffer* buffer = getViolationBuffer()) {
+    buffer->vio_box_list.emplace_back(buffer->net_order, ViolationType::kShort, layer_id, span_box);
+    return;
+  }
   std::vector<RTreeBox> query_result;
   _layer_to_short_vio_box_tree[layer_id].query(bgi::intersects(span_box), std::back_inserter(query_result));
   for (auto& box : query_result) {
@@ -416,6 +441,9 @@ void RegionQuery::addShortViolation(int layer_id, RTreeBox span_box)
 
 bool RegionQuery::addShortViolation(DrcRect* target_rect, DrcRect* result_rect)
 {
+  if (RegionViolationBuffer* buffer = getViolationBuffer()) {
+    return insertViolationPair(buffer->short_vio_set, target_rect, result_rect);
+  }
   if (target_rect > result_rect) {
     return _short_vio_set.insert(std::make_pair(target_rect, result_rect)).second;
   } else {
@@ -426,6 +454,10 @@ bool RegionQuery::addShortViolation(DrcRect* target_rect, DrcRect* result_rect)
 
 void RegionQuery::addViolation(ViolationType vio_type)
 {
+  if (RegionViolationBuffer* buffer = getViolationBuffer()) {
+    buffer->vio_type_to_count_map[vio_type]++;
+    return;
+  }
   switch (vio_type) {
     case ViolationType::kCutShort:
       break;
@@ -484,6 +516,159 @@ void RegionQuery::addViolation(ViolationType vio_type)
   }
 }
 
+void RegionQuery::addViolationSpot(DrcViolationSpot* spot)
+{
+  if (RegionViolationBuffer* buffer = getViolationBuffer()) {
+    buffer->vio_spot_list.emplace_back(buffer->net_order, spot);
+    return;
+  }
+  switch (spot->get_violation_type()) {
+    case ViolationType::kShort:
+      _short_vio_spot_list.emplace_back(spot);
+      break;
+    case ViolationType::kRoutingSpacing:
+      _prl_run_length_spacing_spot_list.emplace_back(spot);
+      break;
+    case ViolationType::kCutSpacing:
+      _cut_spacing_spot_list.emplace_back(spot);
+      break;
+    case ViolationType::kCutEOLSpacing:
+      _cut_eol_spacing_spot_list.emplace_back(spot);
+      break;
+    case ViolationType::kCutDiffLayerSpacing:
+      _cut_diff_layer_spacing_spot_list.emplace_back(spot);
+      break;
+    case ViolationType::kEnclosure:
+      _cut_enclosure_spot_list.emplace_back(spot);
+      break;
+    case ViolationType::kEnclosureEdge:
+      _cut_enclosure_edge_spot_list.emplace_back(spot);
+      break;
+    case ViolationType::kCornerFillingSpacing:
+      _metal_corner_fill_spacing_spot_list.emplace_back(spot);
+      break;
+    case ViolationType::kJogSpacing:
+      _metal_jog_spacing_spot_list.emplace_back(spot);
+      break;
+    case ViolationType::kEOLSpacing:
+      _metal_eol_spacing_spot_list.emplace_back(spot);
+      break;
+    case ViolationType::kNotchSpacing:
+      _metal_notch_spacing_spot_list.emplace_back(spot);
+      break;
+    case ViolationType::kRoutingArea:
+      _min_area_spot_list.emplace_back(spot);
+      break;
+    case ViolationType::kMinStep:
+      _min_step_spot_list.emplace_back(spot);
+      break;
+    case ViolationType::kEnclosedArea:
+      _min_hole_spot_list.emplace_back(spot);
+      break;
+    default:
+      delete spot;
+      break;
+  }
+}
+
+/**
+ * @brief Enter the parallel check mode, violations found by each thread are buffered separately until finishParallelCheck
+ *
+ * @param thread_number number of threads in the check team
+ */
+void RegionQuery::startParallelCheck(int thread_number)
+{
+  _violation_buffer_list.assign(std::max(1, thread_number), RegionViolationBuffer());
+}
+
+/**
+ * @brief Record the order of the net being checked by the current thread, used to merge the results in net order
+ *
+ * @param net_order
+ */
+void RegionQuery::setParallelCheckNet(int net_order)
+{
+  if (RegionViolationBuffer* buffer = getViolationBuffer()) {
+    buffer->net_order = net_order;
+  }
+}
+
+/**
+ * @brief Merge the violations buffered by each thread.
+ *        Counts and violation pairs are merged directly, violation boxes and spots are replayed in net order,
+ *        so the result does not depend on how nets were scheduled on threads
+ *
+ */
+void RegionQuery::finishParallelCheck()
+{
+  std::vector<RegionViolationBuffer> buffer_list = std::move(_violation_buffer_list);
+  _violation_buffer_list.clear();
+
+  std::vector<std::tuple<int, ViolationType, int, RTreeBox>> vio_box_list;
+  std::vector<std::pair<int, DrcViolationSpot*>> vio_spot_list;
+  for (RegionViolationBuffer& buffer : buffer_list) {
+    for (auto& [vio_type, count] : buffer.vio_type_to_count_map) {
+      for (int i = 0; i < count; ++i) {
+        addViolation(vio_type);
+      }
+    }
+    _prl_spacing_vio_set.insert(buffer.prl_spacing_vio_set.begin(), buffer.prl_spacing_vio_set.end());
+    _short_vio_set.insert(buffer.short_vio_set.begin(), buffer.short_vio_set.end());
+    _cut_spacing_vio_set.insert(buffer.cut_spacing_vio_set.begin(), buffer.cut_spacing_vio_set.end());
+    _cut_diff_layer_spacing_vio_set.insert(buffer.cut_diff_layer_spacing_vio_set.begin(), buffer.cut_diff_layer_spacing_vio_set.end());
+    _cut_eol_spacing_vio_set.insert(buffer.cut_eol_spacing_vio_set.begin(), buffer.cut_eol_spacing_vio_set.end());
+    vio_box_list.insert(vio_box_list.end(), buffer.vio_box_list.begin(), buffer.vio_box_list.end());
+    vio_spot_list.insert(vio_spot_list.end(), buffer.vio_spot_list.begin(), buffer.vio_spot_list.end());
+  }
+
+  std::stable_sort(vio_box_list.begin(), vio_box_list.end(),
+                   [](const auto& a, const auto& b) { return std::get<0>(a) < std::get<0>(b); });
+  for (auto& [net_order, vio_type, layer_id, span_box] : vio_box_list) {
+    switch (vio_type) {
+      case ViolationType::kRoutingSpacing:
+        addPRLRunLengthSpacingViolation(layer_id, span_box);
+        break;
+      case ViolationType::kShort:
+        addShortViolation(layer_id, span_box);
+        break;
+      case ViolationType::kEOLSpacing:
+        addMetalEOLSpacingViolation(layer_id, span_box);
+        break;
+      default:
+        break;
+    }
+  }
+
+  // 同一对矩形可能被两个线程分别从两端检查到，按违例位置去重
+  std::stable_sort(vio_spot_list.begin(), vio_spot_list.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+  std::set<std::tuple<ViolationType, int, int, int, int, int>> visited_spot_set;
+  for (auto& [net_order, spot] : vio_spot_list) {
+    auto spot_key = std::make_tuple(spot->get_violation_type(), spot->get_layer_id(), spot->get_min_x(), spot->get_min_y(),
+                                    spot->get_max_x(), spot->get_max_y());
+    if (!visited_spot_set.insert(spot_key).second) {
+      delete spot;
+      continue;
+    }
+    addViolationSpot(spot);
+  }
+}
+
+RegionViolationBuffer* RegionQuery::getViolationBuffer()
+{
+  if (_violation_buffer_list.empty()) {
+    return nullptr;
+  }
+  return &_violation_buffer_list[omp_get_thread_num()];
+}
+
+bool RegionQuery::insertViolationPair(std::set<std::pair<DrcRect*, DrcRect*>>& vio_set, DrcRect* target_rect, DrcRect* result_rect)
+{
+  if (target_rect > result_rect) {
+    return vio_set.insert(std::make_pair(target_rect, result_rect)).second;
+  }
+  return vio_set.insert(std::make_pair(result_rect, target_rect)).second;
+}
+
 void RegionQuery::getRegionDetailReport(std::map<std::string, std::vector<DrcViolationSpot*>>& vio_map)
 {
   vio_map.insert(std::make_pair("Cut EOL Spacing", _cut_eol_spacing_spot_list));
@@ -721,12 +906,12 @@ void RegionQuery::queryEdgeInRoutingLayer(int routingLayerId, RTreeBox query_box
 
 void RegionQuery::searchRoutingEdge(int routingLayerId, RTreeBox query_box, std::vector<std::pair<RTreeSegment, DrcEdge*>>& result)
 {
-  _layer_to_routing_edges[routingLayerId].query(bgi::intersects(query_box), std::back_inserter(result));
+  queryTree(_layer_to_routing_edges, routingLayerId, bgi::intersects(query_box), std::back_inserter(result));
 }
 
 void RegionQuery::searchBlockEdge(int routingLayerId, RTreeBox query_box, std::vector<std::pair<RTreeSegment, DrcEdge*>>& result)
 {
-  _layer_to_block_edges[routingLayerId].query(bgi::intersects(query_box), std::back_inserter(result));
+  queryTree(_layer_to_block_edges, routingLayerId, bgi::intersects(query_box), std::back_inserter(result));
 }
 
 void RegionQuery::addDrcRect(DrcRect* drc_rect, Tech* tech)
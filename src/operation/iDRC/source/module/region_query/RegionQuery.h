@@ -20,6 +20,8 @@
 #include <algorithm>
 #include <map>
 #include <memory>
+#include <set>
+#include <tuple>
 #include <vector>
 
 #include "BoostType.h"
@@ -31,6 +33,22 @@ namespace idrc {
 
 class DrcConfig;
 
+// 并行检查时每个线程独立记录的违例，检查结束后按net顺序合并回RegionQuery
+struct RegionViolationBuffer
+{
+  int net_order = -1;
+  std::map<ViolationType, int> vio_type_to_count_map;
+  std::set<std::pair<DrcRect*, DrcRect*>> prl_spacing_vio_set;
+  std::set<std::pair<DrcRect*, DrcRect*>> short_vio_set;
+  std::set<std::pair<DrcRect*, DrcRect*>> cut_spacing_vio_set;
+  std::set<std::pair<DrcRect*, DrcRect*>> cut_diff_layer_spacing_vio_set;
+  std::set<std::pair<DrcRect*, DrcRect*>> cut_eol_spacing_vio_set;
+  // net_order, vio_type, layer_id, span_box
+  std::vector<std::tuple<int, ViolationType, int, RTreeBox>> vio_box_list;
+  // net_order, spot
+  std::vector<std::pair<int, DrcViolationSpot*>> vio_spot_list;
+};
+
 class RegionQuery
 {
  public:
@@ -84,6 +102,12 @@ class RegionQuery
   bool addCutSpacingViolation(DrcRect* target_rect, DrcRect* result_rect);
   bool addCutDiffLayerSpacingViolation(DrcRect* target_rect, DrcRect* result_rect);
   bool addCutEOLSpacingViolation(DrcRect* target_rect, DrcRect* result_rect);
+  void addViolationSpot(DrcViolationSpot* spot);
+
+  // parallel check
+  void startParallelCheck(int thread_number);
+  void setParallelCheckNet(int net_order);
+  void finishParallelCheck();
 
   // setter
   // getter
@@ -200,6 +224,8 @@ class RegionQuery
   std::set<std::pair<DrcRect*, DrcRect*>> _cut_diff_layer_spacing_vio_set;
 
   std::set<std::pair<DrcRect*, DrcRect*>> _cut_eol_spacing_vio_set;
+  // 非空时处于并行检查中，每个线程一份
+  std::vector<RegionViolationBuffer> _violation_buffer_list;
 
   DrcConfig* _config;
   DrcDesign* _drc_design;
@@ -262,6 +288,19 @@ class RegionQuery
 
   RTreeSegment getRTreeSegment(DrcEdge* drcEdge);
   RTreeBox getRTreeBox(DrcRect* drcRect);
+
+  // parallel check
+  RegionViolationBuffer* getViolationBuffer();
+  static bool insertViolationPair(std::set<std::pair<DrcRect*, DrcRect*>>& vio_set, DrcRect* target_rect, DrcRect* result_rect);
+  // 查询时不通过operator[]创建新的层，保证并行检查时R树只读
+  template <typename RTree, typename Predicate, typename OutIter>
+  static void queryTree(const std::map<int, RTree>& layer_to_tree_map, int layer_id, const Predicate& predicate, OutIter out_iter)
+  {
+    auto iter = layer_to_tree_map.find(layer_id);
+    if (iter != layer_to_tree_map.end()) {
+      iter->second.query(predicate, out_iter);
+    }
+  }
 };
 }  // namespace idrc
 
@@ -125,7 +125,7 @@ void EnclosedAreaCheck::addSpot(bp::polygon_90_data<int>& hole_polygon, int laye
   spot->set_layer_name(_tech->getCutLayerNameById(layer_id));
   spot->set_vio_type(ViolationType::kEnclosedArea);
   spot->setCoordinate(box.min_corner().x(), box.min_corner().y(), box.max_corner().x(), box.max_corner().y());
-  _region_query->_min_hole_spot_list.emplace_back(spot);
+  _region_query->addViolationSpot(spot);
 }
 
 /**
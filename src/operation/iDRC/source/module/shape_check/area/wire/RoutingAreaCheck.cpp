@@ -87,7 +87,7 @@ void RoutingAreaCheck::addSpot(DrcPoly* target_poly)
   spot->set_net_id(target_poly->getNetId());
   spot->set_vio_type(ViolationType::kRoutingArea);
   spot->setCoordinate(box.min_corner().x(), box.min_corner().y(), box.max_corner().x(), box.max_corner().y());
-  _region_query->_min_area_spot_list.emplace_back(spot);
+  _region_query->addViolationSpot(spot);
 }
 
 bool RoutingAreaCheck::checkLef58Area(DrcPoly* target_poly)
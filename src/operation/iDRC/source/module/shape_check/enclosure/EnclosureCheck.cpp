@@ -655,7 +655,7 @@ void EnclosureCheck::addSpot(DrcRect* target_cut_rect)
   spot->set_net_id(target_cut_rect->get_net_id());
   spot->set_vio_type(ViolationType::kEnclosure);
   spot->setCoordinate(box.min_corner().x(), box.min_corner().y(), box.max_corner().x(), box.max_corner().y());
-  _region_query->_cut_enclosure_spot_list.emplace_back(spot);
+  _region_query->addViolationSpot(spot);
 }
 
 void EnclosureCheck::addEdgeEnclosureSpot(DrcRect* target_cut_rect)
@@ -668,7 +668,7 @@ void EnclosureCheck::addEdgeEnclosureSpot(DrcRect* target_cut_rect)
   spot->set_net_id(target_cut_rect->get_net_id());
   spot->set_vio_type(ViolationType::kEnclosureEdge);
   spot->setCoordinate(box.min_corner().x(), box.min_corner().y(), box.max_corner().x(), box.max_corner().y());
-  _region_query->_cut_enclosure_edge_spot_list.emplace_back(spot);
+  _region_query->addViolationSpot(spot);
 }
 
 bool EnclosureCheck::checkParWithin(DrcRect* target_cut_rect, DrcEdge* drc_edge)
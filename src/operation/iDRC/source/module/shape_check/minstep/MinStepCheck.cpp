@@ -167,7 +167,7 @@ void MinStepCheck::addSpot_lef58(DrcEdge* edge, DrcEdge* adj_edge)
   // spot->set_net_id(edge->getNetId());
   spot->set_vio_type(ViolationType::kMinStep);
   spot->setCoordinate(lb_x, lb_y, rt_x, rt_y);
-  _region_query->_min_step_spot_list.emplace_back(spot);
+  _region_query->addViolationSpot(spot);
 }
 void MinStepCheck::addSpot(DrcEdge* begin_edge, DrcEdge* end_edge)
 {
@@ -214,7 +214,7 @@ void MinStepCheck::addSpot(DrcEdge* begin_edge, DrcEdge* end_edge)
   // }
   // spot->setCoordinate(edge->get_min_x(), edge->get_min_y(), edge->get_max_x(), edge->get_max_y());
   spot->setCoordinate(lb_x, lb_y, rt_x, rt_y);
-  _region_query->_min_step_spot_list.emplace_back(spot);
+  _region_query->addViolationSpot(spot);
 }
 
 void MinStepCheck::refresh(DrcEdge* edge)
@@ -202,7 +202,7 @@ void CornerFillSpacingCheck::addSpot(DrcRect* result_rect)
   spot->set_net_id(_corner_fill_rect.get_net_id());
   spot->set_vio_type(ViolationType::kCornerFillingSpacing);
   spot->setCoordinate(box.min_corner().x(), box.min_corner().y(), box.max_corner().x(), box.max_corner().y());
-  _region_query->_metal_corner_fill_spacing_spot_list.emplace_back(spot);
+  _region_query->addViolationSpot(spot);
 }
 
 void CornerFillSpacingCheck::checkSpacing(DrcRect* result_rect)
@@ -363,7 +363,7 @@ void CutSpacingCheck::addCutSpacingSpot(DrcRect* target_rect, DrcRect* result_re
   spot->set_net_id(target_rect->get_net_id());
   spot->set_vio_type(ViolationType::kCutSpacing);
   spot->setCoordinate(box.min_corner().x(), box.min_corner().y(), box.max_corner().x(), box.max_corner().y());
-  _region_query->_cut_spacing_spot_list.emplace_back(spot);
+  _region_query->addViolationSpot(spot);
 }
 
 void CutSpacingCheck::addDiffLayerSpot(DrcRect* target_rect, DrcRect* result_rect)
@@ -376,7 +376,7 @@ void CutSpacingCheck::addDiffLayerSpot(DrcRect* target_rect, DrcRect* result_rec
   spot->set_net_id(target_rect->get_net_id());
   spot->set_vio_type(ViolationType::kCutDiffLayerSpacing);
   spot->setCoordinate(box.min_corner().x(), box.min_corner().y(), box.max_corner().x(), box.max_corner().y());
-  _region_query->_cut_diff_layer_spacing_spot_list.emplace_back(spot);
+  _region_query->addViolationSpot(spot);
 }
 
 void CutSpacingCheck::checkSpacing_TwoRect_PrlPos(DrcRect* target_rect, DrcRect* result_rect)
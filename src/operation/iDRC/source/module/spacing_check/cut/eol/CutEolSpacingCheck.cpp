@@ -485,7 +485,7 @@ void CutEolSpacingCheck::addSpot(DrcRect* target_rect, DrcRect* result_rect)
   spot->set_net_id(target_rect->get_net_id());
   spot->set_vio_type(ViolationType::kCutEOLSpacing);
   spot->setCoordinate(box.min_corner().x(), box.min_corner().y(), box.max_corner().x(), box.max_corner().y());
-  _region_query->_cut_eol_spacing_spot_list.emplace_back(spot);
+  _region_query->addViolationSpot(spot);
 }
 
 void CutEolSpacingCheck::checkSpacing1_TwoRect_PrlNeg(DrcRect* target_rect, DrcRect* result_rect, EdgeDirection edge_dir)
@@ -737,7 +737,7 @@ void RoutingSpacingCheck::addShortSpot(DrcRect* target_rect, DrcRect* result_rec
   spot->set_net_id(target_rect->get_net_id());
   spot->set_vio_type(ViolationType::kShort);
   spot->setCoordinate(box.min_corner().x(), box.min_corner().y(), box.max_corner().x(), box.max_corner().y());
-  _region_query->_short_vio_spot_list.emplace_back(spot);
+  _region_query->addViolationSpot(spot);
 }
 
 void RoutingSpacingCheck::addSpacingSpot(DrcRect* target_rect, DrcRect* result_rect)
@@ -750,7 +750,7 @@ void RoutingSpacingCheck::addSpacingSpot(DrcRect* target_rect, DrcRect* result_r
   spot->set_net_id(target_rect->get_net_id());
   spot->set_vio_type(ViolationType::kRoutingSpacing);
   spot->setCoordinate(box.min_corner().x(), box.min_corner().y(), box.max_corner().x(), box.max_corner().y());
-  _region_query->_prl_run_length_spacing_spot_list.emplace_back(spot);
+  _region_query->addViolationSpot(spot);
 }
 
 }  // namespace idrc
\ No newline at end of file
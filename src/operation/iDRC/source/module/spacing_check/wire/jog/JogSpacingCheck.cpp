@@ -297,7 +297,7 @@ void JogSpacingCheck::addSpot(DrcRect* trigger_rect, DrcRect* result_rect)
   spot->set_net_id(trigger_rect->get_net_id());
   spot->set_vio_type(ViolationType::kJogSpacing);
   spot->setCoordinate(box.min_corner().x(), box.min_corner().y(), box.max_corner().x(), box.max_corner().y());
-  _region_query->_metal_jog_spacing_spot_list.emplace_back(spot);
+  _region_query->addViolationSpot(spot);
 }
 
 void JogSpacingCheck::checkSpacing_Horizontal(DrcRect* intercept_result_rect, DrcRect* check_rect, DrcRect* rect,
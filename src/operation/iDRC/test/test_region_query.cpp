@@ -0,0 +1,160 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+/**
+ * @brief build and query time of RegionQuery rect R-trees, one by one insertion vs packing construction
+ * usage : test_region_query <tech_lef> <def> [lef...]   rects of a routed design loaded by DRC::initDRC
+ *         test_region_query                              synthetic routed wires on 4 layers
+ */
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BoostType.h"
+#include "DRC.h"
+#include "RegionQuery.h"
+#include "idm.h"
+
+using namespace idrc;
+
+using RectValue = std::pair<RTreeBox, DrcRect*>;
+using LayerToValueMap = std::map<int, std::vector<RectValue>>;
+
+double elapsedSeconds(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void collectTreeValue(LayerIdToRTreeMap& layer_to_tree_map, LayerToValueMap& layer_to_value_map)
+{
+  for (auto& [layer_id, rtree] : layer_to_tree_map) {
+    layer_to_value_map[layer_id].insert(layer_to_value_map[layer_id].end(), rtree.begin(), rtree.end());
+  }
+}
+
+/**
+ * @brief 按层生成布线后的线段，奇数层水平、偶数层竖直，每条track上随机长度的线段间隔排布
+ */
+void buildSyntheticValue(LayerToValueMap& layer_to_value_map, int layer_num, int die_size, int pitch, int width)
+{
+  std::mt19937 random_engine(2024);
+  std::uniform_int_distribution<int> length_dist(4 * pitch, 100 * pitch);
+  std::uniform_int_distribution<int> gap_dist(pitch, 20 * pitch);
+  for (int layer_id = 1; layer_id <= layer_num; ++layer_id) {
+    auto& value_list = layer_to_value_map[layer_id];
+    for (int track = pitch; track + width < die_size; track += pitch) {
+      int start = gap_dist(random_engine);
+      while (start < die_size) {
+        int end = std::min(start + length_dist(random_engine), die_size);
+        RTreeBox box = layer_id % 2 == 1 ? RTreeBox(RTreePoint(start, track), RTreePoint(end, track + width))
+                                         : RTreeBox(RTreePoint(track, start), RTreePoint(track + width, end));
+        value_list.emplace_back(box, reinterpret_cast<DrcRect*>(static_cast<uintptr_t>(value_list.size() + 1)));
+        start = end + gap_dist(random_engine);
+      }
+    }
+  }
+}
+
+/**
+ * @brief 每个矩形外扩spacing查询相交矩形，返回结果总数
+ */
+uint64_t queryTreeMap(LayerIdToRTreeMap& layer_to_tree_map, LayerToValueMap& layer_to_value_map, int spacing, int query_step)
+{
+  uint64_t result_num = 0;
+  std::vector<RectValue> result_list;
+  for (auto& [layer_id, value_list] : layer_to_value_map) {
+    auto& rtree = layer_to_tree_map[layer_id];
+    for (size_t i = 0; i < value_list.size(); i += query_step) {
+      auto& box = value_list[i].first;
+      RTreeBox query_box(RTreePoint(box.min_corner().x() - spacing, box.min_corner().y() - spacing),
+                         RTreePoint(box.max_corner().x() + spacing, box.max_corner().y() + spacing));
+      result_list.clear();
+      rtree.query(bgi::intersects(query_box), std::back_inserter(result_list));
+      result_num += result_list.size();
+    }
+  }
+  return result_num;
+}
+
+bool benchTreeMap(LayerToValueMap& layer_to_value_map, int spacing)
+{
+  size_t value_num = 0;
+  for (auto& [layer_id, value_list] : layer_to_value_map) {
+    value_num += value_list.size();
+  }
+  // 查询数量控制在约一百万次
+  int query_step = std::max<size_t>(1, value_num / 1000000);
+
+  auto start = std::chrono::steady_clock::now();
+  LayerIdToRTreeMap insert_tree_map;
+  for (auto& [layer_id, value_list] : layer_to_value_map) {
+    auto& rtree = insert_tree_map[layer_id];
+    for (auto& value : value_list) {
+      rtree.insert(value);
+    }
+  }
+  double insert_build_time = elapsedSeconds(start);
+
+  start = std::chrono::steady_clock::now();
+  LayerIdToRTreeMap pack_tree_map;
+  for (auto& [layer_id, value_list] : layer_to_value_map) {
+    pack_tree_map[layer_id] = RectRTree(value_list.begin(), value_list.end());
+  }
+  double pack_build_time = elapsedSeconds(start);
+
+  start = std::chrono::steady_clock::now();
+  uint64_t insert_result_num = queryTreeMap(insert_tree_map, layer_to_value_map, spacing, query_step);
+  double insert_query_time = elapsedSeconds(start);
+
+  start = std::chrono::steady_clock::now();
+  uint64_t pack_result_num = queryTreeMap(pack_tree_map, layer_to_value_map, spacing, query_step);
+  double pack_query_time = elapsedSeconds(start);
+
+  std::cout << "rects = " << value_num << " layers = " << layer_to_value_map.size()
+            << " queries = " << (value_num + query_step - 1) / query_step << std::endl;
+  std::cout << "insert : build = " << insert_build_time << "s query = " << insert_query_time << "s results = " << insert_result_num
+            << std::endl;
+  std::cout << "pack   : build = " << pack_build_time << "s query = " << pack_query_time << "s results = " << pack_result_num << std::endl;
+  return insert_result_num == pack_result_num;
+}
+
+int main(int argc, char* argv[])
+{
+  LayerToValueMap layer_to_value_map;
+  int spacing = 100;
+  if (argc >= 3) {
+    std::vector<std::string> lef_paths(argv + 3, argv + argc);
+    if (!dmInst->readLef(std::vector<std::string>{argv[1]}, true) || !dmInst->readLef(lef_paths) || !dmInst->readDef(argv[2])) {
+      std::cout << "[Error] Failed to read design!" << std::endl;
+      return 1;
+    }
+    DRC drc;
+    drc.initDRC();
+    auto* region_query = drc.get_region_query();
+    collectTreeValue(region_query->get_layer_to_routing_rects_tree_map(), layer_to_value_map);
+    collectTreeValue(region_query->get_layer_to_fixed_rects_tree_map(), layer_to_value_map);
+  } else {
+    buildSyntheticValue(layer_to_value_map, 4, 2000000, 200, 100);
+  }
+
+  bool pass = benchTreeMap(layer_to_value_map, spacing);
+  std::cout << "test_region_query " << (pass ? "passed" : "failed") << std::endl;
+  return pass ? 0 : 1;
+}
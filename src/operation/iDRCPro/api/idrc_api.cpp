@@ -17,6 +17,8 @@
 
 #include "idrc_api.h"
 
+#include <memory>
+
 #include "idm.h"
 #include "idrc.h"
 #include "idrc_config.h"
@@ -39,10 +41,22 @@ void DrcApi::exit()
   DrcTechRuleInst->destroyInst();
 }
 
+/**
+ * check DRC violation for shapes given by caller, e.g. RT
+ * all violations are returned, violation file and region cap are only used by sign-off check
+ */
 std::map<ViolationEnumType, std::vector<DrcViolation*>> DrcApi::check(std::vector<idb::IdbLayerShape*>& env_shape_list,
                                                                       std::map<int, std::vector<idb::IdbLayerShape*>>& pin_data,
                                                                       std::map<int, std::vector<idb::IdbRegularWireSegment*>>& routing_data,
                                                                       std::set<ViolationEnumType> check_select)
+{
+  return runCheck(env_shape_list, pin_data, routing_data, check_select, nullptr, 0, 0);
+}
+
+std::map<ViolationEnumType, std::vector<DrcViolation*>> DrcApi::runCheck(
+    std::vector<idb::IdbLayerShape*>& env_shape_list, std::map<int, std::vector<idb::IdbLayerShape*>>& pin_data,
+    std::map<int, std::vector<idb::IdbRegularWireSegment*>>& routing_data, std::set<ViolationEnumType> check_select,
+    DrcViolationSink* violation_sink, int max_violation_num, int violation_region_size)
 {
   DrcManager drc_manager;
 
@@ -55,6 +69,8 @@ std::map<ViolationEnumType, std::vector<DrcViolation*>> DrcApi::check(std::vecto
   }
 
   condition_manager->set_check_select(check_select);
+  violation_manager->set_region_cap(max_violation_num, violation_region_size);
+  violation_manager->set_sink(violation_sink);
 
   /// set drc rule stratagy by rt paramter
   /// tbd
@@ -107,18 +123,45 @@ std::map<ViolationEnumType, std::vector<DrcViolation*>> DrcApi::check(std::vecto
   }
 #endif
 
+#ifdef DEBUG_IDRC_API
+  if (violation_manager->get_dropped_violation_num() > 0) {
+    std::cout << "idrc : " << violation_manager->get_dropped_violation_num() << " violations dropped by region cap" << std::endl;
+  }
+#endif
+
   return violation_manager->get_violation_map();
 }
 /**
  * check DRC violation for DEF file
  * initialize data from idb
+ * violations are streamed to violation_file and the returned map is empty if violation_file is set
  */
 std::map<ViolationEnumType, std::vector<DrcViolation*>> DrcApi::checkDef()
 {
   std::vector<idb::IdbLayerShape*> env_shape_list;
   std::map<int, std::vector<idb::IdbLayerShape*>> pin_data;
   std::map<int, std::vector<idb::IdbRegularWireSegment*>> routing_data;
-  return check(env_shape_list, pin_data, routing_data);
+
+  std::unique_ptr<DrcViolationSink> violation_sink;
+  if (!DrcConfigInst->get_violation_file().empty()) {
+    violation_sink = std::make_unique<DrcViolationSink>(DrcConfigInst->get_violation_file());
+    if (!violation_sink->is_open()) {
+      std::cout << "[Error] Failed to open violation file '" << DrcConfigInst->get_violation_file() << "'!" << std::endl;
+      violation_sink.reset();
+    }
+  }
+
+  auto violation_map = runCheck(env_shape_list, pin_data, routing_data, {}, violation_sink.get(), DrcConfigInst->get_max_violation_num(),
+                                DrcConfigInst->get_violation_region_size());
+
+  if (violation_sink != nullptr) {
+    violation_sink->close();
+#ifdef DEBUG_IDRC_API
+    std::cout << "idrc : " << violation_sink->get_record_num() << " violations written to " << DrcConfigInst->get_violation_file()
+              << std::endl;
+#endif
+  }
+  return violation_map;
 }
 
 void plotGDS(std::string gds_file, std::map<int32_t, std::map<int32_t, std::vector<ieda_solver::GeometryRect>>>& layer_type_rect_list_map)
@@ -32,6 +32,7 @@ class IdbLayerShape;
 
 namespace idrc {
 class DrcManager;
+class DrcViolationSink;
 
 class DrcApi
 {
@@ -50,6 +51,14 @@ class DrcApi
   void diagnosis(std::string third_json_file, std::string idrc_json_file, std::string output_dir);
 
  private:
+  /**
+   * violation_sink : violations are written to sink and the returned map is empty if not nullptr
+   * max_violation_num, violation_region_size : region cap of violations, 0 means no limit
+   */
+  std::map<ViolationEnumType, std::vector<DrcViolation*>> runCheck(
+      std::vector<idb::IdbLayerShape*>& env_shape_list, std::map<int, std::vector<idb::IdbLayerShape*>>& pin_data,
+      std::map<int, std::vector<idb::IdbRegularWireSegment*>>& routing_data, std::set<ViolationEnumType> check_select,
+      DrcViolationSink* violation_sink, int max_violation_num, int violation_region_size);
 };
 
 }  // namespace idrc
\ No newline at end of file
@@ -0,0 +1,235 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+
+#include "idrc_session.h"
+
+#include "engine_init_rt.h"
+#include "idm.h"
+#include "idrc.h"
+#include "idrc_dm.h"
+
+namespace idrc {
+
+DrcSession::DrcSession(std::set<ViolationEnumType> check_select)
+{
+  _drc_manager = new DrcManager();
+  _drc_manager->get_condition_manager()->set_check_select(check_select);
+}
+
+DrcSession::~DrcSession()
+{
+  for (auto& [type, violation_list] : _violation_map) {
+    for (auto* violation : violation_list) {
+      delete violation;
+    }
+  }
+  _violation_map.clear();
+
+  if (_drc_manager != nullptr) {
+    delete _drc_manager;
+    _drc_manager = nullptr;
+  }
+}
+
+/**
+ * replace all environment shapes
+ */
+void DrcSession::setEnvShapes(std::vector<idb::IdbLayerShape*>& env_shape_list)
+{
+  std::vector<idb::IdbLayerShape*> pin_shape_list;
+  std::vector<idb::IdbRegularWireSegment*> segment_list;
+  removeNet(-1);
+  addData(-1, env_shape_list, pin_shape_list, segment_list);
+}
+
+/**
+ * replace all shapes of a net
+ */
+void DrcSession::updateNet(int net_id, std::vector<idb::IdbLayerShape*>& pin_shape_list,
+                           std::vector<idb::IdbRegularWireSegment*>& segment_list)
+{
+  std::vector<idb::IdbLayerShape*> env_shape_list;
+  removeNet(net_id);
+  addData(net_id, env_shape_list, pin_shape_list, segment_list);
+}
+
+void DrcSession::removeNet(int net_id)
+{
+  if (_net_ids.erase(net_id) == 0) {
+    return;
+  }
+  _drc_manager->get_engine()->get_engine_manager()->removeNet(net_id);
+}
+
+void DrcSession::addData(int net_id, std::vector<idb::IdbLayerShape*>& env_shape_list, std::vector<idb::IdbLayerShape*>& pin_shape_list,
+                         std::vector<idb::IdbRegularWireSegment*>& segment_list)
+{
+  std::map<int, std::vector<idb::IdbLayerShape*>> pin_data;
+  std::map<int, std::vector<idb::IdbRegularWireSegment*>> routing_data;
+  if (!pin_shape_list.empty()) {
+    pin_data[net_id] = pin_shape_list;
+  }
+  if (!segment_list.empty()) {
+    routing_data[net_id] = segment_list;
+  }
+
+  auto* data_manager = _drc_manager->get_data_manager();
+  data_manager->set_env_shapes(&env_shape_list);
+  data_manager->set_pin_data(&pin_data);
+  data_manager->set_routing_data(&routing_data);
+
+  auto* engine_manager = _drc_manager->get_engine()->get_engine_manager();
+  DrcEngineInitRT init_rt(engine_manager, data_manager);
+  init_rt.init();
+  engine_manager->commitNet(net_id);
+  _net_ids.insert(net_id);
+
+  data_manager->set_env_shapes(nullptr);
+  data_manager->set_pin_data(nullptr);
+  data_manager->set_routing_data(nullptr);
+}
+
+/**
+ * check the region changed since the last check, violations in the region are replaced by the new results,
+ * a violation reaching the window edge is clipped by the window, so it is matched with the old violations by overlap
+ */
+DrcSessionResult DrcSession::check()
+{
+  DrcSessionResult result;
+
+  auto checked_core_windows = _drc_manager->get_engine()->get_engine_manager()->filterDirtyData(_drc_manager->get_condition_manager());
+  auto new_violation_map = _drc_manager->get_violation_manager()->get_violation_map();
+
+  using ViolationKey = std::tuple<std::string, int, int, int, int>;
+  auto get_key = [](DrcViolation* violation) {
+    auto* violation_rect = static_cast<DrcViolationRect*>(violation);
+    return ViolationKey(violation->get_layer()->get_name(), violation_rect->get_llx(), violation_rect->get_lly(), violation_rect->get_urx(),
+                        violation_rect->get_ury());
+  };
+  auto get_rect = [](DrcViolation* violation) {
+    auto* violation_rect = static_cast<DrcViolationRect*>(violation);
+    return ieda_solver::GeometryRect(violation_rect->get_llx(), violation_rect->get_lly(), violation_rect->get_urx(),
+                                     violation_rect->get_ury());
+  };
+  auto is_in_checked_cores = [&](DrcViolation* violation) {
+    auto it = checked_core_windows.find(violation->get_layer()->get_name());
+    if (it == checked_core_windows.end()) {
+      return false;
+    }
+    auto rect = get_rect(violation);
+    for (auto& [core, window] : it->second) {
+      if (ieda_solver::gtl::intersects(core, rect, true)) {
+        return true;
+      }
+    }
+    return false;
+  };
+  auto is_on_window_edge = [&](DrcViolation* violation) {
+    auto it = checked_core_windows.find(violation->get_layer()->get_name());
+    if (it == checked_core_windows.end()) {
+      return false;
+    }
+    auto rect = get_rect(violation);
+    for (auto& [core, window] : it->second) {
+      if (ieda_solver::gtl::intersects(core, rect, true)
+          && (ieda_solver::lowLeftX(rect) <= ieda_solver::lowLeftX(window) || ieda_solver::lowLeftY(rect) <= ieda_solver::lowLeftY(window)
+              || ieda_solver::upRightX(rect) >= ieda_solver::upRightX(window)
+              || ieda_solver::upRightY(rect) >= ieda_solver::upRightY(window))) {
+        return true;
+      }
+    }
+    return false;
+  };
+  // polygon violations on the window edge are skipped by the window check, they can not be judged again
+  auto is_polygon_violation = [](ViolationEnumType type) {
+    return type == ViolationEnumType::kArea || type == ViolationEnumType::kAreaEnclosed || type == ViolationEnumType::kMinStep
+           || type == ViolationEnumType::kNotch;
+  };
+
+  for (int type_idx = (int) ViolationEnumType::kNone; type_idx < (int) ViolationEnumType::kMax; ++type_idx) {
+    auto type = (ViolationEnumType) type_idx;
+    auto& violation_list = _violation_map[type];
+
+    // old violations in checked cores are cleared unless they are found again
+    std::map<ViolationKey, DrcViolation*> checked_violations;
+    std::vector<std::pair<DrcViolation*, bool>> edge_violations;
+    std::vector<DrcViolation*> kept_violation_list;
+    for (auto* violation : violation_list) {
+      if (!is_in_checked_cores(violation)) {
+        kept_violation_list.push_back(violation);
+      } else if (is_on_window_edge(violation)) {
+        edge_violations.emplace_back(violation, false);
+      } else {
+        checked_violations[get_key(violation)] = violation;
+      }
+    }
+
+    std::set<ViolationKey> new_keys;
+    for (auto* violation : new_violation_map[type]) {
+      auto key = get_key(violation);
+      // overlapped windows may find the same violation
+      if (!new_keys.insert(key).second) {
+        delete violation;
+        continue;
+      }
+      auto it = checked_violations.find(key);
+      if (it != checked_violations.end()) {
+        it->second->set_net_ids(violation->get_net_ids());
+        kept_violation_list.push_back(it->second);
+        checked_violations.erase(it);
+        delete violation;
+        continue;
+      }
+      // the clipped part of an old violation crossing the window edge keeps the old one
+      bool is_matched = false;
+      if (is_on_window_edge(violation)) {
+        auto rect = get_rect(violation);
+        for (auto& [edge_violation, is_found] : edge_violations) {
+          if (edge_violation->get_layer() == violation->get_layer() && ieda_solver::gtl::intersects(get_rect(edge_violation), rect, true)) {
+            is_found = true;
+            is_matched = true;
+          }
+        }
+      }
+      if (is_matched) {
+        delete violation;
+      } else {
+        kept_violation_list.push_back(violation);
+        result.new_violation_map[type].push_back(violation);
+      }
+    }
+    for (auto& [key, violation] : checked_violations) {
+      result.cleared_violation_map[type].push_back(violation);
+    }
+    for (auto& [edge_violation, is_found] : edge_violations) {
+      if (is_found || is_polygon_violation(type)) {
+        kept_violation_list.push_back(edge_violation);
+      } else {
+        result.cleared_violation_map[type].push_back(edge_violation);
+      }
+    }
+
+    violation_list = std::move(kept_violation_list);
+    if (violation_list.empty()) {
+      _violation_map.erase(type);
+    }
+  }
+
+  return result;
+}
+
+}  // namespace idrc
@@ -0,0 +1,75 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#pragma once
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "DRCViolationType.h"
+#include "idrc_violation.h"
+
+namespace idb {
+class IdbRegularWireSegment;
+class IdbLayerShape;
+}  // namespace idb
+
+namespace idrc {
+class DrcManager;
+
+struct DrcSessionResult
+{
+  /**
+   * new_violation_map : violations found by this check, owned by session
+   * cleared_violation_map : violations disappeared since the last check, owned by caller
+   */
+  std::map<ViolationEnumType, std::vector<DrcViolation*>> new_violation_map;
+  std::map<ViolationEnumType, std::vector<DrcViolation*>> cleared_violation_map;
+};
+
+/**
+ *  DrcSession definition : keep layouts of all nets between checks, only the region changed since the last check is checked again,
+ *  DrcApi::init must be called before the session is used
+ */
+class DrcSession
+{
+ public:
+  DrcSession(std::set<ViolationEnumType> check_select = {});
+  ~DrcSession();
+
+  void setEnvShapes(std::vector<idb::IdbLayerShape*>& env_shape_list);
+  void updateNet(int net_id, std::vector<idb::IdbLayerShape*>& pin_shape_list, std::vector<idb::IdbRegularWireSegment*>& segment_list);
+  void removeNet(int net_id);
+  DrcSessionResult check();
+
+  std::map<ViolationEnumType, std::vector<DrcViolation*>>& get_violation_map() { return _violation_map; }
+
+ private:
+  DrcManager* _drc_manager = nullptr;
+  /**
+   * _net_ids : nets in session, -1 is environment
+   * _violation_map : all violations after the last check
+   */
+  std::set<int> _net_ids;
+  std::map<ViolationEnumType, std::vector<DrcViolation*>> _violation_map;
+
+  void addData(int net_id, std::vector<idb::IdbLayerShape*>& env_shape_list, std::vector<idb::IdbLayerShape*>& pin_shape_list,
+               std::vector<idb::IdbRegularWireSegment*>& segment_list);
+};
+
+}  // namespace idrc
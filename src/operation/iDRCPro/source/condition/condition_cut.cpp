@@ -0,0 +1,295 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+
+#include "condition_manager.h"
+#include "engine_layout.h"
+#include "idm.h"
+
+namespace idrc {
+
+/**
+ * @brief check cut spacing, cut eol spacing and enclosure in one sweep along x direction, cuts and max rectangles of the adjacent
+ * metal layers are sorted by low left x, when a cut is swept, all metal rectangles enclosing it and all cuts before it within the max
+ * spacing are kept in the active sets
+ * @param layer : cut layer
+ * @param layout : cut layout
+ * @param below_layout : routing layout below the cut layer, nullptr if not exist
+ * @param above_layout : routing layout above the cut layer, nullptr if not exist
+ */
+void DrcConditionManager::checkCut(std::string layer, DrcEngineLayout* layout, DrcEngineLayout* below_layout,
+                                   DrcEngineLayout* above_layout)
+{
+  ieda::Stats states;
+  int cut_spacing_count = 0;
+  int cut_eol_count = 0;
+  int enclosure_count = 0;
+
+  // cut spacing
+  int rule_cut_spacing = 0;
+  if (_check_select.find(ViolationEnumType::kCutSpacing) != _check_select.end()) {
+    rule_cut_spacing = std::max(DrcTechRuleInst->getCutSpacing(layer), 0);
+  }
+
+  // cut eol spacing, triggered by the eol edge of above metal
+  auto rule_cut_eol = DrcTechRuleInst->getCutEolSpacing(layer);
+  if (_check_select.find(ViolationEnumType::kCutEOLSpacing) == _check_select.end() || above_layout == nullptr) {
+    rule_cut_eol = nullptr;
+  }
+  int rule_eol_spacing1 = 0;
+  int rule_eol_spacing2 = 0;
+  if (rule_cut_eol) {
+    auto& to_classes = rule_cut_eol->get_to_classes();
+    rule_eol_spacing1 = to_classes.empty() ? rule_cut_eol->get_cut_spacing1() : to_classes[0].get_cut_spacing1();
+    rule_eol_spacing2 = to_classes.empty() ? rule_cut_eol->get_cut_spacing2() : to_classes[0].get_cut_spacing2();
+  }
+
+  // enclosure
+  IdbLayerCutEnclosure* rule_enclosure_below = nullptr;
+  IdbLayerCutEnclosure* rule_enclosure_above = nullptr;
+  if (_check_select.find(ViolationEnumType::kEnclosure) != _check_select.end()) {
+    rule_enclosure_below = below_layout ? DrcTechRuleInst->getCutEnclosure(layer, false) : nullptr;
+    rule_enclosure_above = above_layout ? DrcTechRuleInst->getCutEnclosure(layer, true) : nullptr;
+  }
+
+  int max_spacing = std::max({rule_cut_spacing, rule_eol_spacing1, rule_eol_spacing2});
+  bool need_below_metal = rule_enclosure_below != nullptr;
+  bool need_above_metal = rule_enclosure_above != nullptr || rule_cut_eol != nullptr;
+  if (max_spacing <= 0 && !need_below_metal && !need_above_metal) {
+    return;
+  }
+
+  // eol edge of cut, bit order : west, east, south, north
+  enum EolEdge : unsigned
+  {
+    kWest = 0b0001,
+    kEast = 0b0010,
+    kSouth = 0b0100,
+    kNorth = 0b1000
+  };
+  struct CutItem
+  {
+    ieda_solver::GeometryRect rect;
+    int net_id;
+    unsigned eol_edges;
+  };
+  // active rectangles sorted by low left y, wide ones and tall ones are kept separately to limit the query range
+  struct ActiveRects
+  {
+    std::multimap<int, int> low_y_map;
+    int max_height = 0;
+  };
+
+  std::vector<CutItem> cuts;
+  for (auto& [net_id, sub_layout] : layout->get_sub_layouts()) {
+    for (auto& rect : sub_layout->get_engine()->getRects()) {
+      cuts.push_back(CutItem{rect, net_id, 0});
+    }
+  }
+  std::vector<ieda_solver::GeometryRect> empty_rects;
+  auto& below_rects = need_below_metal ? below_layout->get_layout()->get_engine()->getWires() : empty_rects;
+  auto& above_rects = need_above_metal ? above_layout->get_layout()->get_engine()->getWires() : empty_rects;
+
+  // sweep items : low left x, item type (0 below metal, 1 above metal, 2 cut), index, metal goes first if x is equal
+  std::vector<std::tuple<int, int, int>> sweep_items;
+  sweep_items.reserve(cuts.size() + below_rects.size() + above_rects.size());
+  for (size_t i = 0; i < below_rects.size(); ++i) {
+    sweep_items.emplace_back(ieda_solver::lowLeftX(below_rects[i]), 0, i);
+  }
+  for (size_t i = 0; i < above_rects.size(); ++i) {
+    sweep_items.emplace_back(ieda_solver::lowLeftX(above_rects[i]), 1, i);
+  }
+  for (size_t i = 0; i < cuts.size(); ++i) {
+    sweep_items.emplace_back(ieda_solver::lowLeftX(cuts[i].rect), 2, i);
+  }
+  std::sort(sweep_items.begin(), sweep_items.end());
+
+  auto get_height = [](ieda_solver::GeometryRect& rect) { return ieda_solver::upRightY(rect) - ieda_solver::lowLeftY(rect); };
+  auto get_width = [](ieda_solver::GeometryRect& rect) { return ieda_solver::upRightX(rect) - ieda_solver::lowLeftX(rect); };
+  auto insert_active = [&](ActiveRects& active_rects, ieda_solver::GeometryRect& rect, int index) {
+    active_rects.low_y_map.emplace(ieda_solver::lowLeftY(rect), index);
+    active_rects.max_height = std::max(active_rects.max_height, get_height(rect));
+  };
+
+  // metal rectangles enclosing the cut, expired metal rectangles are removed while querying
+  std::vector<ieda_solver::GeometryRect*> enclosing_metals;
+  auto query_enclosing_metals = [&](std::vector<ActiveRects>& active_metals, std::vector<ieda_solver::GeometryRect>& metal_rects,
+                                    ieda_solver::GeometryRect& cut_rect) {
+    enclosing_metals.clear();
+    for (auto& active_rects : active_metals) {
+      auto it = active_rects.low_y_map.lower_bound(ieda_solver::lowLeftY(cut_rect) - active_rects.max_height);
+      auto it_end = active_rects.low_y_map.upper_bound(ieda_solver::lowLeftY(cut_rect));
+      while (it != it_end) {
+        auto& metal_rect = metal_rects[it->second];
+        if (ieda_solver::upRightX(metal_rect) < ieda_solver::lowLeftX(cut_rect)) {
+          it = active_rects.low_y_map.erase(it);
+          continue;
+        }
+        if (ieda_solver::gtl::contains(metal_rect, cut_rect)) {
+          enclosing_metals.push_back(&metal_rect);
+        }
+        ++it;
+      }
+    }
+  };
+
+  auto is_enclosure_met = [&](IdbLayerCutEnclosure* rule_enclosure, ieda_solver::GeometryRect& cut_rect) {
+    for (auto* metal_rect : enclosing_metals) {
+      int overhang_x = std::min(ieda_solver::lowLeftX(cut_rect) - ieda_solver::lowLeftX(*metal_rect),
+                                ieda_solver::upRightX(*metal_rect) - ieda_solver::upRightX(cut_rect));
+      int overhang_y = std::min(ieda_solver::lowLeftY(cut_rect) - ieda_solver::lowLeftY(*metal_rect),
+                                ieda_solver::upRightY(*metal_rect) - ieda_solver::upRightY(cut_rect));
+      int overhang_1 = rule_enclosure->get_overhang_1();
+      int overhang_2 = rule_enclosure->get_overhang_2();
+      if ((overhang_x >= overhang_1 && overhang_y >= overhang_2) || (overhang_x >= overhang_2 && overhang_y >= overhang_1)) {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  // the edge is eol only if all enclosing metal rectangles end near it with a narrow end
+  auto get_eol_edges = [&](ieda_solver::GeometryRect& cut_rect) {
+    if (enclosing_metals.empty()) {
+      return 0u;
+    }
+    unsigned eol_edges = kWest | kEast | kSouth | kNorth;
+    int rule_eol_width = rule_cut_eol->get_eol_width();
+    int rule_smaller_overhang = rule_cut_eol->get_smaller_overhang();
+    for (auto* metal_rect : enclosing_metals) {
+      int width_x = get_width(*metal_rect);
+      int width_y = get_height(*metal_rect);
+      if (width_y >= rule_eol_width || ieda_solver::lowLeftX(cut_rect) - ieda_solver::lowLeftX(*metal_rect) >= rule_smaller_overhang) {
+        eol_edges &= ~kWest;
+      }
+      if (width_y >= rule_eol_width || ieda_solver::upRightX(*metal_rect) - ieda_solver::upRightX(cut_rect) >= rule_smaller_overhang) {
+        eol_edges &= ~kEast;
+      }
+      if (width_x >= rule_eol_width || ieda_solver::lowLeftY(cut_rect) - ieda_solver::lowLeftY(*metal_rect) >= rule_smaller_overhang) {
+        eol_edges &= ~kSouth;
+      }
+      if (width_x >= rule_eol_width || ieda_solver::upRightY(*metal_rect) - ieda_solver::upRightY(cut_rect) >= rule_smaller_overhang) {
+        eol_edges &= ~kNorth;
+      }
+    }
+    return eol_edges;
+  };
+
+  // check current cut with the cut swept before
+  auto check_cut_pair = [&](CutItem& cut_prev, CutItem& cut_current) {
+    auto& rect_prev = cut_prev.rect;
+    auto& rect_current = cut_current.rect;
+    long long distance_x = std::max({0, ieda_solver::lowLeftX(rect_current) - ieda_solver::upRightX(rect_prev),
+                                      ieda_solver::lowLeftX(rect_prev) - ieda_solver::upRightX(rect_current)});
+    long long distance_y = std::max({0, ieda_solver::lowLeftY(rect_current) - ieda_solver::upRightY(rect_prev),
+                                      ieda_solver::lowLeftY(rect_prev) - ieda_solver::upRightY(rect_current)});
+    if (distance_x == 0 && distance_y == 0) {
+      return;
+    }
+    long long distance_square = distance_x * distance_x + distance_y * distance_y;
+
+    auto vio_rect = rect_prev;
+    ieda_solver::oppositeRegion(vio_rect, rect_current);
+    if (distance_square < (long long) rule_cut_spacing * rule_cut_spacing) {
+      addViolation(vio_rect, layer, ViolationEnumType::kCutSpacing, {cut_prev.net_id, cut_current.net_id});
+      ++cut_spacing_count;
+      return;
+    }
+
+    if (rule_cut_eol) {
+      // eol edges facing each other
+      unsigned eol_edges_prev = 0;
+      unsigned eol_edges_current = 0;
+      if (ieda_solver::lowLeftX(rect_current) >= ieda_solver::upRightX(rect_prev)) {
+        eol_edges_prev |= kEast;
+        eol_edges_current |= kWest;
+      }
+      if (ieda_solver::lowLeftY(rect_current) >= ieda_solver::upRightY(rect_prev)) {
+        eol_edges_prev |= kNorth;
+        eol_edges_current |= kSouth;
+      } else if (ieda_solver::lowLeftY(rect_prev) >= ieda_solver::upRightY(rect_current)) {
+        eol_edges_prev |= kSouth;
+        eol_edges_current |= kNorth;
+      }
+      unsigned triggered_edges = (cut_prev.eol_edges & eol_edges_prev) | (cut_current.eol_edges & eol_edges_current);
+      if (triggered_edges) {
+        auto get_prl = [](int low_1, int high_1, int low_2, int high_2) { return std::min(high_1, high_2) - std::max(low_1, low_2); };
+        int prl = (triggered_edges & (kWest | kEast))
+                      ? get_prl(ieda_solver::lowLeftY(rect_prev), ieda_solver::upRightY(rect_prev), ieda_solver::lowLeftY(rect_current),
+                                ieda_solver::upRightY(rect_current))
+                      : get_prl(ieda_solver::lowLeftX(rect_prev), ieda_solver::upRightX(rect_prev), ieda_solver::lowLeftX(rect_current),
+                                ieda_solver::upRightX(rect_current));
+        int rule_eol_spacing = prl > rule_cut_eol->get_prl() ? rule_eol_spacing1 : rule_eol_spacing2;
+        if (distance_square < (long long) rule_eol_spacing * rule_eol_spacing) {
+          addViolation(vio_rect, layer, ViolationEnumType::kCutEOLSpacing, {cut_prev.net_id, cut_current.net_id});
+          ++cut_eol_count;
+        }
+      }
+    }
+  };
+
+  std::vector<ActiveRects> active_below_metals(2);
+  std::vector<ActiveRects> active_above_metals(2);
+  ActiveRects active_cuts;
+  for (auto& [x, item_type, index] : sweep_items) {
+    if (item_type == 0 || item_type == 1) {
+      auto& metal_rect = item_type == 0 ? below_rects[index] : above_rects[index];
+      auto& active_metals = item_type == 0 ? active_below_metals : active_above_metals;
+      insert_active(active_metals[get_height(metal_rect) <= get_width(metal_rect) ? 0 : 1], metal_rect, index);
+      continue;
+    }
+
+    auto& cut = cuts[index];
+    if (need_below_metal) {
+      query_enclosing_metals(active_below_metals, below_rects, cut.rect);
+      if (!is_enclosure_met(rule_enclosure_below, cut.rect)) {
+        addViolation(cut.rect, layer, ViolationEnumType::kEnclosure, {cut.net_id});
+        ++enclosure_count;
+      }
+    }
+    if (need_above_metal) {
+      query_enclosing_metals(active_above_metals, above_rects, cut.rect);
+      if (rule_enclosure_above && !is_enclosure_met(rule_enclosure_above, cut.rect)) {
+        addViolation(cut.rect, layer, ViolationEnumType::kEnclosure, {cut.net_id});
+        ++enclosure_count;
+      }
+      if (rule_cut_eol) {
+        cut.eol_edges = get_eol_edges(cut.rect);
+      }
+    }
+
+    if (max_spacing > 0) {
+      auto it = active_cuts.low_y_map.lower_bound(ieda_solver::lowLeftY(cut.rect) - max_spacing - active_cuts.max_height);
+      auto it_end = active_cuts.low_y_map.upper_bound(ieda_solver::upRightY(cut.rect) + max_spacing);
+      while (it != it_end) {
+        auto& cut_prev = cuts[it->second];
+        if (ieda_solver::upRightX(cut_prev.rect) + max_spacing <= ieda_solver::lowLeftX(cut.rect)) {
+          it = active_cuts.low_y_map.erase(it);
+          continue;
+        }
+        check_cut_pair(cut_prev, cut);
+        ++it;
+      }
+      insert_active(active_cuts, cut.rect, index);
+    }
+  }
+
+  DEBUGOUTPUT(DEBUGHIGHLIGHT("Cut Spacing:\t") << cut_spacing_count << "\tcut eol = " << cut_eol_count << "\tenclosure = "
+                                               << enclosure_count << "\ttime = " << states.elapsedRunTime()
+                                               << "\tmemory = " << states.memoryDelta());
+}
+
+}  // namespace idrc
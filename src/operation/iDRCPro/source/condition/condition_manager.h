@@ -70,6 +70,7 @@ class DrcConditionManager
   ~DrcConditionManager() {}
 
   DrcViolationManager* get_violation_manager() { return _violation_manager; }
+  std::set<ViolationEnumType>& get_check_select() { return _check_select; }
 
   void set_check_select(std::set<ViolationEnumType> check_select)
   {
@@ -86,6 +87,7 @@ class DrcConditionManager
   void checkMinSpacing(std::string layer, DrcEngineLayout* layout);
   void checkWires(std::string layer, DrcEngineLayout* layout);
   void checkPolygons(std::string layer, DrcEngineLayout* layout);
+  void checkCut(std::string layer, DrcEngineLayout* layout, DrcEngineLayout* below_layout, DrcEngineLayout* above_layout);
 
  private:
   DrcViolationManager* _violation_manager;
@@ -17,8 +17,53 @@
 
 #include "idrc_config.h"
 
+#include <fstream>
+#include <iostream>
+
+#include "json/json.hpp"
+
 namespace idrc {
 
 DrcConfig* DrcConfig::_instance = nullptr;
 
+/**
+ * read the PARAMETER section of drc json config, values not in config are kept
+ * @param path : drc json config path, empty path keeps the current config
+ */
+void DrcConfig::init(std::string path)
+{
+  if (path.empty()) {
+    return;
+  }
+
+  std::ifstream config_stream(path);
+  if (!config_stream.is_open()) {
+    std::cout << "[Error] Failed to open drc config '" << path << "'!" << std::endl;
+    return;
+  }
+  nlohmann::json json = nlohmann::json::parse(config_stream, nullptr, false);
+  config_stream.close();
+  if (json.is_discarded()) {
+    std::cout << "[Error] Failed to parse drc config '" << path << "'!" << std::endl;
+    return;
+  }
+  if (!json.contains("PARAMETER")) {
+    return;
+  }
+
+  auto& parameter = json["PARAMETER"];
+  auto read_int = [&](const std::string& key, int& value) {
+    if (parameter.contains(key) && parameter[key].is_number_integer()) {
+      value = parameter[key].get<int>();
+    }
+  };
+  read_int("tile_size", _tile_size);
+  read_int("thread_number", _thread_number);
+  read_int("max_violation_num", _max_violation_num);
+  read_int("violation_region_size", _violation_region_size);
+  if (parameter.contains("violation_file") && parameter["violation_file"].is_string()) {
+    _violation_file = parameter["violation_file"].get<std::string>();
+  }
+}
+
 }
\ No newline at end of file
@@ -34,16 +34,44 @@ class DrcConfig
     return _instance;
   }
 
-  void init(std::string path) {}
+  void init(std::string path);
 
   DrcStratagyType get_stratagy_type() { return _stratagy_type; }
 
   void set_stratagy_type(DrcStratagyType stratagy_type) { _stratagy_type = stratagy_type; }
 
+  int get_tile_size() { return _tile_size; }
+  int get_thread_number() { return _thread_number; }
+
+  void set_tile_size(int tile_size) { _tile_size = tile_size; }
+  void set_thread_number(int thread_number) { _thread_number = thread_number; }
+
+  std::string get_violation_file() { return _violation_file; }
+  int get_max_violation_num() { return _max_violation_num; }
+  int get_violation_region_size() { return _violation_region_size; }
+
+  void set_violation_file(std::string violation_file) { _violation_file = violation_file; }
+  void set_max_violation_num(int max_violation_num) { _max_violation_num = max_violation_num; }
+  void set_violation_region_size(int violation_region_size) { _violation_region_size = violation_region_size; }
+
  private:
   static DrcConfig* _instance;
 
   DrcStratagyType _stratagy_type = DrcStratagyType::kCheckComplete;
+  /**
+   * _tile_size : tile core size in dbu for layout filtering, 0 means checking the whole layer at once
+   * _thread_number : thread number for tiled filtering
+   */
+  int _tile_size = 0;
+  int _thread_number = 1;
+  /**
+   * _violation_file : violations of checkDef are streamed to this file instead of returned if not empty
+   * _max_violation_num : max violation num of one type in one region for checkDef, 0 means no limit
+   * _violation_region_size : region size in dbu for _max_violation_num, 0 means the whole layer
+   */
+  std::string _violation_file = "";
+  int _max_violation_num = 0;
+  int _violation_region_size = 0;
 
   DrcConfig() {}
   ~DrcConfig() {}
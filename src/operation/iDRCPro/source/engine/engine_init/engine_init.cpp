@@ -29,12 +29,21 @@
 
 namespace idrc {
 
+void DrcEngineInit::addRect(int llx, int lly, int urx, int ury, idb::IdbLayer* layer, int net_id, LayoutType type)
+{
+  if (_shape_map != nullptr) {
+    (*_shape_map)[std::make_pair(layer, type)].push_back(DrcEngineRect{net_id, llx, lly, urx, ury});
+    return;
+  }
+  _engine_manager->addRect(llx, lly, urx, ury, layer->get_name(), net_id, type);
+}
+
 /**
  * build geometry data from rect
  */
 void DrcEngineInit::initDataFromRect(idb::IdbRect* rect, LayoutType type, idb::IdbLayer* layer, int net_id)
 {
-  _engine_manager->addRect(rect->get_low_x(), rect->get_low_y(), rect->get_high_x(), rect->get_high_y(), layer->get_name(), net_id, type);
+  addRect(rect->get_low_x(), rect->get_low_y(), rect->get_high_x(), rect->get_high_y(), layer, net_id, type);
 }
 
 /**
@@ -84,7 +93,7 @@ void DrcEngineInit::initDataFromPoints(idb::IdbCoordinate<int>* point_1, idb::Id
   }
 
   auto type = layer->is_routing() ? LayoutType::kRouting : LayoutType::kCut;
-  _engine_manager->addRect(llx, lly, urx, ury, layer->get_name(), net_id, type);
+  addRect(llx, lly, urx, ury, layer, net_id, type);
 }
 
 /**
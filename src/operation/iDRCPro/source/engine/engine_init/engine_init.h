@@ -18,6 +18,10 @@
 
 #include <stdint.h>
 
+#include <map>
+#include <utility>
+#include <vector>
+
 /**
  * check geometry overlap method
  */
@@ -40,6 +44,19 @@ class DrcEngineManager;
 class DrcDataManager;
 enum class LayoutType;
 
+/**
+ * shapes collected before building layouts, grouped by layer and layout type
+ */
+struct DrcEngineRect
+{
+  int net_id;
+  int llx;
+  int lly;
+  int urx;
+  int ury;
+};
+using DrcEngineShapeMap = std::map<std::pair<idb::IdbLayer*, LayoutType>, std::vector<DrcEngineRect>>;
+
 class DrcEngineInit
 {
  public:
@@ -54,7 +71,12 @@ class DrcEngineInit
  protected:
   DrcEngineManager* _engine_manager = nullptr;
   DrcDataManager* _data_manager = nullptr;
+  /**
+   * _shape_map : if not null, shapes are collected to it instead of added to engine manager
+   */
+  DrcEngineShapeMap* _shape_map = nullptr;
 
+  void addRect(int llx, int lly, int urx, int ury, idb::IdbLayer* layer, int net_id, LayoutType type);
   void initDataFromShape(idb::IdbLayerShape* idb_shape, int net_id = -1);
   void initDataFromPoints(idb::IdbCoordinate<int>* point_1, idb::IdbCoordinate<int>* point_2, int routing_width, idb::IdbLayer* layer,
                           int net_id = -1, bool b_pdn = false);
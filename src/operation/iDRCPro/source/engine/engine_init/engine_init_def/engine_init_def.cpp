@@ -17,6 +17,8 @@
 
 #include "engine_init_def.h"
 
+#include <algorithm>
+
 #include "IdbGeometry.h"
 #include "IdbLayer.h"
 #include "IdbLayerShape.h"
@@ -25,18 +27,28 @@
 #include "IdbSpecialNet.h"
 #include "IdbSpecialWire.h"
 #include "idm.h"
+#include "idrc_config.h"
 #include "idrc_engine_manager.h"
+#include "omp.h"
 
 namespace idrc {
 /**
- *  top flow to init all def data to geometry data
+ *  top flow to init all def data to geometry data,
+ *  shapes are collected by thread and built into layouts layer by layer
  */
 void DrcEngineInitDef::init()
 {
+  std::vector<DrcEngineShapeMap> shape_map_list(std::max(DrcConfigInst->get_thread_number(), 1));
+
+  _shape_map = &shape_map_list[0];
   initDataFromIOPins();
-  initDataFromInstances();
   initDataFromPDN();
-  initDataFromNets();
+  _shape_map = nullptr;
+
+  initDataFromInstances(shape_map_list);
+  initDataFromNets(shape_map_list);
+
+  buildLayouts(shape_map_list);
 }
 
 void DrcEngineInitDef::initDataFromIOPins()
@@ -51,7 +63,7 @@ void DrcEngineInitDef::initDataFromIOPins()
   }
 }
 
-void DrcEngineInitDef::initDataFromInstances()
+void DrcEngineInitDef::initDataFromInstances(std::vector<DrcEngineShapeMap>& shape_map_list)
 {
 #ifdef DEBUG_IDRC_ENGINE_INIT
   std::cout << "idrc : begin init data from instances" << std::endl;
@@ -61,21 +73,29 @@ void DrcEngineInitDef::initDataFromInstances()
   auto* idb_design = dmInst->get_idb_design();
 
   uint64_t number = 0;
-  for (IdbInstance* idb_inst : idb_design->get_instance_list()->get_instance_list()) {
-    if (idb_inst == nullptr || idb_inst->get_cell_master() == nullptr) {
-      continue;
-    }
-    /// instance pins
-    for (auto* idb_pin : idb_inst->get_pin_list()->get_pin_list()) {
-      initDataFromPin(idb_pin);
-    }
+  auto& idb_inst_list = idb_design->get_instance_list()->get_instance_list();
+#pragma omp parallel num_threads(shape_map_list.size())
+  {
+    DrcEngineInitDef thread_init(_engine_manager);
+    thread_init._shape_map = &shape_map_list[omp_get_thread_num()];
+#pragma omp for schedule(dynamic, 64) reduction(+ : number)
+    for (size_t i = 0; i < idb_inst_list.size(); ++i) {
+      IdbInstance* idb_inst = idb_inst_list[i];
+      if (idb_inst == nullptr || idb_inst->get_cell_master() == nullptr) {
+        continue;
+      }
+      /// instance pins
+      for (auto* idb_pin : idb_inst->get_pin_list()->get_pin_list()) {
+        thread_init.initDataFromPin(idb_pin);
+      }
 
-    /// obs
-    for (auto* idb_obs : idb_inst->get_obs_box_list()) {
-      initDataFromShape(idb_obs, NET_ID_OBS);
-    }
+      /// obs
+      for (auto* idb_obs : idb_inst->get_obs_box_list()) {
+        thread_init.initDataFromShape(idb_obs, NET_ID_OBS);
+      }
 
-    number++;
+      number++;
+    }
   }
 
 #ifdef DEBUG_IDRC_ENGINE_INIT
@@ -131,7 +151,7 @@ void DrcEngineInitDef::initDataFromPDN()
  * the basic geometry unit is construct independently by layer id and net id,
  * so it enable to read net parallelly
  */
-void DrcEngineInitDef::initDataFromNets()
+void DrcEngineInitDef::initDataFromNets(std::vector<DrcEngineShapeMap>& shape_map_list)
 {
 #ifdef DEBUG_IDRC_ENGINE_INIT
   std::cout << "idrc : begin init data from nets" << std::endl;
@@ -141,8 +161,15 @@ void DrcEngineInitDef::initDataFromNets()
 
   auto* idb_design = dmInst->get_idb_design();
 
-  for (auto* idb_net : idb_design->get_net_list()->get_net_list()) {
-    initDataFromNet(idb_net);
+  auto& idb_net_list = idb_design->get_net_list()->get_net_list();
+#pragma omp parallel num_threads(shape_map_list.size())
+  {
+    DrcEngineInitDef thread_init(_engine_manager);
+    thread_init._shape_map = &shape_map_list[omp_get_thread_num()];
+#pragma omp for schedule(dynamic, 64)
+    for (size_t i = 0; i < idb_net_list.size(); ++i) {
+      thread_init.initDataFromNet(idb_net_list[i]);
+    }
   }
 
 #ifdef DEBUG_IDRC_ENGINE_INIT
@@ -151,4 +178,57 @@ void DrcEngineInitDef::initDataFromNets()
 #endif
 }
 
+/**
+ * layouts are independent between layers, so each layer is built by one thread,
+ * rects are sorted by net id and inserted into net polyset as a whole
+ */
+void DrcEngineInitDef::buildLayouts(std::vector<DrcEngineShapeMap>& shape_map_list)
+{
+#ifdef DEBUG_IDRC_ENGINE_INIT
+  std::cout << "idrc : begin build layouts" << std::endl;
+  ieda::Stats stats;
+#endif
+
+  /// layouts are created in serial
+  std::map<std::pair<idb::IdbLayer*, LayoutType>, std::vector<std::vector<DrcEngineRect>*>> layer_rect_list_map;
+  for (auto& shape_map : shape_map_list) {
+    for (auto& [layer_type, rect_list] : shape_map) {
+      layer_rect_list_map[layer_type].push_back(&rect_list);
+    }
+  }
+  std::vector<std::pair<DrcEngineLayout*, std::vector<std::vector<DrcEngineRect>*>*>> layout_list;
+  for (auto& [layer_type, rect_list_list] : layer_rect_list_map) {
+    auto* layout = _engine_manager->get_layout(layer_type.first->get_name(), layer_type.second);
+    layout_list.emplace_back(layout, &rect_list_list);
+  }
+
+#pragma omp parallel for schedule(dynamic) num_threads(shape_map_list.size())
+  for (size_t i = 0; i < layout_list.size(); ++i) {
+    auto& [layout, rect_list_list] = layout_list[i];
+    std::vector<DrcEngineRect> layer_rect_list;
+    for (auto* rect_list : *rect_list_list) {
+      layer_rect_list.insert(layer_rect_list.end(), rect_list->begin(), rect_list->end());
+      std::vector<DrcEngineRect>().swap(*rect_list);
+    }
+    std::sort(layer_rect_list.begin(), layer_rect_list.end(),
+              [](const DrcEngineRect& a, const DrcEngineRect& b) { return a.net_id < b.net_id; });
+
+    std::vector<ieda_solver::GeometryRect> net_rect_list;
+    for (size_t begin = 0, end = 0; begin < layer_rect_list.size(); begin = end) {
+      int net_id = layer_rect_list[begin].net_id;
+      net_rect_list.clear();
+      for (end = begin; end < layer_rect_list.size() && layer_rect_list[end].net_id == net_id; ++end) {
+        auto& rect = layer_rect_list[end];
+        net_rect_list.emplace_back(rect.llx, rect.lly, rect.urx, rect.ury);
+      }
+      layout->get_net_engine(net_id)->get_polyset().insert(net_rect_list.begin(), net_rect_list.end());
+    }
+  }
+
+#ifdef DEBUG_IDRC_ENGINE_INIT
+  std::cout << "idrc : end build layouts, layout number = " << layout_list.size() << " runtime = " << stats.elapsedRunTime()
+            << " memory = " << stats.memoryDelta() << std::endl;
+#endif
+}
+
 }  // namespace idrc
\ No newline at end of file
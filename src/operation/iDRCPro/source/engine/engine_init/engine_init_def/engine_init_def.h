@@ -18,6 +18,8 @@
 
 #include <stdint.h>
 
+#include <vector>
+
 #include "engine_init.h"
 
 /**
@@ -54,9 +56,10 @@ class DrcEngineInitDef : DrcEngineInit
 
  private:
   void initDataFromIOPins();
-  void initDataFromInstances();
+  void initDataFromInstances(std::vector<DrcEngineShapeMap>& shape_map_list);
   void initDataFromPDN();
-  void initDataFromNets();
+  void initDataFromNets(std::vector<DrcEngineShapeMap>& shape_map_list);
+  void buildLayouts(std::vector<DrcEngineShapeMap>& shape_map_list);
 };
 
 }  // namespace idrc
\ No newline at end of file
@@ -57,6 +57,17 @@ DrcEngineSubLayout* DrcEngineLayout::get_sub_layout(int net_id)
   return sub_layout;
 }
 
+void DrcEngineLayout::removeSubLayout(int net_id)
+{
+  auto it = _sub_layouts.find(net_id);
+  if (it == _sub_layouts.end()) {
+    return;
+  }
+
+  delete it->second;
+  _sub_layouts.erase(it);
+}
+
 ieda_solver::EngineGeometry* DrcEngineLayout::get_net_engine(int net_id)
 {
   auto* sub_layout = get_sub_layout(net_id);
@@ -77,13 +88,15 @@ ieda_solver::EngineGeometry* DrcEngineLayout::get_net_engine(int net_id)
 //   return point_number;
 // }
 
-void DrcEngineLayout::combineLayout(DrcDataManager* data_manager)
+/**
+ * merge all net shapes into layer layout, net_rect_list returns rects of each net for region query
+ */
+void DrcEngineLayout::combineLayout(std::vector<std::pair<ieda_solver::GeometryRect, int>>& net_rect_list)
 {
   for (auto& [net_id, sub_layout] : _sub_layouts) {
     _layout->get_engine()->addGeometry(sub_layout->get_engine());
-    auto net_id_rects = sub_layout->get_engine()->getRects();
-    for (auto& rect : net_id_rects) {
-      data_manager->get_region_query()->addRect(rect, _layer, net_id);
+    for (auto& rect : sub_layout->get_engine()->getRects()) {
+      net_rect_list.emplace_back(rect, net_id);
     }
   }
 }
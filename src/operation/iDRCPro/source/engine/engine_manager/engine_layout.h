@@ -41,6 +41,7 @@ class DrcEngineLayout
 
   std::map<int, DrcEngineSubLayout*>& get_sub_layouts() { return _sub_layouts; }
   DrcEngineSubLayout* get_sub_layout(int net_id);
+  void removeSubLayout(int net_id);
   ieda_solver::EngineGeometry* get_net_engine(int net_id);
   DrcEngineSubLayout* get_layout() { return _layout; }
 
@@ -48,7 +49,7 @@ class DrcEngineLayout
 
   bool addRect(int llx, int lly, int urx, int ury, int net_id);
 
-  void combineLayout(DrcDataManager* data_manager);
+  void combineLayout(std::vector<std::pair<ieda_solver::GeometryRect, int>>& net_rect_list);
 
  private:
   /**
@@ -21,6 +21,7 @@
 #include "engine_scanline.h"
 #include "geometry_boost.h"
 #include "idm.h"
+#include "idrc_config.h"
 #include "idrc_engine_manager.h"
 #include "idrc_violation_manager.h"
 #include "omp.h"
@@ -92,36 +93,503 @@ bool DrcEngineManager::addRect(int llx, int lly, int urx, int ury, std::string l
 
 void DrcEngineManager::dataPreprocess()
 {
-  for (auto& [layer, layout] : get_engine_layouts()) {
-    layout->combineLayout(_data_manager);
+  // cut shapes are also needed by region query to get net ids of cut violations
+  std::vector<std::pair<std::string, DrcEngineLayout*>> layout_list;
+  for (auto type : {LayoutType::kRouting, LayoutType::kCut}) {
+    for (auto& [layer, layout] : get_engine_layouts(type)) {
+      layout_list.emplace_back(layer, layout);
+    }
+  }
+
+  // layers are combined in parallel, region query is built in serial
+  std::vector<std::vector<std::pair<ieda_solver::GeometryRect, int>>> net_rect_list_list(layout_list.size());
+#pragma omp parallel for schedule(dynamic) num_threads(std::max(DrcConfigInst->get_thread_number(), 1))
+  for (size_t i = 0; i < layout_list.size(); ++i) {
+    layout_list[i].second->combineLayout(net_rect_list_list[i]);
+  }
+  for (size_t i = 0; i < layout_list.size(); ++i) {
+    _data_manager->get_region_query()->addRects(net_rect_list_list[i], layout_list[i].first);
   }
 }
 
 void DrcEngineManager::filterData()
 {
+  int tile_size = DrcConfigInst->get_tile_size();
+  if (tile_size > 0) {
+    filterDataTiled(tile_size, DrcConfigInst->get_thread_number());
+  } else {
+    for (auto& [layer, layout] : get_engine_layouts(LayoutType::kRouting)) {
+      filterLayout(layer, layout, _condition_manager);
+    }
+  }
+
+  auto& routing_layouts = get_engine_layouts(LayoutType::kRouting);
+  auto find_routing_layout = [&](std::string layer) -> DrcEngineLayout* {
+    auto it = routing_layouts.find(layer);
+    return it == routing_layouts.end() ? nullptr : it->second;
+  };
+  for (auto& [layer, layout] : get_engine_layouts(LayoutType::kCut)) {
+    auto [below_layer, above_layer] = DrcTechRuleInst->getAdjacentRoutingLayers(layer);
+    _condition_manager->checkCut(layer, layout, find_routing_layout(below_layer), find_routing_layout(above_layer));
+  }
+}
+
+void DrcEngineManager::filterLayout(std::string layer, DrcEngineLayout* layout, DrcConditionManager* condition_manager)
+{
+  // overlap
+  condition_manager->checkOverlap(layer, layout);
+
+  // min spacing
+  condition_manager->checkMinSpacing(layer, layout);
+
+  // jog and prl
+  condition_manager->checkWires(layer, layout);
+
+  // edge
+  condition_manager->checkPolygons(layer, layout);
+}
+
+/**
+ * @brief cut each routing layer into tiles, the tile window is the tile core expanded by the layer halo, all tiles of all layers are
+ * checked concurrently, each tile only keeps the violations located in its core
+ * @param tile_size : tile core size in dbu
+ * @param thread_number : thread number
+ */
+void DrcEngineManager::filterDataTiled(int tile_size, int thread_number)
+{
+  struct DrcTileLayer
+  {
+    std::string layer;
+    ieda_solver::GeometryRect bbox;
+    int x_num = 0;
+    int y_num = 0;
+  };
+  struct DrcTile
+  {
+    int layer_idx = -1;
+    int x_idx = 0;
+    int y_idx = 0;
+    ieda_solver::GeometryRect core;
+    ieda_solver::GeometryRect window;
+    std::vector<ieda_solver::GeometryPolygonSet*> net_polysets;
+    std::vector<std::pair<ViolationEnumType, ieda_solver::GeometryRect>> violations;
+  };
+
+  auto get_tile_idx = [tile_size](int coord, int origin, int num) { return std::clamp((coord - origin) / tile_size, 0, num - 1); };
+
+  std::vector<DrcTileLayer> tile_layers;
+  std::vector<DrcTile> tiles;
   for (auto& [layer, layout] : get_engine_layouts(LayoutType::kRouting)) {
-    // std::cout << "\nidrc : layer " << layer << std::endl;
-    // only for routing layers
-    // if (!DrcTechRuleInst->isLayerRouting(layer)) {
-    //   continue;
-    // }
+    // layer polyset still keeps the overlap of nets, use net extents to build the layer bbox
+    std::vector<std::pair<ieda_solver::GeometryPolygonSet*, ieda_solver::GeometryRect>> net_extents;
+    ieda_solver::GeometryRect bbox;
+    for (auto& [net_id, sub_layout] : layout->get_sub_layouts()) {
+      auto& net_polyset = sub_layout->get_engine()->get_polyset();
+      ieda_solver::GeometryRect net_rect;
+      if (!ieda_solver::envelope(net_rect, net_polyset)) {
+        continue;
+      }
+      if (net_extents.empty()) {
+        bbox = net_rect;
+      } else {
+        ieda_solver::gtl::encompass(bbox, net_rect);
+      }
+      net_extents.emplace_back(&net_polyset, net_rect);
+    }
+    if (net_extents.empty()) {
+      continue;
+    }
 
-    // overlap
-    _condition_manager->checkOverlap(layer, layout);
+    int halo = getLayerHalo(layer);
+    int layer_idx = tile_layers.size();
+    DrcTileLayer tile_layer;
+    tile_layer.layer = layer;
+    tile_layer.bbox = bbox;
+    tile_layer.x_num = (ieda_solver::upRightX(bbox) - ieda_solver::lowLeftX(bbox)) / tile_size + 1;
+    tile_layer.y_num = (ieda_solver::upRightY(bbox) - ieda_solver::lowLeftY(bbox)) / tile_size + 1;
+    tile_layers.push_back(tile_layer);
+
+    size_t tile_begin = tiles.size();
+    for (int y_idx = 0; y_idx < tile_layer.y_num; ++y_idx) {
+      for (int x_idx = 0; x_idx < tile_layer.x_num; ++x_idx) {
+        DrcTile tile;
+        tile.layer_idx = layer_idx;
+        tile.x_idx = x_idx;
+        tile.y_idx = y_idx;
+        int core_llx = ieda_solver::lowLeftX(bbox) + x_idx * tile_size;
+        int core_lly = ieda_solver::lowLeftY(bbox) + y_idx * tile_size;
+        tile.core = ieda_solver::GeometryRect(core_llx, core_lly, core_llx + tile_size, core_lly + tile_size);
+        tile.window = ieda_solver::GeometryRect(core_llx - halo, core_lly - halo, core_llx + tile_size + halo, core_lly + tile_size + halo);
+        tiles.push_back(tile);
+      }
+    }
 
-    // min spacing
-    _condition_manager->checkMinSpacing(layer, layout);
+    // dispatch nets to the tiles whose window overlaps the net
+    for (auto& [net_polyset, net_rect] : net_extents) {
+      int x_begin = get_tile_idx(ieda_solver::lowLeftX(net_rect) - halo, ieda_solver::lowLeftX(bbox), tile_layer.x_num);
+      int x_end = get_tile_idx(ieda_solver::upRightX(net_rect) + halo, ieda_solver::lowLeftX(bbox), tile_layer.x_num);
+      int y_begin = get_tile_idx(ieda_solver::lowLeftY(net_rect) - halo, ieda_solver::lowLeftY(bbox), tile_layer.y_num);
+      int y_end = get_tile_idx(ieda_solver::upRightY(net_rect) + halo, ieda_solver::lowLeftY(bbox), tile_layer.y_num);
+      for (int y_idx = y_begin; y_idx <= y_end; ++y_idx) {
+        for (int x_idx = x_begin; x_idx <= x_end; ++x_idx) {
+          tiles[tile_begin + y_idx * tile_layer.x_num + x_idx].net_polysets.push_back(net_polyset);
+        }
+      }
+    }
+  }
 
-    // jog and prl
-    _condition_manager->checkWires(layer, layout);
+  // violations from shapes cut by the tile window are only kept if they are not touching the cut edge
+  auto is_polygon_violation = [](ViolationEnumType type) {
+    return type == ViolationEnumType::kArea || type == ViolationEnumType::kAreaEnclosed || type == ViolationEnumType::kMinStep
+           || type == ViolationEnumType::kNotch;
+  };
+
+#pragma omp parallel for schedule(dynamic) num_threads(std::max(thread_number, 1))
+  for (size_t i = 0; i < tiles.size(); ++i) {
+    auto& tile = tiles[i];
+    if (tile.net_polysets.empty()) {
+      continue;
+    }
+    auto& tile_layer = tile_layers[tile.layer_idx];
+
+    ieda_solver::GeometryPolygonSet window_polyset;
+    window_polyset += tile.window;
+    DrcEngineLayout tile_layout(tile_layer.layer);
+    auto& tile_polyset = tile_layout.get_layout()->get_engine()->get_polyset();
+    for (auto* net_polyset : tile.net_polysets) {
+      ieda_solver::GeometryPolygonSet net_polyset_in_window(*net_polyset & window_polyset);
+      tile_polyset += net_polyset_in_window;
+    }
+
+    DrcViolationManager tile_violation_manager(_data_manager);
+    DrcConditionManager tile_condition_manager(&tile_violation_manager);
+    tile_condition_manager.set_check_select(_condition_manager->get_check_select());
+    filterLayout(tile_layer.layer, &tile_layout, &tile_condition_manager);
+
+    auto is_cut_edge = [&](int coord, int window_coord, int bbox_coord, bool is_low) {
+      return coord == window_coord && (is_low ? window_coord > bbox_coord : window_coord < bbox_coord);
+    };
+    auto& bbox = tile_layer.bbox;
+    for (int type = (int) ViolationEnumType::kNone; type < (int) ViolationEnumType::kMax; ++type) {
+      auto violation_type = (ViolationEnumType) type;
+      for (auto* violation : tile_violation_manager.get_violation_list(violation_type)) {
+        auto* violation_rect = static_cast<DrcViolationRect*>(violation);
+        ieda_solver::GeometryRect rect(violation_rect->get_llx(), violation_rect->get_lly(), violation_rect->get_urx(),
+                                       violation_rect->get_ury());
+        if (violation_type == ViolationEnumType::kShort) {
+          // short is clipped to tile core and rebuilt while merging
+          if (ieda_solver::gtl::intersect(rect, tile.core, false)) {
+            tile.violations.emplace_back(violation_type, rect);
+          }
+          continue;
+        }
+        // the tile owning the low left corner reports the violation
+        if (get_tile_idx(ieda_solver::lowLeftX(rect), ieda_solver::lowLeftX(bbox), tile_layer.x_num) != tile.x_idx
+            || get_tile_idx(ieda_solver::lowLeftY(rect), ieda_solver::lowLeftY(bbox), tile_layer.y_num) != tile.y_idx) {
+          continue;
+        }
+        if (is_polygon_violation(violation_type)
+            && (is_cut_edge(ieda_solver::lowLeftX(rect), ieda_solver::lowLeftX(tile.window), ieda_solver::lowLeftX(bbox), true)
+                || is_cut_edge(ieda_solver::lowLeftY(rect), ieda_solver::lowLeftY(tile.window), ieda_solver::lowLeftY(bbox), true)
+                || is_cut_edge(ieda_solver::upRightX(rect), ieda_solver::upRightX(tile.window), ieda_solver::upRightX(bbox), false)
+                || is_cut_edge(ieda_solver::upRightY(rect), ieda_solver::upRightY(tile.window), ieda_solver::upRightY(bbox), false))) {
+          continue;
+        }
+        tile.violations.emplace_back(violation_type, rect);
+      }
+    }
+    std::vector<ieda_solver::GeometryPolygonSet*>().swap(tile.net_polysets);
+  }
+
+  // merge violations by tile order, short pieces in adjacent cores are joined again
+  std::vector<ieda_solver::GeometryPolygonSet> short_polysets(tile_layers.size());
+  for (auto& tile : tiles) {
+    auto& layer = tile_layers[tile.layer_idx].layer;
+    for (auto& [violation_type, rect] : tile.violations) {
+      if (violation_type == ViolationEnumType::kShort) {
+        short_polysets[tile.layer_idx] += rect;
+      } else {
+        _condition_manager->get_violation_manager()->addViolation(ieda_solver::lowLeftX(rect), ieda_solver::lowLeftY(rect),
+                                                                  ieda_solver::upRightX(rect), ieda_solver::upRightY(rect), violation_type,
+                                                                  {}, layer);
+      }
+    }
+  }
+  for (size_t layer_idx = 0; layer_idx < tile_layers.size(); ++layer_idx) {
+    std::vector<ieda_solver::GeometryPolygon> short_polygons;
+    short_polysets[layer_idx].get(short_polygons);
+    for (auto& short_polygon : short_polygons) {
+      ieda_solver::GeometryRect rect;
+      ieda_solver::envelope(rect, short_polygon);
+      _condition_manager->get_violation_manager()->addViolation(ieda_solver::lowLeftX(rect), ieda_solver::lowLeftY(rect),
+                                                                ieda_solver::upRightX(rect), ieda_solver::upRightY(rect),
+                                                                ViolationEnumType::kShort, {}, tile_layers[layer_idx].layer);
+    }
+  }
+}
+
+/**
+ * @brief max distance the rules of one layer look around a shape, used as the tile halo
+ */
+int DrcEngineManager::getLayerHalo(std::string layer)
+{
+  int min_spacing = std::max(DrcTechRuleInst->getMinSpacing(layer), 0);
+  int halo = min_spacing;
+
+  auto rule_jog_to_jog = DrcTechRuleInst->getJogToJog(layer);
+  if (rule_jog_to_jog) {
+    halo = std::max(halo, rule_jog_to_jog->get_jog_to_jog_spacing());
+    for (auto& width_item : rule_jog_to_jog->get_width_list()) {
+      halo = std::max(halo, width_item.get_par_within() + width_item.get_long_jog_spacing());
+    }
+  }
+
+  auto rule_spacing_table = DrcTechRuleInst->getSpacingTable(layer);
+  if (rule_spacing_table && rule_spacing_table->is_parallel()) {
+    for (auto& spacing_list : rule_spacing_table->get_parallel()->get_spacing_table()) {
+      for (int spacing : spacing_list) {
+        halo = std::max(halo, spacing);
+      }
+    }
+  }
+
+  for (auto& rule_eol : DrcTechRuleInst->getSpacingEolList(layer)) {
+    int eol_halo = rule_eol->get_eol_space() + rule_eol->get_eol_within().value_or(0);
+    if (rule_eol->get_parallel_edge().has_value()) {
+      auto rule_par_edge = rule_eol->get_parallel_edge().value();
+      eol_halo = std::max(eol_halo, rule_par_edge.get_par_space() + rule_par_edge.get_par_within());
+    }
+    halo = std::max(halo, eol_halo);
+  }
+
+  auto rule_corner_fill = DrcTechRuleInst->getCornerFillSpacing(layer);
+  if (rule_corner_fill) {
+    halo = std::max(halo, rule_corner_fill->get_spacing() + rule_corner_fill->get_edge_length1() + rule_corner_fill->get_edge_length2());
+  }
 
-    // edge
-    _condition_manager->checkPolygons(layer, layout);
+  auto rule_notch = DrcTechRuleInst->getSpacingNotchlength(layer);
+  if (rule_notch) {
+    halo = std::max(halo, rule_notch->get_min_spacing() + rule_notch->get_min_notch_length());
   }
 
+  // a polygon violating min area or a hole violating min enclosed area should be inside one tile window
+  auto* idb_routing_layer = DrcTechRuleInst->findRoutingLayer(layer);
+  int min_width = idb_routing_layer ? std::max(idb_routing_layer->get_min_width(), 1) : 1;
+  int min_area = std::max(DrcTechRuleInst->getMinArea(layer), 0);
+  for (auto& rule_lef58_area : DrcTechRuleInst->getLef58AreaList(layer)) {
+    min_area = std::max(min_area, rule_lef58_area->get_min_area());
+  }
+  halo = std::max(halo, min_area / min_width);
+  halo = std::max(halo, std::max(DrcTechRuleInst->getMinEnclosedArea(layer), 0) / std::max(min_spacing, 1));
+
+  // cut rules, metal enclosing the cut should not be cut by the window near the cut
+  halo = std::max(halo, DrcTechRuleInst->getCutSpacing(layer));
+  auto rule_cut_eol = DrcTechRuleInst->getCutEolSpacing(layer);
+  if (rule_cut_eol) {
+    halo = std::max({halo, rule_cut_eol->get_cut_spacing1(), rule_cut_eol->get_cut_spacing2(), rule_cut_eol->get_smaller_overhang(),
+                     rule_cut_eol->get_equal_overhang()});
+    for (auto& to_class : rule_cut_eol->get_to_classes()) {
+      halo = std::max({halo, to_class.get_cut_spacing1(), to_class.get_cut_spacing2()});
+    }
+  }
+  for (bool is_above : {false, true}) {
+    auto* rule_enclosure = DrcTechRuleInst->getCutEnclosure(layer, is_above);
+    if (rule_enclosure) {
+      halo = std::max({halo, rule_enclosure->get_overhang_1(), rule_enclosure->get_overhang_2()});
+    }
+  }
+
+  return halo;
+}
+
+/**
+ * @brief register the shapes of a net to region query and mark them dirty, the net must be removed before it is committed again
+ */
+void DrcEngineManager::commitNet(int net_id)
+{
+  markNetDirty(net_id, false);
+}
+
+/**
+ * @brief remove all shapes of a net, the region they covered is marked dirty
+ */
+void DrcEngineManager::removeNet(int net_id)
+{
+  markNetDirty(net_id, true);
+}
+
+void DrcEngineManager::markNetDirty(int net_id, bool is_removed)
+{
+  auto* region_query = _data_manager->get_region_query();
+  for (auto& [type, layouts] : _layouts) {
+    for (auto& [layer, layout] : layouts) {
+      auto& sub_layouts = layout->get_sub_layouts();
+      auto it = sub_layouts.find(net_id);
+      if (it == sub_layouts.end()) {
+        continue;
+      }
+      auto& dirty_region = _dirty_regions[type][layer];
+      for (auto& rect : it->second->get_engine()->getRects()) {
+        if (is_removed) {
+          region_query->removeRect(rect, layer, net_id);
+        } else {
+          region_query->addRect(rect, layer, net_id);
+        }
+        dirty_region += rect;
+      }
+      if (is_removed) {
+        layout->removeSubLayout(net_id);
+      }
+    }
+  }
+}
+
+/**
+ * @brief build a layout holding the shapes of one layer clipped by the window, nets are found by region query
+ */
+DrcEngineLayout* DrcEngineManager::buildWindowLayout(std::string layer, LayoutType type, ieda_solver::GeometryRect& window)
+{
+  auto* window_layout = new DrcEngineLayout(layer);
+  auto& layouts = get_engine_layouts(type);
+  auto it = layouts.find(layer);
+  if (it == layouts.end()) {
+    return window_layout;
+  }
+
+  ieda_solver::GeometryPolygonSet window_polyset;
+  window_polyset += window;
+  auto& sub_layouts = it->second->get_sub_layouts();
+  auto net_ids = _data_manager->get_region_query()->queryNetId(layer, ieda_solver::lowLeftX(window), ieda_solver::lowLeftY(window),
+                                                               ieda_solver::upRightX(window), ieda_solver::upRightY(window));
+  for (int net_id : net_ids) {
+    auto sub_it = sub_layouts.find(net_id);
+    if (sub_it == sub_layouts.end()) {
+      continue;
+    }
+    ieda_solver::GeometryPolygonSet net_polyset_in_window(sub_it->second->get_engine()->get_polyset() & window_polyset);
+    if (net_polyset_in_window.empty()) {
+      continue;
+    }
+    window_layout->get_net_engine(net_id)->get_polyset() += net_polyset_in_window;
+    window_layout->get_layout()->get_engine()->get_polyset() += net_polyset_in_window;
+  }
+
+  return window_layout;
+}
+
+/**
+ * @brief check the dirty regions only, each dirty region grown by the layer halo is a window, shapes in the window are clipped into
+ * window layouts and checked, only violations touching the dirty core are recorded by the condition manager, dirty regions are cleared
+ * @return checked core and window pairs of each layer
+ */
+std::map<std::string, std::vector<std::pair<ieda_solver::GeometryRect, ieda_solver::GeometryRect>>> DrcEngineManager::filterDirtyData(
+    DrcConditionManager* condition_manager)
+{
+  std::map<std::string, std::vector<std::pair<ieda_solver::GeometryRect, ieda_solver::GeometryRect>>> checked_core_windows;
+
+  auto is_polygon_violation = [](ViolationEnumType type) {
+    return type == ViolationEnumType::kArea || type == ViolationEnumType::kAreaEnclosed || type == ViolationEnumType::kMinStep
+           || type == ViolationEnumType::kNotch;
+  };
+
+  // split dirty region into windows, the core is the envelope of dirty shapes in the window
+  auto get_core_windows = [](ieda_solver::GeometryPolygonSet& dirty_region, int halo) {
+    std::vector<ieda_solver::GeometryRect> dirty_rects;
+    ieda_solver::getDefaultRectangles(dirty_rects, dirty_region);
+    ieda_solver::GeometryPolygonSet grown_region;
+    for (auto& rect : dirty_rects) {
+      grown_region += ieda_solver::GeometryRect(ieda_solver::lowLeftX(rect) - halo, ieda_solver::lowLeftY(rect) - halo,
+                                                ieda_solver::upRightX(rect) + halo, ieda_solver::upRightY(rect) + halo);
+    }
+    std::vector<ieda_solver::GeometryPolygon> grown_polygons;
+    grown_region.get(grown_polygons);
+
+    std::vector<std::pair<ieda_solver::GeometryRect, ieda_solver::GeometryRect>> core_windows;
+    for (auto& grown_polygon : grown_polygons) {
+      ieda_solver::GeometryRect window;
+      ieda_solver::envelope(window, grown_polygon);
+      ieda_solver::GeometryRect core(ieda_solver::lowLeftX(window) + halo, ieda_solver::lowLeftY(window) + halo,
+                                     ieda_solver::upRightX(window) - halo, ieda_solver::upRightY(window) - halo);
+      core_windows.emplace_back(core, window);
+    }
+    return core_windows;
+  };
+
+  auto check_window = [&](std::string layer, LayoutType type, ieda_solver::GeometryRect& core, ieda_solver::GeometryRect& window) {
+    DrcViolationManager window_violation_manager(_data_manager);
+    DrcConditionManager window_condition_manager(&window_violation_manager);
+    window_condition_manager.set_check_select(condition_manager->get_check_select());
+
+    std::vector<DrcEngineLayout*> window_layouts;
+    if (type == LayoutType::kRouting) {
+      window_layouts.push_back(buildWindowLayout(layer, LayoutType::kRouting, window));
+      filterLayout(layer, window_layouts[0], &window_condition_manager);
+    } else {
+      auto [below_layer, above_layer] = DrcTechRuleInst->getAdjacentRoutingLayers(layer);
+      window_layouts.push_back(buildWindowLayout(layer, LayoutType::kCut, window));
+      window_layouts.push_back(below_layer.empty() ? nullptr : buildWindowLayout(below_layer, LayoutType::kRouting, window));
+      window_layouts.push_back(above_layer.empty() ? nullptr : buildWindowLayout(above_layer, LayoutType::kRouting, window));
+      window_condition_manager.checkCut(layer, window_layouts[0], window_layouts[1], window_layouts[2]);
+    }
+
+    for (int type_idx = (int) ViolationEnumType::kNone; type_idx < (int) ViolationEnumType::kMax; ++type_idx) {
+      auto violation_type = (ViolationEnumType) type_idx;
+      for (auto* violation : window_violation_manager.get_violation_list(violation_type)) {
+        auto* violation_rect = static_cast<DrcViolationRect*>(violation);
+        ieda_solver::GeometryRect rect(violation_rect->get_llx(), violation_rect->get_lly(), violation_rect->get_urx(),
+                                       violation_rect->get_ury());
+        if (!ieda_solver::gtl::intersects(core, rect, true)) {
+          continue;
+        }
+        if (is_polygon_violation(violation_type)
+            && (ieda_solver::lowLeftX(rect) <= ieda_solver::lowLeftX(window) || ieda_solver::lowLeftY(rect) <= ieda_solver::lowLeftY(window)
+                || ieda_solver::upRightX(rect) >= ieda_solver::upRightX(window)
+                || ieda_solver::upRightY(rect) >= ieda_solver::upRightY(window))) {
+          continue;
+        }
+        condition_manager->get_violation_manager()->addViolation(violation_rect->get_llx(), violation_rect->get_lly(),
+                                                                 violation_rect->get_urx(), violation_rect->get_ury(), violation_type, {},
+                                                                 layer);
+      }
+    }
+
+    for (auto* window_layout : window_layouts) {
+      if (window_layout != nullptr) {
+        delete window_layout;
+      }
+    }
+  };
+
+  for (auto& [layer, dirty_region] : _dirty_regions[LayoutType::kRouting]) {
+    for (auto& [core, window] : get_core_windows(dirty_region, getLayerHalo(layer))) {
+      check_window(layer, LayoutType::kRouting, core, window);
+      checked_core_windows[layer].emplace_back(core, window);
+    }
+  }
+
+  // cut layers are also dirty if the metal around the cut changes
   for (auto& [layer, layout] : get_engine_layouts(LayoutType::kCut)) {
-    // TODO: cut rule
+    auto [below_layer, above_layer] = DrcTechRuleInst->getAdjacentRoutingLayers(layer);
+    ieda_solver::GeometryPolygonSet dirty_region;
+    for (auto& [dirty_type, dirty_layer] : {std::make_pair(LayoutType::kCut, layer), std::make_pair(LayoutType::kRouting, below_layer),
+                                            std::make_pair(LayoutType::kRouting, above_layer)}) {
+      auto it = _dirty_regions[dirty_type].find(dirty_layer);
+      if (it != _dirty_regions[dirty_type].end()) {
+        dirty_region += it->second;
+      }
+    }
+    if (dirty_region.empty()) {
+      continue;
+    }
+    for (auto& [core, window] : get_core_windows(dirty_region, getLayerHalo(layer))) {
+      check_window(layer, LayoutType::kCut, core, window);
+      checked_core_windows[layer].emplace_back(core, window);
+    }
   }
+
+  _dirty_regions.clear();
+
+  return checked_core_windows;
 }
 
 // void DrcEngineManager::dataPreprocess()
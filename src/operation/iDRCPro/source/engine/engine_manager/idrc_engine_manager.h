@@ -56,6 +56,12 @@ class DrcEngineManager
 
   void filterData();
 
+  /// incremental operator
+  void commitNet(int net_id);
+  void removeNet(int net_id);
+  std::map<std::string, std::vector<std::pair<ieda_solver::GeometryRect, ieda_solver::GeometryRect>>> filterDirtyData(
+      DrcConditionManager* condition_manager);
+
  private:
   DrcDataManager* _data_manager;
   DrcConditionManager* _condition_manager;
@@ -72,7 +78,17 @@ class DrcEngineManager
    *  _scanline : scanline matrix
    */
   std::map<LayoutType, std::map<std::string, DrcEngineScanline*>> _scanline_matrix;
+  /**
+   *  _dirty_regions : regions changed by nets committed or removed since the last incremental check
+   */
+  std::map<LayoutType, std::map<std::string, ieda_solver::GeometryPolygonSet>> _dirty_regions;
   // DrcEngineCheck* _engine_check = nullptr;
+
+  void filterLayout(std::string layer, DrcEngineLayout* layout, DrcConditionManager* condition_manager);
+  void filterDataTiled(int tile_size, int thread_number);
+  int getLayerHalo(std::string layer);
+  void markNetDirty(int net_id, bool is_removed);
+  DrcEngineLayout* buildWindowLayout(std::string layer, LayoutType type, ieda_solver::GeometryRect& window);
 };
 
 }  // namespace idrc
\ No newline at end of file
@@ -47,10 +47,37 @@ class DrcRegionQuery
     _query_tree[layer].insert(std::make_pair(rtree_rect, id));
   }
 
+  // rects are packed into a new tree if the layer is empty
+  void addRects(std::vector<std::pair<ieda_solver::GeometryRect, int>>& rect_list, std::string layer)
+  {
+    std::vector<std::pair<ieda_solver::BgRect, int>> rtree_rect_list;
+    rtree_rect_list.reserve(rect_list.size());
+    for (auto& [rect, id] : rect_list) {
+      rtree_rect_list.emplace_back(ieda_solver::BgRect(ieda_solver::BgPoint(ieda_solver::lowLeftX(rect), ieda_solver::lowLeftY(rect)),
+                                                       ieda_solver::BgPoint(ieda_solver::upRightX(rect), ieda_solver::upRightY(rect))),
+                                   id);
+    }
+    auto& query_tree = _query_tree[layer];
+    if (query_tree.empty()) {
+      query_tree = RTree(rtree_rect_list.begin(), rtree_rect_list.end());
+    } else {
+      query_tree.insert(rtree_rect_list.begin(), rtree_rect_list.end());
+    }
+  }
+
+  void removeRect(ieda_solver::GeometryRect rect, std::string layer, int id)
+  {
+    ieda_solver::BgRect rtree_rect(ieda_solver::BgPoint(ieda_solver::lowLeftX(rect), ieda_solver::lowLeftY(rect)),
+                                   ieda_solver::BgPoint(ieda_solver::upRightX(rect), ieda_solver::upRightY(rect)));
+    _query_tree[layer].remove(std::make_pair(rtree_rect, id));
+  }
+
  private:
   DrcDataManager* _data_manager = nullptr;
 
-  std::map<std::string, bg::index::rtree<std::pair<ieda_solver::BgRect, int>, bg::index::quadratic<16>>> _query_tree;
+  using RTree = bg::index::rtree<std::pair<ieda_solver::BgRect, int>, bg::index::quadratic<16>>;
+
+  std::map<std::string, RTree> _query_tree;
 };
 
 }  // namespace idrc
\ No newline at end of file
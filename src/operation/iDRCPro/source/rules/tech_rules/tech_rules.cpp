@@ -143,4 +143,56 @@ std::vector<std::shared_ptr<routinglayer::Lef58MinStep>> TechRules::getLef58MinS
   return idb_routing_layer->get_lef58_min_step();
 }
 
+/**
+ * @brief routing layers below and above the cut layer, empty name if not exist
+ */
+std::pair<std::string, std::string> TechRules::getAdjacentRoutingLayers(std::string cut_layer_name)
+{
+  auto idb_cut_layer = findCutLayer(cut_layer_name);
+  if (!idb_cut_layer)
+    return {"", ""};
+
+  auto idb_layers = dmInst->get_idb_design()->get_layout()->get_layers();
+  auto get_routing_layer_name = [&](int order) -> std::string {
+    auto idb_layer = order < 0 ? nullptr : idb_layers->find_layer_by_order(order);
+    return idb_layer && idb_layer->is_routing() ? idb_layer->get_name() : "";
+  };
+
+  return {get_routing_layer_name(idb_cut_layer->get_order() - 1), get_routing_layer_name(idb_cut_layer->get_order() + 1)};
+}
+
+int TechRules::getCutSpacing(std::string layer_name)
+{
+  auto idb_cut_layer = findCutLayer(layer_name);
+  if (!idb_cut_layer)
+    return -1;
+
+  // only plain spacing, adjacent cuts spacing is not supported
+  int spacing = 0;
+  for (auto* cut_spacing : idb_cut_layer->get_spacings()) {
+    if (!cut_spacing->get_adjacent_cuts().has_value()) {
+      spacing = std::max(spacing, cut_spacing->get_spacing());
+    }
+  }
+  return spacing;
+}
+
+std::shared_ptr<cutlayer::Lef58EolSpacing> TechRules::getCutEolSpacing(std::string layer_name)
+{
+  auto idb_cut_layer = findCutLayer(layer_name);
+  if (!idb_cut_layer)
+    return nullptr;
+
+  return idb_cut_layer->get_lef58_eol_spacing();
+}
+
+IdbLayerCutEnclosure* TechRules::getCutEnclosure(std::string layer_name, bool is_above)
+{
+  auto idb_cut_layer = findCutLayer(layer_name);
+  if (!idb_cut_layer)
+    return nullptr;
+
+  return is_above ? idb_cut_layer->get_enclosure_above() : idb_cut_layer->get_enclosure_below();
+}
+
 }  // namespace idrc
\ No newline at end of file
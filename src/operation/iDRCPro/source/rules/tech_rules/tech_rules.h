@@ -60,6 +60,12 @@ class TechRules
     return dynamic_cast<idb::IdbLayerRouting*>(layer);
   }
 
+  idb::IdbLayerCut* findCutLayer(std::string layer_name)
+  {
+    auto layer = findLayer(layer_name);
+    return dynamic_cast<idb::IdbLayerCut*>(layer);
+  }
+
   bool isLayerRouting(std::string layer_name)
   {
     auto layer = findLayer(layer_name);
@@ -83,6 +89,11 @@ class TechRules
   std::shared_ptr<IdbMinStep> getMinStep(std::string layer_name);
   std::vector<std::shared_ptr<routinglayer::Lef58MinStep>> getLef58MinStep(std::string layer_name);
 
+  std::pair<std::string, std::string> getAdjacentRoutingLayers(std::string cut_layer_name);
+  int getCutSpacing(std::string layer_name);
+  std::shared_ptr<cutlayer::Lef58EolSpacing> getCutEolSpacing(std::string layer_name);
+  IdbLayerCutEnclosure* getCutEnclosure(std::string layer_name, bool is_above);
+
   ///
 
  private:
@@ -19,6 +19,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include "DRCViolationType.h"
@@ -28,6 +29,7 @@
 #include "idrc_dm.h"
 #include "idrc_region_query.h"
 #include "idrc_violation.h"
+#include "idrc_violation_sink.h"
 #include "tech_rules.h"
 
 namespace idrc {
@@ -67,8 +69,33 @@ class DrcViolationManager
     return _violation_list[type];
   }
 
+  /**
+   * sink : violations are written to sink and not kept in memory if sink is set
+   * max_violation_num : violations of one type in one region are dropped after max_violation_num hits, 0 means no limit
+   * region_size : region size in dbu for max_violation_num, 0 means the whole layer
+   */
+  void set_sink(DrcViolationSink* sink) { _sink = sink; }
+  void set_region_cap(int max_violation_num, int region_size)
+  {
+    _max_violation_num = max_violation_num;
+    _region_size = region_size;
+  }
+  int get_dropped_violation_num() { return _dropped_violation_num; }
+
   void addViolation(int llx, int lly, int urx, int ury, ViolationEnumType type, std::set<int> net_id, std::string layer_name)
   {
+    if (isOverRegionCap(llx, lly, type, layer_name)) {
+      return;
+    }
+
+    if (_sink != nullptr) {
+      if (net_id.empty()) {
+        net_id = _data_manager->get_region_query()->queryNetId(layer_name, llx, lly, urx, ury);
+      }
+      _sink->write(layer_name, type, llx, lly, urx, ury, net_id);
+      return;
+    }
+
     idb::IdbLayer* layer = DrcTechRuleInst->findLayer(layer_name);
 
     DrcViolationRect* violation_rect = new DrcViolationRect(layer, net_id, type, llx, lly, urx, ury);
@@ -79,6 +106,28 @@ class DrcViolationManager
  private:
   DrcDataManager* _data_manager = nullptr;
   std::map<ViolationEnumType, std::vector<DrcViolation*>> _violation_list;
+
+  DrcViolationSink* _sink = nullptr;
+  int _max_violation_num = 0;
+  int _region_size = 0;
+  int _dropped_violation_num = 0;
+  std::map<std::tuple<std::string, ViolationEnumType, int, int>, int> _region_violation_num_map;
+
+  bool isOverRegionCap(int llx, int lly, ViolationEnumType type, const std::string& layer_name)
+  {
+    if (_max_violation_num <= 0) {
+      return false;
+    }
+    int region_x = _region_size > 0 ? llx / _region_size : 0;
+    int region_y = _region_size > 0 ? lly / _region_size : 0;
+    int& violation_num = _region_violation_num_map[std::make_tuple(layer_name, type, region_x, region_y)];
+    if (violation_num >= _max_violation_num) {
+      ++_dropped_violation_num;
+      return true;
+    }
+    ++violation_num;
+    return false;
+  }
 };
 
 }  // namespace idrc
\ No newline at end of file
@@ -0,0 +1,225 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#include "idrc_violation_sink.h"
+
+#include <iostream>
+
+namespace idrc {
+
+namespace {
+constexpr uint32_t kViolationFileMagic = 0x49445243;  // "IDRC"
+constexpr uint32_t kViolationFileVersion = 1;
+
+template <typename T>
+void writeValue(std::ofstream& stream, const T& value)
+{
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool readValue(std::ifstream& stream, T& value)
+{
+  return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+}  // namespace
+
+DrcViolationSink::DrcViolationSink(std::string path, uint32_t block_record_num) : _block_record_num(std::max(1u, block_record_num))
+{
+  _stream.open(path, std::ios::binary | std::ios::trunc);
+  if (!_stream.is_open()) {
+    std::cout << "[Error] Failed to open violation file '" << path << "'!" << std::endl;
+    return;
+  }
+  writeValue(_stream, kViolationFileMagic);
+  writeValue(_stream, kViolationFileVersion);
+}
+
+DrcViolationSink::~DrcViolationSink()
+{
+  close();
+}
+
+void DrcViolationSink::write(const std::string& layer, ViolationEnumType type, int llx, int lly, int urx, int ury,
+                             const std::set<int>& net_ids)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (!_stream.is_open()) {
+    return;
+  }
+  auto& buffer = _buffer_map[std::make_pair(layer, type)];
+  buffer.words.insert(buffer.words.end(), {llx, lly, urx, ury, (int32_t) net_ids.size()});
+  buffer.words.insert(buffer.words.end(), net_ids.begin(), net_ids.end());
+  ++buffer.record_num;
+  ++_record_num;
+  if (buffer.record_num >= _block_record_num) {
+    flushBlock(layer, type, buffer);
+  }
+}
+
+void DrcViolationSink::flushBlock(const std::string& layer, ViolationEnumType type, BlockBuffer& buffer)
+{
+  if (buffer.record_num == 0) {
+    return;
+  }
+  DrcViolationBlock block;
+  block.layer = layer;
+  block.type = type;
+  block.offset = _stream.tellp();
+  block.record_num = buffer.record_num;
+  block.word_num = buffer.words.size();
+  _stream.write(reinterpret_cast<const char*>(buffer.words.data()), buffer.words.size() * sizeof(int32_t));
+  _block_list.push_back(block);
+
+  buffer.words.clear();
+  buffer.record_num = 0;
+}
+
+void DrcViolationSink::close()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (!_stream.is_open()) {
+    return;
+  }
+  for (auto& [key, buffer] : _buffer_map) {
+    flushBlock(key.first, key.second, buffer);
+  }
+  _buffer_map.clear();
+
+  uint64_t index_offset = _stream.tellp();
+  writeValue(_stream, (uint64_t) _block_list.size());
+  for (auto& block : _block_list) {
+    writeValue(_stream, (uint32_t) block.layer.size());
+    _stream.write(block.layer.data(), block.layer.size());
+    writeValue(_stream, (int32_t) block.type);
+    writeValue(_stream, block.offset);
+    writeValue(_stream, block.record_num);
+    writeValue(_stream, block.word_num);
+  }
+  writeValue(_stream, index_offset);
+  _stream.close();
+}
+
+DrcViolationReader::DrcViolationReader(std::string path)
+{
+  _stream.open(path, std::ios::binary);
+  if (!_stream.is_open()) {
+    std::cout << "[Error] Failed to open violation file '" << path << "'!" << std::endl;
+    return;
+  }
+
+  uint32_t magic = 0;
+  uint32_t version = 0;
+  uint64_t file_size = 0;
+  uint64_t index_offset = 0;
+  uint64_t block_num = 0;
+  bool is_valid = readValue(_stream, magic) && readValue(_stream, version) && magic == kViolationFileMagic
+                  && version == kViolationFileVersion && _stream.seekg(0, std::ios::end);
+  if (is_valid) {
+    file_size = _stream.tellg();
+  }
+  is_valid = is_valid && file_size >= sizeof(uint64_t) && _stream.seekg(file_size - sizeof(uint64_t)) && readValue(_stream, index_offset)
+             && index_offset < file_size && _stream.seekg(index_offset) && readValue(_stream, block_num);
+  for (uint64_t i = 0; is_valid && i < block_num; ++i) {
+    DrcViolationBlock block;
+    uint32_t layer_size = 0;
+    int32_t type = 0;
+    is_valid = readValue(_stream, layer_size) && layer_size < file_size - index_offset;
+    if (!is_valid) {
+      break;
+    }
+    block.layer.resize(layer_size);
+    is_valid = _stream.read(block.layer.data(), layer_size) && readValue(_stream, type) && readValue(_stream, block.offset)
+               && readValue(_stream, block.record_num) && readValue(_stream, block.word_num)
+               && type >= (int32_t) ViolationEnumType::kNone && type < (int32_t) ViolationEnumType::kMax
+               && block.offset + (uint64_t) block.word_num * sizeof(int32_t) <= index_offset;
+    block.type = (ViolationEnumType) type;
+    _block_list.push_back(block);
+  }
+  if (!is_valid) {
+    std::cout << "[Error] Invalid violation file '" << path << "'!" << std::endl;
+    _block_list.clear();
+    _stream.close();
+  }
+}
+
+std::map<std::string, std::map<ViolationEnumType, uint64_t>> DrcViolationReader::get_summary()
+{
+  std::map<std::string, std::map<ViolationEnumType, uint64_t>> summary;
+  for (auto& block : _block_list) {
+    summary[block.layer][block.type] += block.record_num;
+  }
+  return summary;
+}
+
+/**
+ * read records of layer and type from the start-th record, at most max_num records,
+ * a broken block closes the reader and returns no record
+ */
+std::vector<DrcViolationRecord> DrcViolationReader::read(const std::string& layer, ViolationEnumType type, uint64_t start,
+                                                         uint64_t max_num)
+{
+  std::vector<DrcViolationRecord> record_list;
+  uint64_t record_idx = 0;
+  for (auto& block : _block_list) {
+    if (record_list.size() >= max_num) {
+      break;
+    }
+    if (block.layer != layer || block.type != type) {
+      continue;
+    }
+    // blocks before start are skipped without loading
+    if (record_idx + block.record_num <= start) {
+      record_idx += block.record_num;
+      continue;
+    }
+    std::vector<int32_t> words(block.word_num);
+    _stream.clear();
+    bool is_valid = _stream.seekg(block.offset) && _stream.read(reinterpret_cast<char*>(words.data()), words.size() * sizeof(int32_t));
+
+    size_t word_idx = 0;
+    for (uint32_t i = 0; is_valid && i < block.record_num && record_list.size() < max_num; ++i, ++record_idx) {
+      DrcViolationRecord record;
+      if (word_idx + 5 > words.size()) {
+        is_valid = false;
+        break;
+      }
+      record.llx = words[word_idx++];
+      record.lly = words[word_idx++];
+      record.urx = words[word_idx++];
+      record.ury = words[word_idx++];
+      int32_t net_num = words[word_idx++];
+      if (net_num < 0 || word_idx + net_num > words.size()) {
+        is_valid = false;
+        break;
+      }
+      if (record_idx >= start) {
+        record.net_ids.assign(words.begin() + word_idx, words.begin() + word_idx + net_num);
+        record_list.push_back(std::move(record));
+      }
+      word_idx += net_num;
+    }
+    if (!is_valid) {
+      std::cout << "[Error] Invalid violation block of layer " << layer << " at offset " << block.offset << "!" << std::endl;
+      _block_list.clear();
+      _stream.close();
+      return {};
+    }
+  }
+  return record_list;
+}
+
+}  // namespace idrc
@@ -0,0 +1,108 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "DRCViolationType.h"
+
+namespace idrc {
+
+/**
+ * violation file layout :
+ *   header : magic number, version
+ *   blocks : records of one layer and one violation type, record = llx lly urx ury net_num net_id...
+ *   index : layer name, violation type, offset, record num, word num of each block
+ *   tail : index offset
+ */
+struct DrcViolationRecord
+{
+  int llx = 0;
+  int lly = 0;
+  int urx = 0;
+  int ury = 0;
+  std::vector<int> net_ids;
+};
+
+struct DrcViolationBlock
+{
+  std::string layer;
+  ViolationEnumType type = ViolationEnumType::kNone;
+  uint64_t offset = 0;
+  uint32_t record_num = 0;
+  uint32_t word_num = 0;
+};
+
+/**
+ * DrcViolationSink : write violations to file when they are found, records are buffered by layer and type and flushed by block
+ */
+class DrcViolationSink
+{
+ public:
+  explicit DrcViolationSink(std::string path, uint32_t block_record_num = 4096);
+  ~DrcViolationSink();
+
+  bool is_open() { return _stream.is_open(); }
+  uint64_t get_record_num() { return _record_num; }
+
+  void write(const std::string& layer, ViolationEnumType type, int llx, int lly, int urx, int ury, const std::set<int>& net_ids);
+  void close();
+
+ private:
+  struct BlockBuffer
+  {
+    std::vector<int32_t> words;
+    uint32_t record_num = 0;
+  };
+
+  std::ofstream _stream;
+  uint32_t _block_record_num = 4096;
+  uint64_t _record_num = 0;
+  std::mutex _mutex;
+  std::map<std::pair<std::string, ViolationEnumType>, BlockBuffer> _buffer_map;
+  std::vector<DrcViolationBlock> _block_list;
+
+  void flushBlock(const std::string& layer, ViolationEnumType type, BlockBuffer& buffer);
+};
+
+/**
+ * DrcViolationReader : read the index of a violation file, records are loaded by layer and type on demand
+ */
+class DrcViolationReader
+{
+ public:
+  explicit DrcViolationReader(std::string path);
+  ~DrcViolationReader() = default;
+
+  bool is_open() { return _stream.is_open(); }
+  std::vector<DrcViolationBlock>& get_block_list() { return _block_list; }
+
+  std::map<std::string, std::map<ViolationEnumType, uint64_t>> get_summary();
+  std::vector<DrcViolationRecord> read(const std::string& layer, ViolationEnumType type, uint64_t start = 0, uint64_t max_num = UINT64_MAX);
+
+ private:
+  std::ifstream _stream;
+  std::vector<DrcViolationBlock> _block_list;
+};
+
+}  // namespace idrc
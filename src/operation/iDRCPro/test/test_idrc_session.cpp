@@ -0,0 +1,142 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+/**
+ * drive an incremental session by removing and adding nets, the session result is compared with a full check after each step
+ * usage : test_idrc_session <drc_config.json> [net_step]
+ *  drc_config.json : INPUT section gives tech_lef_path, lef_paths and def_path
+ *  net_step : every net_step-th net is removed and added again, 10 by default
+ */
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "IdbDesign.h"
+#include "IdbNet.h"
+#include "IdbPins.h"
+#include "IdbRegularWire.h"
+#include "idrc_session.h"
+#include "test_idrc_util.h"
+
+using namespace idrc;
+
+std::set<DrcViolationKey> checkFull(std::map<int, std::vector<idb::IdbLayerShape*>>& pin_data,
+                                    std::map<int, std::vector<idb::IdbRegularWireSegment*>>& routing_data)
+{
+  std::vector<idb::IdbLayerShape*> env_shape_list;
+  DrcApi drc_api;
+  auto violation_map = drc_api.check(env_shape_list, pin_data, routing_data);
+  std::set<DrcViolationKey> violation_keys;
+  getViolationKeys(violation_map, violation_keys, true);
+  return violation_keys;
+}
+
+bool compare(std::string title, std::set<DrcViolationKey>& session_keys, std::set<DrcViolationKey>& full_keys)
+{
+  std::cout << title << " : session violations = " << session_keys.size() << " full violations = " << full_keys.size() << std::endl;
+  printViolationDiff("only session", session_keys, full_keys);
+  printViolationDiff("only full", full_keys, session_keys);
+  return session_keys == full_keys;
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc < 2) {
+    std::cout << "usage : test_idrc_session <drc_config.json> [net_step]" << std::endl;
+    return 1;
+  }
+  std::string config_path = argv[1];
+  int net_step = argc > 2 ? std::max(std::stoi(argv[2]), 1) : 10;
+  if (!readDesign(config_path)) {
+    return 1;
+  }
+
+  DrcApi drc_api;
+  drc_api.init(config_path);
+
+  std::map<int, std::vector<idb::IdbLayerShape*>> pin_data;
+  std::map<int, std::vector<idb::IdbRegularWireSegment*>> routing_data;
+  for (auto* idb_net : dmInst->get_idb_design()->get_net_list()->get_net_list()) {
+    auto& pin_shape_list = pin_data[idb_net->get_id()];
+    auto& segment_list = routing_data[idb_net->get_id()];
+    for (auto* idb_pin : idb_net->get_instance_pin_list()->get_pin_list()) {
+      pin_shape_list.insert(pin_shape_list.end(), idb_pin->get_port_box_list().begin(), idb_pin->get_port_box_list().end());
+    }
+    for (auto* idb_wire : idb_net->get_wire_list()->get_wire_list()) {
+      segment_list.insert(segment_list.end(), idb_wire->get_segment_list().begin(), idb_wire->get_segment_list().end());
+    }
+  }
+  std::vector<int> changed_net_ids;
+  int net_idx = 0;
+  for (auto& [net_id, pin_shape_list] : pin_data) {
+    if (net_idx++ % net_step == 0) {
+      changed_net_ids.push_back(net_id);
+    }
+  }
+
+  bool pass = true;
+  DrcSession drc_session;
+  std::set<DrcViolationKey> origin_keys;
+  {
+    for (auto& [net_id, pin_shape_list] : pin_data) {
+      drc_session.updateNet(net_id, pin_shape_list, routing_data[net_id]);
+    }
+    drc_session.check();
+    getViolationKeys(drc_session.get_violation_map(), origin_keys);
+    auto full_keys = checkFull(pin_data, routing_data);
+    pass &= compare("init", origin_keys, full_keys);
+  }
+  // removed nets mark their region dirty, only the cleared violations and new violations of the region are reported
+  std::set<DrcViolationKey> cleared_keys;
+  {
+    auto removed_pin_data = pin_data;
+    auto removed_routing_data = routing_data;
+    for (int net_id : changed_net_ids) {
+      drc_session.removeNet(net_id);
+      removed_pin_data.erase(net_id);
+      removed_routing_data.erase(net_id);
+    }
+    auto result = drc_session.check();
+    getViolationKeys(result.cleared_violation_map, cleared_keys, true);
+    std::set<DrcViolationKey> session_keys;
+    getViolationKeys(drc_session.get_violation_map(), session_keys);
+    auto full_keys = checkFull(removed_pin_data, removed_routing_data);
+    pass &= compare("remove " + std::to_string(changed_net_ids.size()) + " nets", session_keys, full_keys);
+  }
+  // adding the nets again restores the origin result, the new violations are exactly the cleared ones
+  {
+    for (int net_id : changed_net_ids) {
+      drc_session.updateNet(net_id, pin_data[net_id], routing_data[net_id]);
+    }
+    auto result = drc_session.check();
+    std::set<DrcViolationKey> new_keys;
+    getViolationKeys(result.new_violation_map, new_keys);
+    std::set<DrcViolationKey> readded_cleared_keys;
+    getViolationKeys(result.cleared_violation_map, readded_cleared_keys, true);
+    std::set<DrcViolationKey> session_keys;
+    getViolationKeys(drc_session.get_violation_map(), session_keys);
+    pass &= compare("add nets again", session_keys, origin_keys);
+    pass &= compare("new against cleared", new_keys, cleared_keys);
+    pass &= readded_cleared_keys.empty();
+  }
+
+  drc_api.exit();
+
+  std::cout << "test_idrc_session " << (pass ? "passed" : "failed") << std::endl;
+  return pass ? 0 : 1;
+}
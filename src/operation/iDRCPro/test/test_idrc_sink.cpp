@@ -0,0 +1,105 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+/**
+ * write violations of one design by violation file and read them back, compare with violations returned in memory
+ * usage : test_idrc_sink <drc_config.json> [violation_file]
+ *  drc_config.json : INPUT section gives tech_lef_path, lef_paths and def_path
+ *  violation_file : file written by sink, default is ./test_idrc_sink.bin
+ */
+#include <iostream>
+#include <set>
+#include <string>
+
+#include "idrc_config.h"
+#include "idrc_violation_sink.h"
+#include "test_idrc_util.h"
+
+using namespace idrc;
+
+std::set<DrcViolationKey> readViolationFile(std::string violation_file, bool& is_valid)
+{
+  std::set<DrcViolationKey> violation_keys;
+  DrcViolationReader reader(violation_file);
+  is_valid = reader.is_open();
+  for (auto& [layer, type_num_map] : reader.get_summary()) {
+    for (auto& [type, record_num] : type_num_map) {
+      auto record_list = reader.read(layer, type);
+      if (record_list.size() != record_num) {
+        std::cout << "[Error] " << layer << " " << GetViolationTypeName()(type) << " : " << record_list.size() << " records read, "
+                  << record_num << " in index" << std::endl;
+        is_valid = false;
+      }
+      for (auto& record : record_list) {
+        violation_keys.emplace((int) type, layer, record.llx, record.lly, record.urx, record.ury);
+      }
+    }
+  }
+  return violation_keys;
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc < 2) {
+    std::cout << "usage : test_idrc_sink <drc_config.json> [violation_file]" << std::endl;
+    return 1;
+  }
+  std::string config_path = argv[1];
+  std::string violation_file = argc > 2 ? argv[2] : "./test_idrc_sink.bin";
+  if (!readDesign(config_path)) {
+    return 1;
+  }
+
+  DrcApi drc_api;
+  drc_api.init(config_path);
+  DrcConfigInst->set_max_violation_num(0);
+
+  /// violations in memory
+  DrcConfigInst->set_violation_file("");
+  auto memory_map = drc_api.checkDef();
+  std::set<DrcViolationKey> memory_keys;
+  getViolationKeys(memory_map, memory_keys, true);
+
+  /// violations written by sink, nothing is returned
+  DrcConfigInst->set_violation_file(violation_file);
+  auto sink_map = drc_api.checkDef();
+  bool is_sink_empty = sink_map.empty();
+  std::set<DrcViolationKey> returned_keys;
+  getViolationKeys(sink_map, returned_keys, true);
+
+  bool is_valid = false;
+  auto file_keys = readViolationFile(violation_file, is_valid);
+
+  /// check for RT ignores violation file
+  std::vector<idb::IdbLayerShape*> env_shape_list;
+  std::map<int, std::vector<idb::IdbLayerShape*>> pin_data;
+  std::map<int, std::vector<idb::IdbRegularWireSegment*>> routing_data;
+  auto check_map = drc_api.check(env_shape_list, pin_data, routing_data);
+  std::set<DrcViolationKey> check_keys;
+  getViolationKeys(check_map, check_keys, true);
+
+  std::cout << "memory : violations = " << memory_keys.size() << std::endl;
+  std::cout << "file : violations = " << file_keys.size() << std::endl;
+  std::cout << "check : violations = " << check_keys.size() << std::endl;
+  printViolationDiff("only memory", memory_keys, file_keys);
+  printViolationDiff("only file", file_keys, memory_keys);
+
+  drc_api.exit();
+
+  bool pass = is_valid && is_sink_empty && memory_keys == file_keys && memory_keys == check_keys;
+  std::cout << "test_idrc_sink " << (pass ? "passed" : "failed") << std::endl;
+  return pass ? 0 : 1;
+}
@@ -0,0 +1,82 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+/**
+ * compare violations and runtime of single thread and multi thread check on one design
+ * usage : test_idrc_thread <drc_config.json> [thread_number]
+ *  drc_config.json : INPUT section gives tech_lef_path, lef_paths and def_path, PARAMETER section gives tile_size and thread_number
+ *  thread_number : overrides thread_number of drc_config.json
+ */
+#include <chrono>
+#include <iostream>
+#include <set>
+#include <string>
+
+#include "idrc_config.h"
+#include "test_idrc_util.h"
+
+using namespace idrc;
+
+std::set<DrcViolationKey> checkDef(int thread_number, double& runtime)
+{
+  DrcConfigInst->set_thread_number(thread_number);
+
+  auto start = std::chrono::steady_clock::now();
+  DrcApi drc_api;
+  auto violation_map = drc_api.checkDef();
+  runtime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  std::set<DrcViolationKey> violation_keys;
+  getViolationKeys(violation_map, violation_keys, true);
+  return violation_keys;
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc < 2) {
+    std::cout << "usage : test_idrc_thread <drc_config.json> [thread_number]" << std::endl;
+    return 1;
+  }
+  std::string config_path = argv[1];
+  if (!readDesign(config_path)) {
+    return 1;
+  }
+
+  DrcApi drc_api;
+  drc_api.init(config_path);
+  int thread_number = argc > 2 ? std::stoi(argv[2]) : DrcConfigInst->get_thread_number();
+  if (thread_number <= 1) {
+    std::cout << "[Error] thread_number should be greater than 1 : " << thread_number << std::endl;
+    return 1;
+  }
+
+  double single_runtime = 0;
+  double multi_runtime = 0;
+  auto single_keys = checkDef(1, single_runtime);
+  auto multi_keys = checkDef(thread_number, multi_runtime);
+  std::cout << "1 thread : violations = " << single_keys.size() << " runtime = " << single_runtime << "s" << std::endl;
+  std::cout << thread_number << " threads : violations = " << multi_keys.size() << " runtime = " << multi_runtime << "s" << std::endl;
+  std::cout << "speedup = " << (multi_runtime > 0 ? single_runtime / multi_runtime : 0) << std::endl;
+
+  printViolationDiff("only 1 thread", single_keys, multi_keys);
+  printViolationDiff("only " + std::to_string(thread_number) + " threads", multi_keys, single_keys);
+
+  drc_api.exit();
+
+  bool pass = single_keys == multi_keys;
+  std::cout << "test_idrc_thread " << (pass ? "passed" : "failed") << std::endl;
+  return pass ? 0 : 1;
+}
@@ -0,0 +1,69 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+/**
+ * compare violations of tiled and untiled layout filtering on one design
+ * usage : test_idrc_tile <drc_config.json> <tile_size>
+ *  drc_config.json : INPUT section gives tech_lef_path, lef_paths and def_path, PARAMETER section gives thread_number
+ */
+#include <iostream>
+#include <set>
+#include <string>
+
+#include "idrc_config.h"
+#include "test_idrc_util.h"
+
+using namespace idrc;
+
+std::set<DrcViolationKey> checkDef(int tile_size)
+{
+  DrcConfigInst->set_tile_size(tile_size);
+
+  DrcApi drc_api;
+  auto violation_map = drc_api.checkDef();
+  std::set<DrcViolationKey> violation_keys;
+  getViolationKeys(violation_map, violation_keys, true);
+  return violation_keys;
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc < 3) {
+    std::cout << "usage : test_idrc_tile <drc_config.json> <tile_size>" << std::endl;
+    return 1;
+  }
+  std::string config_path = argv[1];
+  int tile_size = std::stoi(argv[2]);
+  if (!readDesign(config_path)) {
+    return 1;
+  }
+
+  DrcApi drc_api;
+  drc_api.init(config_path);
+
+  auto untiled_keys = checkDef(0);
+  auto tiled_keys = checkDef(tile_size);
+  std::cout << "untiled violations = " << untiled_keys.size() << " tiled violations = " << tiled_keys.size() << std::endl;
+
+  printViolationDiff("only untiled", untiled_keys, tiled_keys);
+  printViolationDiff("only tiled", tiled_keys, untiled_keys);
+
+  drc_api.exit();
+
+  bool pass = untiled_keys == tiled_keys;
+  std::cout << "test_idrc_tile " << (pass ? "passed" : "failed") << std::endl;
+  return pass ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#pragma once
+
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "IdbLayer.h"
+#include "idm.h"
+#include "idrc_api.h"
+#include "json/json.hpp"
+
+namespace idrc {
+
+using DrcViolationKey = std::tuple<int, std::string, int, int, int, int>;
+using DrcViolationMap = std::map<ViolationEnumType, std::vector<DrcViolation*>>;
+
+/**
+ * read lef and def given by the INPUT section of drc json config
+ */
+inline bool readDesign(std::string config_path)
+{
+  std::ifstream config_stream(config_path);
+  if (!config_stream.is_open()) {
+    std::cout << "[Error] Failed to open drc config '" << config_path << "'!" << std::endl;
+    return false;
+  }
+  nlohmann::json json;
+  config_stream >> json;
+  auto& input = json["INPUT"];
+
+  std::vector<std::string> lef_paths;
+  if (input["lef_paths"].is_array()) {
+    for (auto& lef_path : input["lef_paths"]) {
+      lef_paths.push_back(lef_path.get<std::string>());
+    }
+  } else if (input["lef_paths"].is_string() && !input["lef_paths"].get<std::string>().empty()) {
+    lef_paths.push_back(input["lef_paths"].get<std::string>());
+  }
+  return dmInst->readLef(std::vector<std::string>{input["tech_lef_path"].get<std::string>()}, true) && dmInst->readLef(lef_paths)
+         && dmInst->readDef(input["def_path"].get<std::string>());
+}
+
+/**
+ * key of rect violations, violations are deleted if is_deleted is true
+ */
+inline void getViolationKeys(DrcViolationMap& violation_map, std::set<DrcViolationKey>& violation_keys, bool is_deleted = false)
+{
+  for (auto& [type, violation_list] : violation_map) {
+    for (auto* violation : violation_list) {
+      if (violation->get_type() == Type::kRect) {
+        auto* violation_rect = static_cast<DrcViolationRect*>(violation);
+        violation_keys.emplace((int) type, violation_rect->get_layer()->get_name(), violation_rect->get_llx(), violation_rect->get_lly(),
+                               violation_rect->get_urx(), violation_rect->get_ury());
+      }
+      if (is_deleted) {
+        delete violation;
+      }
+    }
+  }
+  if (is_deleted) {
+    violation_map.clear();
+  }
+}
+
+/**
+ * print violations in violation_keys but not in other_keys
+ */
+inline void printViolationDiff(std::string title, std::set<DrcViolationKey>& violation_keys, std::set<DrcViolationKey>& other_keys)
+{
+  for (auto& key : violation_keys) {
+    if (other_keys.contains(key)) {
+      continue;
+    }
+    auto& [type, layer, llx, lly, urx, ury] = key;
+    std::cout << "  " << title << " : " << GetViolationTypeName()((ViolationEnumType) type) << " " << layer << " (" << llx << ", " << lly
+              << ") (" << urx << ", " << ury << ")" << std::endl;
+  }
+}
+
+}  // namespace idrc
@@ -449,10 +449,15 @@ void PLAPI::runFlow()
   writeBackSourceDataBase();
 }
 
-void PLAPI::insertLayoutFiller()
+void PLAPI::insertLayoutFiller(bool is_incremental)
 {
   notifyPLOriginInfo();
-  MapFiller(&PlacerDBInst, PlacerDBInst.get_placer_config()).mapFillerCell();
+  MapFiller map_filler(&PlacerDBInst, PlacerDBInst.get_placer_config());
+  if (is_incremental) {
+    map_filler.mapFillerCellIncremental();
+  } else {
+    map_filler.mapFillerCell();
+  }
   PlacerDBInst.updateGridManager();
   _reporter->reportEDAFillerEvaluation();
   reportPLInfo();
@@ -476,6 +481,17 @@ void PLAPI::runGP()
   nesterov_place.runNesterovPlace();
 }
 
+void PLAPI::resumeGP(std::string checkpoint_path)
+{
+  RandomPlace(&PlacerDBInst).runRandomPlace();
+  NesterovPlace nesterov_place(PlacerDBInst.get_placer_config(), &PlacerDBInst);
+  nesterov_place.printNesterovDatabase();
+  if (!nesterov_place.resumeNesterovPlace(checkpoint_path)) {
+    LOG_WARNING << "Restart global placement from initial placement.";
+    nesterov_place.runNesterovPlace();
+  }
+}
+
 bool PLAPI::runLG()
 {
   LegalizerInst.initLegalizer(PlacerDBInst.get_placer_config(), &PlacerDBInst);
@@ -46,9 +46,11 @@ class PLAPI
   void initAPI(std::string pl_json_path, idb::IdbBuilder* idb_builder);
   void runFlow();
   void runIncrementalFlow();
-  void insertLayoutFiller();
+  void insertLayoutFiller(bool is_incremental = false);
 
   void runGP();
+  // resume global placement from a checkpoint, empty path means the configured one.
+  void resumeGP(std::string checkpoint_path = "");
   void runMP();
   void runNetworkFlowSpread();
 
@@ -402,6 +402,16 @@ namespace ipl {
     _db_wrapper->updateFromSourceDataBase(inst_list);
   }
 
+  void PlacerDB::deleteInstances(std::vector<Instance*> inst_list)
+  {
+    if (inst_list.empty()) {
+      return;
+    }
+    _db_wrapper->deleteInstances(inst_list);
+    // group ids follow the renumbered instance ids.
+    initTopoManager();
+  }
+
   void PlacerDB::updateInstancesForDebug(std::vector<Instance*> inst_list)
   {
     auto* design = this->get_design();
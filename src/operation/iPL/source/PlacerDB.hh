@@ -83,6 +83,7 @@ class PlacerDB
   void saveVerilogForDebug(std::string path);
 
   void writeBackSourceDataBase() { _db_wrapper->writeBackSourceDatabase(); }
+  void deleteInstances(std::vector<Instance*> inst_list);
   void writeDef(std::string file_name) { _db_wrapper->writeDef(file_name); }
 
   bool isInitialized() { return _db_wrapper != nullptr; }
@@ -79,6 +79,29 @@ void Config::initConfigByJson(nlohmann::json json)
   float min_precondition = getDataByJson(json, {"PL", "GP", "Nesterov", "min_precondition"});
   float min_phi_coef = getDataByJson(json, {"PL", "GP", "Nesterov", "min_phi_coef"});
   float max_phi_coef = getDataByJson(json, {"PL", "GP", "Nesterov", "max_phi_coef"});
+  // checkpoint keys are optional, configs without them run with checkpoint disabled.
+  int32_t checkpoint_interval = 0;
+  std::string checkpoint_path;
+  const auto& nesterov_json = json["PL"]["GP"]["Nesterov"];
+  if (nesterov_json.contains("checkpoint_interval")) {
+    checkpoint_interval = nesterov_json["checkpoint_interval"];
+  }
+  if (nesterov_json.contains("checkpoint_path")) {
+    checkpoint_path = nesterov_json["checkpoint_path"];
+  }
+
+  // routability keys are optional as well, the mode is off without them.
+  int32_t routability_interval = 0;
+  float max_inflation_ratio = 2.5F;
+  if (json["PL"]["GP"].contains("Routability")) {
+    const auto& routability_json = json["PL"]["GP"]["Routability"];
+    if (routability_json.contains("pattern_route_interval")) {
+      routability_interval = routability_json["pattern_route_interval"];
+    }
+    if (routability_json.contains("max_inflation_ratio")) {
+      max_inflation_ratio = routability_json["max_inflation_ratio"];
+    }
+  }
 
   // Buffer
   int32_t max_buffer_num = getDataByJson(json, {"PL", "BUFFER", "max_buffer_num"});
@@ -158,6 +181,10 @@ void Config::initConfigByJson(nlohmann::json json)
   _nes_config.set_min_precondition(min_precondition);
   _nes_config.set_min_phi_coef(min_phi_coef);
   _nes_config.set_max_phi_coef(max_phi_coef);
+  _nes_config.set_checkpoint_interval(checkpoint_interval);
+  _nes_config.set_checkpoint_path(checkpoint_path);
+  _nes_config.set_routability_interval(routability_interval);
+  _nes_config.set_max_inflation_ratio(max_inflation_ratio);
   if (is_max_length_opt) {
     _nes_config.set_is_opt_max_wirelength(true);
     _nes_config.set_max_net_wirelength(max_length_constraint);
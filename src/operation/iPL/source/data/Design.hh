@@ -30,6 +30,7 @@
 #include <algorithm>
 #include <map>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "Instance.hh"
@@ -64,6 +65,8 @@ class Design
   // setter.
   void set_design_name(std::string design_name) { _design_name = std::move(design_name); }
   void add_instance(Instance* inst);
+  void add_instance_list(const std::vector<Instance*>& inst_list);
+  void remove_instance_list(const std::vector<Instance*>& inst_list);
   void add_net(Net* net);
   void add_pin(Pin* pin);
   void add_region(Region* region);
@@ -137,6 +140,32 @@ inline void Design::add_instance(Instance* inst)
   _instances_range += 1;
 }
 
+inline void Design::add_instance_list(const std::vector<Instance*>& inst_list)
+{
+  _instance_list.reserve(_instance_list.size() + inst_list.size());
+  for (Instance* inst : inst_list) {
+    add_instance(inst);
+  }
+}
+
+// the removed instances are not deleted, ids of the remaining instances are renumbered in list order.
+inline void Design::remove_instance_list(const std::vector<Instance*>& inst_list)
+{
+  std::unordered_set<Instance*> remove_set(inst_list.begin(), inst_list.end());
+  std::vector<Instance*> new_inst_list;
+  new_inst_list.reserve(_instance_list.size());
+  for (Instance* inst : _instance_list) {
+    if (remove_set.contains(inst)) {
+      _name_to_inst_map.erase(inst->get_name());
+      continue;
+    }
+    inst->set_inst_id(static_cast<int32_t>(new_inst_list.size()));
+    new_inst_list.push_back(inst);
+  }
+  _instance_list = std::move(new_inst_list);
+  _instances_range = static_cast<int32_t>(_instance_list.size());
+}
+
 inline void Design::add_net(Net* net)
 {
   _net_list.push_back(net);
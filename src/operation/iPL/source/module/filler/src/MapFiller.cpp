@@ -24,9 +24,11 @@
 
 #include "MapFiller.h"
 
+#include <algorithm>
+#include <charconv>
 #include <map>
-#include <set>
 #include <string>
+#include <unordered_set>
 
 namespace ipl {
 
@@ -46,8 +48,29 @@ void MapFiller::addFillerCellWithGroups()
           blockage_list.push_back(Rectangle<int32_t>(lx, ly, ux, uy));
         }
       }
+      // fillers of the former groups are blockages, fillers of the current group are compared with the new fill.
+      std::vector<Instance*> old_filler_list;
+      if (_is_incremental) {
+        for (Instance* inst : _pl_design->get_instance_list()) {
+          int32_t group_idx = getFillerGroupIdx(inst);
+          if (group_idx < 0 || group_idx > _group_idx) {
+            continue;
+          }
+          int32_t lx = inst->get_coordi().get_x() - _pl_layout->get_core_shape().get_ll_x() - rect.get_ll_x();
+          int32_t ly = inst->get_coordi().get_y() - _pl_layout->get_core_shape().get_ll_y() - rect.get_ll_y();
+          if (lx < 0 || ly < 0 || lx >= rect.get_width() || ly >= rect.get_height()) {
+            continue;
+          }
+          if (group_idx == _group_idx) {
+            old_filler_list.push_back(inst);
+          } else {
+            blockage_list.push_back(Rectangle<int32_t>(lx, ly, lx + inst->get_shape_width(), ly + inst->get_shape_height()));
+          }
+        }
+      }
       // Rectangle<int32_t> region_rect(0, 0, rect.get_width(), rect.get_height());
       reset(rect, blockage_list);
+      _old_filler_list = std::move(old_filler_list);
       addFillerCell();
     }
   }
@@ -55,17 +78,42 @@ void MapFiller::addFillerCellWithGroups()
 
 void MapFiller::addFillerCellWithoutGroups()
 {
-  std::vector<Rectangle<int32_t>> blockage_list;
-  std::set<Instance*> can_cells;
-  for (auto inst : _pl_design->get_instance_list()) {
-    can_cells.insert(inst);
-  }
+  std::unordered_set<Instance*> region_inst_set;
   for (auto region : _pl_design->get_region_list()) {
     for (Instance* inst : region->get_instances()) {
-      can_cells.erase(inst);
+      region_inst_set.insert(inst);
     }
   }
-  for (Instance* inst : can_cells) {
+  auto is_in_region = [&](Instance* inst) {
+    for (auto region : _pl_design->get_region_list()) {
+      for (Rectangle<int32_t>& rect : region->get_boundaries()) {
+        int32_t x = inst->get_coordi().get_x();
+        int32_t y = inst->get_coordi().get_y();
+        if (x >= rect.get_ll_x() && x < rect.get_ur_x() && y >= rect.get_ll_y() && y < rect.get_ur_y()) {
+          return true;
+        }
+      }
+    }
+    return false;
+  };
+  auto inst_list = _pl_design->get_instance_list();
+  std::vector<Rectangle<int32_t>> blockage_list;
+  std::vector<Instance*> old_filler_list;
+  blockage_list.reserve(inst_list.size());
+  for (Instance* inst : inst_list) {
+    if (region_inst_set.find(inst) != region_inst_set.end()) {
+      continue;
+    }
+    // fillers of the former groups are blockages, fillers of the current group are compared with the new fill.
+    if (_is_incremental) {
+      int32_t group_idx = getFillerGroupIdx(inst);
+      if (group_idx == _group_idx && !is_in_region(inst)) {
+        old_filler_list.push_back(inst);
+      }
+      if (group_idx >= _group_idx) {
+        continue;
+      }
+    }
     int32_t lx = inst->get_coordi().get_x() - _pl_layout->get_core_shape().get_ll_x();
     int32_t ly = inst->get_coordi().get_y() - _pl_layout->get_core_shape().get_ll_y();
     int32_t ux = inst->get_coordi().get_x() + inst->get_shape_width() - _pl_layout->get_core_shape().get_ll_x();
@@ -81,6 +129,7 @@ void MapFiller::addFillerCellWithoutGroups()
   }
   Rectangle<int32_t> core(0, 0, _pl_layout->get_core_shape().get_width(), _pl_layout->get_core_shape().get_height());
   reset(core, blockage_list);
+  _old_filler_list = std::move(old_filler_list);
   addFillerCell();
 }
 
@@ -95,8 +144,12 @@ bool MapFiller::isInstInside(Instance* inst, Rectangle<int32_t> rect)
 
 void MapFiller::fixed_cell_assign()
 {
-  std::vector<std::vector<bool>> grid_list(_row_count, std::vector<bool>(_row_site_count, true));
-  for (auto& rect : _blockage_list) {
+  // bucket the blocked site intervals by row, then sort and sweep each row to obtain the gaps.
+  std::vector<FillerSegment> x_range_list(_blockage_list.size());
+  std::vector<FillerSegment> y_range_list(_blockage_list.size());
+  std::vector<int32_t> row_offset(_row_count + 1, 0);
+  for (size_t k = 0; k < _blockage_list.size(); ++k) {
+    auto& rect = _blockage_list[k];
     int32_t x_site_start = rect.get_ll_x() / _site_width;
     int32_t x_site_end = rect.get_ur_x() / _site_width - 1;
     if (rect.get_ur_x() % _site_width != 0) {
@@ -112,31 +165,46 @@ void MapFiller::fixed_cell_assign()
     x_site_end = std::min(x_site_end, _row_site_count - 1);
     y_row_end = std::min(y_row_end, _row_count - 1);
 
+    x_range_list[k] = {x_site_start, x_site_end};
+    y_range_list[k] = {y_row_start, y_row_end};
+    if (x_site_start > x_site_end) {
+      continue;
+    }
     for (int32_t yy = y_row_start; yy <= y_row_end; ++yy) {
-      for (int32_t xx = x_site_start; xx <= x_site_end; ++xx) {
-        grid_list[yy][xx] = false;
-      }
+      row_offset[yy + 1]++;
     }
   }
   for (int32_t i = 0; i < _row_count; i++) {
-    int32_t l = -1;
-    bool last = false;
-    for (int32_t j = 0; j < _row_site_count; j++) {
-      bool pixel = grid_list[i][j];
-      if (pixel) {
-        if (!last) {
-          l = j;
-        }
-        last = true;
-      } else {
-        if (last) {
-          _available_sites[i].push_back({l, j - 1});
-        }
-        last = false;
+    row_offset[i + 1] += row_offset[i];
+  }
+
+  std::vector<FillerSegment> row_blocked_list(row_offset[_row_count]);
+  std::vector<int32_t> row_fill_index(row_offset.begin(), row_offset.end() - 1);
+  for (size_t k = 0; k < _blockage_list.size(); ++k) {
+    if (x_range_list[k].l > x_range_list[k].r) {
+      continue;
+    }
+    for (int32_t yy = y_range_list[k].l; yy <= y_range_list[k].r; ++yy) {
+      row_blocked_list[row_fill_index[yy]++] = x_range_list[k];
+    }
+  }
+
+#pragma omp parallel for num_threads(_thread_num) schedule(dynamic, 64)
+  for (int32_t i = 0; i < _row_count; i++) {
+    auto row_begin = row_blocked_list.begin() + row_offset[i];
+    auto row_end = row_blocked_list.begin() + row_offset[i + 1];
+    std::sort(row_begin, row_end);
+
+    auto& row_sites = _available_sites[i];
+    int32_t l = 0;
+    for (auto iter = row_begin; iter != row_end; ++iter) {
+      if (iter->l > l) {
+        row_sites.push_back({l, iter->l - 1});
       }
+      l = std::max(l, iter->r + 1);
     }
-    if (last) {
-      _available_sites[i].push_back({l, _row_site_count - 1});
+    if (l <= _row_site_count - 1) {
+      row_sites.push_back({l, _row_site_count - 1});
     }
   }
 }
@@ -153,53 +221,201 @@ void MapFiller::findFillerMaster(std::vector<std::string> filler_name_list)
   }
   sort(_filler_master_list.begin(), _filler_master_list.end(),
        [&](Cell* cell_a, Cell* cell_b) { return cell_a->get_width() > cell_b->get_width(); });
+  _filler_master_map.clear();
+  for (size_t i = 0; i < _filler_master_list.size(); i++) {
+    _filler_master_map.emplace(_filler_master_list[i], static_cast<int32_t>(i));
+  }
   _filler_count.resize(_filler_master_list.size());
+  if (_is_incremental) {
+    initFillerCount();
+  }
 }
 
-void MapFiller::addFillerCell()
+void MapFiller::initRowOrient()
 {
-  init();
+  _row_orient_list.resize(_row_count);
   for (int32_t i = 0; i < _row_count; i++) {
-    for (FillerSegment& seg : _available_sites[i]) {
-      int32_t& left = seg.l;
-      int32_t& right = seg.r;
-      while (right - left + 1 >= _min_filler_width) {
-        int32_t wspace_width = right - left + 1;
-        int32_t flag = 0;
-        bool added = false;
-        for (auto filler_master : _filler_master_list) {
-          int32_t filler_width = filler_master->get_width() / _site_width;
-          if (wspace_width - filler_width < _min_filler_width && wspace_width - filler_width != 0)
-            continue;
-          if (filler_width <= wspace_width) {
-            int32_t count = _filler_count[flag]++;
-            std::string filler_name = filler_master->get_name() + "_" + std::to_string(count);
-            int32_t inst_x = left * _site_width + _region.get_ll_x() + _pl_layout->get_core_shape().get_ll_x();
-            int32_t inst_y = i * _row_height + _region.get_ll_y() + _pl_layout->get_core_shape().get_ll_y();
-            add_filler_instance(inst_x, inst_y, filler_name, filler_master);
-            left += filler_width;
-            added = true;
-          }
-          if (added)
-            break;
-          flag++;
+    int32_t inst_y = i * _row_height + _region.get_ll_y() + _pl_layout->get_core_shape().get_ll_y();
+    auto iter = _orient_map.find(inst_y);
+    _row_orient_list[i] = (iter != _orient_map.end()) ? iter->second : Orient();
+  }
+}
+
+void MapFiller::initFillerCount()
+{
+  // continue the name index of the fillers inserted by the last fill.
+  for (auto* inst : _pl_design->get_instance_list()) {
+    auto iter = _filler_master_map.find(inst->get_cell_master());
+    if (iter == _filler_master_map.end()) {
+      continue;
+    }
+    std::string prefix = iter->first->get_name() + "_";
+    const std::string& inst_name = inst->get_name();
+    if (inst_name.size() <= prefix.size() || inst_name.compare(0, prefix.size(), prefix) != 0) {
+      continue;
+    }
+    // names whose suffix is not a whole non-negative int32 index are not fillers numbered by MapFiller.
+    int32_t index = 0;
+    const char* index_end = inst_name.data() + inst_name.size();
+    auto [ptr, ec] = std::from_chars(inst_name.data() + prefix.size(), index_end, index);
+    if (ec != std::errc() || ptr != index_end || index < 0 || index == INT32_MAX) {
+      continue;
+    }
+    int32_t& count = _filler_count[iter->second];
+    count = std::max(count, index + 1);
+  }
+}
+
+void MapFiller::initFillerGroup()
+{
+  // a filler master belongs to the first group listing it.
+  std::unordered_map<std::string, int32_t> name_to_group_map;
+  for (size_t i = 0; i < _filler_group_list.size(); i++) {
+    for (auto& filler_name : _filler_group_list[i]) {
+      name_to_group_map.emplace(filler_name, static_cast<int32_t>(i));
+    }
+  }
+  _filler_group_map.clear();
+  for (auto* cell : _pl_layout->get_cell_list()) {
+    auto iter = name_to_group_map.find(cell->get_name());
+    if (iter != name_to_group_map.end()) {
+      _filler_group_map.emplace(cell, iter->second);
+    }
+  }
+}
+
+int32_t MapFiller::getFillerGroupIdx(Instance* inst)
+{
+  auto iter = _filler_group_map.find(inst->get_cell_master());
+  return iter != _filler_group_map.end() ? iter->second : -1;
+}
+
+void MapFiller::planRowFiller(int32_t row_idx)
+{
+  auto& row_plan = _row_plan_list[row_idx];
+  for (FillerSegment seg : _available_sites[row_idx]) {
+    int32_t left = seg.l;
+    int32_t right = seg.r;
+    while (right - left + 1 >= _min_filler_width) {
+      int32_t wspace_width = right - left + 1;
+      int32_t flag = 0;
+      bool added = false;
+      for (auto filler_master : _filler_master_list) {
+        int32_t filler_width = filler_master->get_width() / _site_width;
+        if (wspace_width - filler_width < _min_filler_width && wspace_width - filler_width != 0)
+          continue;
+        if (filler_width <= wspace_width) {
+          row_plan.push_back({left, flag});
+          left += filler_width;
+          added = true;
         }
-        if (!added)
+        if (added)
           break;
+        flag++;
       }
+      if (!added)
+        break;
     }
   }
 }
 
-void MapFiller::add_filler_instance(int32_t inst_x, int32_t inst_y, std::string filler_name, Cell* filler_master)
+void MapFiller::keepCleanRowFiller()
+{
+  int32_t origin_x = _region.get_ll_x() + _pl_layout->get_core_shape().get_ll_x();
+  int32_t origin_y = _region.get_ll_y() + _pl_layout->get_core_shape().get_ll_y();
+  std::vector<std::vector<Instance*>> row_filler_list(_row_count);
+  for (Instance* inst : _old_filler_list) {
+    int32_t row_idx = (inst->get_coordi().get_y() - origin_y) / _row_height;
+    row_filler_list[std::clamp(row_idx, 0, _row_count - 1)].push_back(inst);
+  }
+
+  // a row is clean if its fillers are the same as the new plan, clean rows keep their fillers and are not refilled.
+  std::vector<char> dirty_list(_row_count, 0);
+#pragma omp parallel for num_threads(_thread_num) schedule(dynamic, 64)
+  for (int32_t i = 0; i < _row_count; i++) {
+    auto& filler_list = row_filler_list[i];
+    std::sort(filler_list.begin(), filler_list.end(),
+              [](Instance* a, Instance* b) { return a->get_coordi().get_x() < b->get_coordi().get_x(); });
+    auto& row_plan = _row_plan_list[i];
+    bool is_dirty = filler_list.size() != row_plan.size();
+    for (size_t k = 0; !is_dirty && k < filler_list.size(); k++) {
+      Instance* inst = filler_list[k];
+      is_dirty = inst->get_coordi().get_x() != row_plan[k].site_x * _site_width + origin_x
+                 || inst->get_coordi().get_y() != i * _row_height + origin_y
+                 || inst->get_cell_master() != _filler_master_list[row_plan[k].master_idx] || inst->get_orient() != _row_orient_list[i];
+    }
+    if (!is_dirty) {
+      row_plan.clear();
+    }
+    dirty_list[i] = is_dirty;
+  }
+
+  std::vector<Instance*> remove_list;
+  for (int32_t i = 0; i < _row_count; i++) {
+    if (dirty_list[i]) {
+      _touched_row_num++;
+      remove_list.insert(remove_list.end(), row_filler_list[i].begin(), row_filler_list[i].end());
+    }
+  }
+  _removed_inst_num += static_cast<int32_t>(remove_list.size());
+  _old_filler_list.clear();
+  _placer_db->deleteInstances(remove_list);
+}
+
+void MapFiller::addFillerCell()
+{
+  init();
+  initRowOrient();
+  _row_plan_list.assign(_row_count, std::vector<FillerPlan>());
+
+#pragma omp parallel for num_threads(_thread_num) schedule(dynamic, 64)
+  for (int32_t i = 0; i < _row_count; i++) {
+    planRowFiller(i);
+  }
+  if (_is_incremental) {
+    keepCleanRowFiller();
+  }
+
+  // filler names are numbered in row order, so the result is independent of the thread num.
+  size_t master_num = _filler_master_list.size();
+  std::vector<int32_t> row_count_start(_row_count * master_num);
+  std::vector<size_t> row_inst_offset(_row_count + 1, 0);
+  for (int32_t i = 0; i < _row_count; i++) {
+    std::copy(_filler_count.begin(), _filler_count.end(), row_count_start.begin() + i * master_num);
+    for (auto& plan : _row_plan_list[i]) {
+      _filler_count[plan.master_idx]++;
+    }
+    row_inst_offset[i + 1] = row_inst_offset[i] + _row_plan_list[i].size();
+    if (!_is_incremental && !_row_plan_list[i].empty()) {
+      _touched_row_num++;
+    }
+  }
+
+  _filler_inst_list.assign(row_inst_offset[_row_count], nullptr);
+#pragma omp parallel for num_threads(_thread_num) schedule(dynamic, 64)
+  for (int32_t i = 0; i < _row_count; i++) {
+    std::vector<int32_t> count_list(row_count_start.begin() + i * master_num, row_count_start.begin() + (i + 1) * master_num);
+    int32_t inst_y = i * _row_height + _region.get_ll_y() + _pl_layout->get_core_shape().get_ll_y();
+    size_t inst_idx = row_inst_offset[i];
+    for (auto& plan : _row_plan_list[i]) {
+      Cell* filler_master = _filler_master_list[plan.master_idx];
+      std::string filler_name = filler_master->get_name() + "_" + std::to_string(count_list[plan.master_idx]++);
+      int32_t inst_x = plan.site_x * _site_width + _region.get_ll_x() + _pl_layout->get_core_shape().get_ll_x();
+      _filler_inst_list[inst_idx++] = add_filler_instance(inst_x, inst_y, filler_name, filler_master, _row_orient_list[i]);
+    }
+  }
+  _pl_design->add_instance_list(_filler_inst_list);
+  _filler_inst_list.clear();
+}
+
+Instance* MapFiller::add_filler_instance(int32_t inst_x, int32_t inst_y, std::string filler_name, Cell* filler_master, Orient orient)
 {
   Instance* new_inst = new Instance(filler_name);
   new_inst->update_coordi(inst_x, inst_y);
   new_inst->set_cell_master(filler_master);
-  Orient orient = _orient_map[inst_y];
   new_inst->set_orient(orient);
   new_inst->set_instance_state(INSTANCE_STATE::kPlaced);
-  _pl_design->add_instance(new_inst);
+  return new_inst;
 }
 
 // void MapFiller::writefiller_to_ipl()
@@ -231,7 +447,9 @@ void MapFiller::clear()
   for (auto& row_sites : _available_sites) {
     row_sites.clear();
   }
+  _row_plan_list.clear();
   _blockage_list.clear();
+  _old_filler_list.clear();
 }
 
 void MapFiller::reset(Rectangle<int32_t> region, std::vector<Rectangle<int32_t>> blockage_list)
@@ -250,7 +468,14 @@ void MapFiller::writeBack()
 // main
 void MapFiller::mapFillerCell()
 {
-  for (auto filler_name_list : _filler_group_list) {
+  int32_t origin_inst_num = _pl_design->get_instances_range();
+  _touched_row_num = 0;
+  _removed_inst_num = 0;
+  if (_is_incremental) {
+    initFillerGroup();
+  }
+  for (_group_idx = 0; _group_idx < static_cast<int32_t>(_filler_group_list.size()); _group_idx++) {
+    auto& filler_name_list = _filler_group_list[_group_idx];
     if (filler_name_list.size() == 0)
       break;
     findFillerMaster(filler_name_list);
@@ -259,6 +484,15 @@ void MapFiller::mapFillerCell()
     }
     addFillerCellWithoutGroups();
   }
+  LOG_INFO << "Filler: insert " << _pl_design->get_instances_range() - origin_inst_num + _removed_inst_num << " and remove "
+           << _removed_inst_num << " filler instances in " << _touched_row_num << " rows" << (_is_incremental ? " (incremental)" : "");
+}
+
+void MapFiller::mapFillerCellIncremental()
+{
+  _is_incremental = true;
+  mapFillerCell();
+  _is_incremental = false;
 }
 
 }  // namespace ipl
\ No newline at end of file
@@ -25,7 +25,9 @@
 #ifndef IEDA_FILLER_H
 #define IEDA_FILLER_H
 
+#include <algorithm>
 #include <map>
+#include <unordered_map>
 #include <vector>
 
 #include "PlacerDB.hh"
@@ -43,7 +45,14 @@ class MapFiller
     bool operator<(const FillerSegment& b) const { return l < b.l; }
   };
 
+  struct FillerPlan
+  {
+    int32_t site_x;
+    int32_t master_idx;
+  };
+
   // placer db
+  PlacerDB* _placer_db;
   Design* _pl_design;
   const Layout* _pl_layout;
 
@@ -54,27 +63,40 @@ class MapFiller
   int32_t _site_width;
   int32_t _row_height;
   std::map<int32_t, Orient> _orient_map;
+  std::vector<Orient> _row_orient_list;
 
   // design
   std::vector<Rectangle<int32_t>> _blockage_list;
   std::vector<std::vector<FillerSegment>> _available_sites;
+  std::vector<std::vector<FillerPlan>> _row_plan_list;
   std::vector<int32_t> _filler_count;
   std::vector<Cell*> _filler_master_list;
+  std::unordered_map<Cell*, int32_t> _filler_master_map;
   std::vector<Instance*> _filler_inst_list;
+  // incremental mode : group index of filler masters, and the existing fillers of the current fill region
+  std::unordered_map<Cell*, int32_t> _filler_group_map;
+  int32_t _group_idx = 0;
+  std::vector<Instance*> _old_filler_list;
 
   // config
   FillerConfig _filler_config;
   std::vector<std::vector<std::string>> _filler_group_list;
   int32_t _min_filler_width;
+  int32_t _thread_num;
+  bool _is_incremental = false;
+  int32_t _touched_row_num = 0;
+  int32_t _removed_inst_num = 0;
 
  public:
   explicit MapFiller(PlacerDB* placer_db, Config* config)
   {
+    _placer_db = placer_db;
     _pl_design = placer_db->get_design();
     _pl_layout = placer_db->get_layout();
     _filler_config = config->get_filler_config();
     _filler_group_list = _filler_config.get_filler_group_list();
     _min_filler_width = _filler_config.get_min_filler_width();
+    _thread_num = std::max(_filler_config.get_thread_num(), 1);
     _site_width = _pl_layout->get_site_width();
     _row_height = _pl_layout->get_row_height();
     for (auto row : _pl_layout->get_row_list())
@@ -84,6 +106,8 @@ class MapFiller
 
   // main
   void mapFillerCell();
+  // only rows whose fillers differ from a new fill are refilled, the fillers of the other rows are kept.
+  void mapFillerCellIncremental();
   // funtion
   void addFillerCell();
   void addFillerCellWithGroups();
@@ -94,8 +118,14 @@ class MapFiller
   void init();
   void reset(Rectangle<int32_t> region, std::vector<Rectangle<int32_t>> blockage_list);
   bool isInstInside(Instance* inst, Rectangle<int32_t> rect);
-  void add_filler_instance(int32_t inst_x, int32_t inst_y, std::string filler_name, Cell* filler_master);
+  Instance* add_filler_instance(int32_t inst_x, int32_t inst_y, std::string filler_name, Cell* filler_master, Orient orient);
   void findFillerMaster(std::vector<std::string> filler_name_list);
+  void initRowOrient();
+  void initFillerCount();
+  void initFillerGroup();
+  int32_t getFillerGroupIdx(Instance* inst);
+  void planRowFiller(int32_t row_idx);
+  void keepCleanRowFiller();
 };
 }  // namespace ipl
 #endif
\ No newline at end of file
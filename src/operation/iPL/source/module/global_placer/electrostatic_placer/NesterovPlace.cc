@@ -31,7 +31,10 @@
 #include <algorithm>
 #include <cfloat>
 #include <cmath>
+#include <cstdio>
+#include <cstring>
 #include <random>
+#include <sstream>
 
 #include "EvalAPI.hpp"
 #include "ipl_io.h"
@@ -53,6 +56,74 @@ namespace ipl {
 #define PRINT_DENSITY_MAP 0
 
 #define SQRT2 1.414213562373095048801L
+#define MIN_PERTURB_INTERVAL 50
+
+namespace {
+
+const char kCheckpointMagic[8] = {'I', 'P', 'L', 'G', 'P', 'C', 'K', 'P'};
+const uint32_t kCheckpointVersion = 3;
+
+template <typename T>
+void writeValue(std::ostream& out, const T& value)
+{
+  out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool readValue(std::istream& in, T& value)
+{
+  in.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return static_cast<bool>(in);
+}
+
+template <typename T>
+void writeValueList(std::ostream& out, const std::vector<T>& value_list)
+{
+  writeValue(out, static_cast<uint64_t>(value_list.size()));
+  out.write(reinterpret_cast<const char*>(value_list.data()), sizeof(T) * value_list.size());
+}
+
+template <typename T>
+bool readValueList(std::istream& in, std::vector<T>& value_list, uint64_t max_size)
+{
+  uint64_t size = 0;
+  if (!readValue(in, size) || size > max_size) {
+    return false;
+  }
+  value_list.resize(size);
+  in.read(reinterpret_cast<char*>(value_list.data()), sizeof(T) * size);
+  return static_cast<bool>(in);
+}
+
+template <typename T>
+void writePointList(std::ostream& out, const std::vector<Point<T>>& point_list)
+{
+  writeValue(out, static_cast<uint64_t>(point_list.size()));
+  for (auto& point : point_list) {
+    writeValue(out, point.get_x());
+    writeValue(out, point.get_y());
+  }
+}
+
+template <typename T>
+bool readPointList(std::istream& in, std::vector<Point<T>>& point_list, uint64_t max_size)
+{
+  uint64_t size = 0;
+  if (!readValue(in, size) || size > max_size) {
+    return false;
+  }
+  point_list.resize(size);
+  for (auto& point : point_list) {
+    T x, y;
+    if (!readValue(in, x) || !readValue(in, y)) {
+      return false;
+    }
+    point = Point<T>(x, y);
+  }
+  return true;
+}
+
+}  // namespace
 
   void NesterovPlace::initNesConfig(Config* config)
   {
@@ -650,6 +721,33 @@ namespace ipl {
 
     std::vector<NesInstance*> placable_inst_list = std::move(this->obtianPlacableNesInstanceList());
     initNesterovPlace(placable_inst_list);
+    initSolveState(placable_inst_list.size());
+
+    // main
+    NesterovSolve(placable_inst_list);
+    PlacerDBInst.updateTopoManager();
+    PlacerDBInst.updateGridManager();
+
+    double time_delta = gp_status.elapsedRunTime();
+    LOG_INFO << "Global Placement Total Time Elapsed: " << time_delta << "s";
+    LOG_INFO << "-----------------Finish Global Placement-----------------";
+  }
+
+  bool NesterovPlace::resumeNesterovPlace(const std::string& checkpoint_path)
+  {
+    std::cout << std::endl;
+    LOG_INFO << "-----------------Resume Global Placement-----------------";
+    ieda::Stats gp_status;
+
+    std::string path = checkpoint_path.empty() ? obtainCheckpointPath() : checkpoint_path;
+    std::vector<NesInstance*> placable_inst_list = this->obtianPlacableNesInstanceList();
+    if (!loadCheckpoint(path, placable_inst_list)) {
+      LOG_WARNING << "Cannot resume global placement from checkpoint : " << path;
+      return false;
+    }
+    LOG_INFO << "Resume global placement from iteration " << _solve_state.iter_num;
+
+    initGridFixedArea();
 
     // main
     NesterovSolve(placable_inst_list);
@@ -659,6 +757,7 @@ namespace ipl {
     double time_delta = gp_status.elapsedRunTime();
     LOG_INFO << "Global Placement Total Time Elapsed: " << time_delta << "s";
     LOG_INFO << "-----------------Finish Global Placement-----------------";
+    return true;
   }
 
 
@@ -755,6 +854,369 @@ namespace ipl {
     // initDiagonalSkMatrix(inst_list);
   }
 
+  void NesterovPlace::initSolveState(size_t inst_size)
+  {
+    _solve_state = NesterovSolveState();
+    _solve_state.prev_hpwl = _nes_database->_wirelength->obtainTotalWirelength();
+    _solve_state.cur_opt_overflow_step = static_cast<int32_t>(_nes_config.get_opt_overflow_list().size()) - 1;
+    _solve_state.last_perturb_iter = -MIN_PERTURB_INTERVAL;
+    _solve_state.best_position_list.resize(inst_size);
+    _perturb_gen.seed(1000);
+  }
+
+  std::string NesterovPlace::obtainCheckpointPath()
+  {
+    if (!_nes_config.get_checkpoint_path().empty()) {
+      return _nes_config.get_checkpoint_path();
+    }
+    return iPLAPIInst.obtainTargetDir() + "/pl/gp_checkpoint.bin";
+  }
+
+  uint64_t NesterovPlace::obtainCheckpointSignature(std::vector<NesInstance*>& inst_list)
+  {
+    // FNV-1a over placable instance names and net count, a checkpoint only fits the design and order it was taken from.
+    uint64_t signature = 14695981039346656037ULL;
+    auto hash_bytes = [&signature](const char* data, size_t size) {
+      for (size_t i = 0; i < size; i++) {
+        signature ^= static_cast<uint8_t>(data[i]);
+        signature *= 1099511628211ULL;
+      }
+    };
+
+    for (auto* n_inst : inst_list) {
+      std::string name = n_inst->get_name();
+      hash_bytes(name.c_str(), name.size() + 1);
+    }
+    uint64_t net_num = _nes_database->_nNet_list.size();
+    hash_bytes(reinterpret_cast<const char*>(&net_num), sizeof(net_num));
+
+    return signature;
+  }
+
+  bool NesterovPlace::saveCheckpoint(const std::string& path, std::vector<NesInstance*>& inst_list)
+  {
+    // write to a temporary file and rename, a preempted job never leaves a truncated checkpoint.
+    std::string tmp_path = path + ".tmp";
+    std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+    if (!out.good()) {
+      LOG_WARNING << "Cannot open file for global placement checkpoint : " << tmp_path;
+      return false;
+    }
+
+    auto* solver = _nes_database->_nesterov_solver;
+    const auto& state = _solve_state;
+
+    out.write(kCheckpointMagic, sizeof(kCheckpointMagic));
+    writeValue(out, kCheckpointVersion);
+    writeValue(out, obtainCheckpointSignature(inst_list));
+    writeValue(out, _nes_config.get_thread_num());
+
+    // NesterovSolve state.
+    writeValue(out, state.iter_num);
+    writeValue(out, state.sum_overflow);
+    writeValue(out, state.prev_hpwl);
+    writeValue(out, state.sum_overflow_threshold);
+    writeValue(out, state.hpwl_attach_sum_overflow);
+    writeValue(out, static_cast<uint8_t>(state.max_phi_coef_record));
+    writeValue(out, state.cur_opt_overflow_step);
+    writeValue(out, state.last_perturb_iter);
+    writeValue(out, static_cast<uint8_t>(state.is_add_quad_penalty));
+    writeValue(out, static_cast<uint8_t>(state.is_cal_phi));
+    writePointList(out, state.best_position_list);
+    writeValue(out, _nes_config.get_max_phi_coef());
+
+    // convergence records.
+    writeValue(out, _best_hpwl);
+    writeValue(out, _best_overflow);
+    writeValue(out, _quad_penalty_coeff);
+    writeValueList(out, _overflow_record_list);
+    writeValueList(out, _hpwl_record_list);
+
+    // penalty and wirelength coefficients.
+    writeValue(out, _nes_database->_wirelength_coef);
+    writeValue(out, _nes_database->_base_wirelength_coef);
+    writeValue(out, _nes_database->_wirelength_grad_sum);
+    writeValue(out, _nes_database->_density_penalty);
+    writeValue(out, _nes_database->_density_grad_sum);
+
+    // routability inflation, density scales also carry the filler shrinking.
+    std::vector<float> density_scale_list;
+    density_scale_list.reserve(inst_list.size());
+    for (auto* n_inst : inst_list) {
+      density_scale_list.push_back(n_inst->get_density_scale());
+    }
+    writeValue(out, _total_inst_area);
+    writeValue(out, _total_inflated_area);
+    writeValueList(out, _inflation_ratio_list);
+    writeValueList(out, density_scale_list);
+
+    // nesterov solver.
+    writeValue(out, static_cast<int32_t>(solver->get_current_iter()));
+    writeValue(out, solver->get_current_parameter());
+    writeValue(out, solver->get_next_parameter());
+    writeValue(out, solver->get_current_steplength());
+    writeValue(out, solver->get_next_steplength());
+    writePointList(out, solver->get_current_coordis());
+    writePointList(out, solver->get_next_coordis());
+    writePointList(out, solver->get_current_slp_coordis());
+    writePointList(out, solver->get_next_slp_coordis());
+    writePointList(out, solver->get_current_grads());
+    writePointList(out, solver->get_next_grads());
+
+    // instance coordinates and net weights.
+    std::vector<Point<int32_t>> coordi_list;
+    coordi_list.reserve(inst_list.size());
+    for (auto* n_inst : inst_list) {
+      coordi_list.push_back(n_inst->get_density_center_coordi());
+    }
+    writePointList(out, coordi_list);
+
+    std::vector<float> weight_list;
+    std::vector<float> delta_weight_list;
+    weight_list.reserve(_nes_database->_nNet_list.size());
+    delta_weight_list.reserve(_nes_database->_nNet_list.size());
+    for (auto* n_net : _nes_database->_nNet_list) {
+      weight_list.push_back(n_net->get_weight());
+      delta_weight_list.push_back(n_net->get_delta_weight());
+    }
+    writeValueList(out, weight_list);
+    writeValueList(out, delta_weight_list);
+
+    // random engine of entropy injection.
+    std::ostringstream perturb_gen_stream;
+    perturb_gen_stream << _perturb_gen;
+    std::string perturb_gen_state = perturb_gen_stream.str();
+    writeValueList(out, std::vector<char>(perturb_gen_state.begin(), perturb_gen_state.end()));
+
+    // route utilization, and the pattern route the next incremental estimate starts from.
+    auto* grid_manager = _nes_database->_bin_grid->get_grid_manager();
+    std::vector<float> route_util_list;
+    route_util_list.reserve(static_cast<size_t>(grid_manager->get_grid_cnt_x()) * grid_manager->get_grid_cnt_y() * 4);
+    for (auto& grid_row : grid_manager->get_grid_2d_list()) {
+      for (auto& grid : grid_row) {
+        route_util_list.push_back(grid.h_cong);
+        route_util_list.push_back(grid.v_cong);
+        route_util_list.push_back(grid.h_util);
+        route_util_list.push_back(grid.v_util);
+      }
+    }
+    writeValueList(out, route_util_list);
+    writeValue(out, grid_manager->get_h_util_max());
+    writeValue(out, grid_manager->get_v_util_max());
+    writeValue(out, grid_manager->get_h_util_sum());
+    writeValue(out, grid_manager->get_v_util_sum());
+    writeValueList(out, _nes_database->_bin_grid->get_pattern_route_estimator().obtainRouteStateList());
+
+    out.close();
+    if (!out) {
+      LOG_WARNING << "Fail to write global placement checkpoint : " << tmp_path;
+      std::remove(tmp_path.c_str());
+      return false;
+    }
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+      LOG_WARNING << "Fail to move global placement checkpoint to " << path;
+      return false;
+    }
+
+    LOG_INFO << "[NesterovSolve] Save checkpoint of iter " << state.iter_num << " to " << path;
+    return true;
+  }
+
+  bool NesterovPlace::loadCheckpoint(const std::string& path, std::vector<NesInstance*>& inst_list)
+  {
+    std::ifstream in(path, std::ios::binary);
+    if (!in.good()) {
+      LOG_WARNING << "Cannot open global placement checkpoint : " << path;
+      return false;
+    }
+
+    char magic[sizeof(kCheckpointMagic)];
+    uint32_t version = 0;
+    in.read(magic, sizeof(magic));
+    if (!in || std::memcmp(magic, kCheckpointMagic, sizeof(magic)) != 0 || !readValue(in, version) || version != kCheckpointVersion) {
+      LOG_WARNING << path << " is not a global placement checkpoint of version " << kCheckpointVersion;
+      return false;
+    }
+
+    uint64_t signature = 0;
+    if (!readValue(in, signature) || signature != obtainCheckpointSignature(inst_list)) {
+      LOG_WARNING << "Checkpoint " << path << " does not match the current design.";
+      return false;
+    }
+
+    int32_t thread_num = 0;
+    if (!readValue(in, thread_num)) {
+      LOG_WARNING << "Checkpoint " << path << " is truncated.";
+      return false;
+    }
+    if (thread_num != _nes_config.get_thread_num()) {
+      LOG_WARNING << "Checkpoint is saved with " << thread_num << " threads, resume with " << _nes_config.get_thread_num()
+                  << " threads may not reproduce the original run.";
+    }
+
+    // read everything first, nothing is applied unless the whole checkpoint is valid.
+    uint64_t inst_size = inst_list.size();
+    uint64_t net_size = _nes_database->_nNet_list.size();
+
+    NesterovSolveState state;
+    uint8_t max_phi_coef_record = 0;
+    uint8_t is_add_quad_penalty = 0;
+    uint8_t is_cal_phi = 0;
+    float max_phi_coef = 0.0F;
+    int64_t best_hpwl = 0;
+    float best_overflow = 0.0F;
+    float quad_penalty_coeff = 0.0F;
+    std::vector<float> overflow_record_list;
+    std::vector<float> hpwl_record_list;
+    float wirelength_coef = 0.0F;
+    float base_wirelength_coef = 0.0F;
+    float wirelength_grad_sum = 0.0F;
+    float density_penalty = 0.0F;
+    float density_grad_sum = 0.0F;
+    int64_t total_inst_area = 0;
+    double total_inflated_area = 0.0;
+    std::vector<float> inflation_ratio_list;
+    std::vector<float> density_scale_list;
+    int32_t solver_iter = 0;
+    float current_parameter = 0.0F;
+    float next_parameter = 0.0F;
+    float current_steplength = 0.0F;
+    float next_steplength = 0.0F;
+    std::vector<Point<int32_t>> current_coordis, next_coordis, current_slp_coordis, next_slp_coordis;
+    std::vector<Point<float>> current_grads, next_grads;
+    std::vector<Point<int32_t>> coordi_list;
+    std::vector<float> weight_list;
+    std::vector<float> delta_weight_list;
+    std::vector<char> perturb_gen_state;
+    std::vector<float> route_util_list;
+    float h_util_max = 0.0F;
+    float v_util_max = 0.0F;
+    float h_util_sum = 0.0F;
+    float v_util_sum = 0.0F;
+    std::vector<int32_t> route_state_list;
+
+    auto* grid_manager = _nes_database->_bin_grid->get_grid_manager();
+    auto& pattern_route_estimator = _nes_database->_bin_grid->get_pattern_route_estimator();
+    uint64_t route_util_size = static_cast<uint64_t>(grid_manager->get_grid_cnt_x()) * grid_manager->get_grid_cnt_y() * 4;
+
+    bool is_valid = readValue(in, state.iter_num) && readValue(in, state.sum_overflow) && readValue(in, state.prev_hpwl)
+                    && readValue(in, state.sum_overflow_threshold) && readValue(in, state.hpwl_attach_sum_overflow)
+                    && readValue(in, max_phi_coef_record) && readValue(in, state.cur_opt_overflow_step)
+                    && readValue(in, state.last_perturb_iter) && readValue(in, is_add_quad_penalty) && readValue(in, is_cal_phi)
+                    && readPointList(in, state.best_position_list, inst_size) && readValue(in, max_phi_coef);
+    is_valid = is_valid && state.iter_num >= 0 && readValue(in, best_hpwl) && readValue(in, best_overflow)
+               && readValue(in, quad_penalty_coeff) && readValueList(in, overflow_record_list, state.iter_num)
+               && readValueList(in, hpwl_record_list, state.iter_num);
+    is_valid = is_valid && readValue(in, wirelength_coef) && readValue(in, base_wirelength_coef) && readValue(in, wirelength_grad_sum)
+               && readValue(in, density_penalty) && readValue(in, density_grad_sum);
+    is_valid = is_valid && readValue(in, total_inst_area) && readValue(in, total_inflated_area)
+               && readValueList(in, inflation_ratio_list, inst_size) && readValueList(in, density_scale_list, inst_size);
+    is_valid = is_valid && readValue(in, solver_iter) && readValue(in, current_parameter) && readValue(in, next_parameter)
+               && readValue(in, current_steplength) && readValue(in, next_steplength)
+               && readPointList(in, current_coordis, inst_size) && readPointList(in, next_coordis, inst_size)
+               && readPointList(in, current_slp_coordis, inst_size) && readPointList(in, next_slp_coordis, inst_size)
+               && readPointList(in, current_grads, inst_size) && readPointList(in, next_grads, inst_size);
+    is_valid = is_valid && readPointList(in, coordi_list, inst_size) && readValueList(in, weight_list, net_size)
+               && readValueList(in, delta_weight_list, net_size);
+    is_valid = is_valid && readValueList(in, perturb_gen_state, 1 << 16) && readValueList(in, route_util_list, route_util_size)
+               && readValue(in, h_util_max) && readValue(in, v_util_max) && readValue(in, h_util_sum) && readValue(in, v_util_sum);
+    if (is_valid) {
+      // the pattern route list is bounded by what is left of the file.
+      std::streampos route_state_pos = in.tellg();
+      in.seekg(0, std::ios::end);
+      uint64_t left_size = static_cast<uint64_t>(in.tellg() - route_state_pos);
+      in.seekg(route_state_pos);
+      is_valid = readValueList(in, route_state_list, left_size / sizeof(int32_t));
+    }
+    is_valid = is_valid && solver_iter == state.iter_num && state.best_position_list.size() == inst_size
+               && current_coordis.size() == inst_size && next_coordis.size() == inst_size && current_slp_coordis.size() == inst_size
+               && next_slp_coordis.size() == inst_size && coordi_list.size() == inst_size && weight_list.size() == net_size
+               && delta_weight_list.size() == net_size && density_scale_list.size() == inst_size
+               && route_util_list.size() == route_util_size;
+
+    std::default_random_engine perturb_gen;
+    std::istringstream perturb_gen_stream(std::string(perturb_gen_state.begin(), perturb_gen_state.end()));
+    perturb_gen_stream >> perturb_gen;
+    is_valid = is_valid && !perturb_gen_stream.fail();
+
+    // the pattern route is checked against the grid and applied in one step, so it goes last.
+    is_valid = is_valid && pattern_route_estimator.restoreRouteStateList(route_state_list);
+    if (!is_valid) {
+      LOG_WARNING << "Checkpoint " << path << " is truncated or corrupted.";
+      return false;
+    }
+
+    // NesterovSolve state.
+    state.max_phi_coef_record = max_phi_coef_record;
+    state.is_add_quad_penalty = is_add_quad_penalty;
+    state.is_cal_phi = is_cal_phi;
+    _solve_state = std::move(state);
+    _nes_config.set_max_phi_coef(max_phi_coef);
+
+    // convergence records.
+    _best_hpwl = best_hpwl;
+    _best_overflow = best_overflow;
+    _quad_penalty_coeff = quad_penalty_coeff;
+    _overflow_record_list = std::move(overflow_record_list);
+    _hpwl_record_list = std::move(hpwl_record_list);
+
+    // penalty and wirelength coefficients.
+    _nes_database->_wirelength_coef = wirelength_coef;
+    _nes_database->_base_wirelength_coef = base_wirelength_coef;
+    _nes_database->_wirelength_grad_sum = wirelength_grad_sum;
+    _nes_database->_density_penalty = density_penalty;
+    _nes_database->_density_grad_sum = density_grad_sum;
+
+    // routability inflation.
+    _total_inst_area = total_inst_area;
+    _total_inflated_area = total_inflated_area;
+    _inflation_ratio_list = std::move(inflation_ratio_list);
+
+    // nesterov solver.
+    auto* solver = _nes_database->_nesterov_solver;
+    solver->set_current_iter(solver_iter);
+    solver->set_current_parameter(current_parameter);
+    solver->set_next_parameter(next_parameter);
+    solver->set_current_steplength(current_steplength);
+    solver->set_next_steplength(next_steplength);
+    solver->set_current_coordis(current_coordis);
+    solver->set_next_coordis(next_coordis);
+    solver->set_current_slp_coordis(current_slp_coordis);
+    solver->set_next_slp_coordis(next_slp_coordis);
+    solver->set_current_gradients(current_grads);
+    solver->set_next_gradients(next_grads);
+
+    // instance coordinates and net weights.
+#pragma omp parallel for num_threads(_nes_config.get_thread_num())
+    for (size_t i = 0; i < inst_size; i++) {
+      inst_list[i]->updateDensityCenterLocation(coordi_list[i]);
+      inst_list[i]->set_density_scale(density_scale_list[i]);
+    }
+    for (size_t i = 0; i < net_size; i++) {
+      _nes_database->_nNet_list[i]->set_weight(weight_list[i]);
+      _nes_database->_nNet_list[i]->set_delta_weight(delta_weight_list[i]);
+    }
+    updateTopologyManager();
+
+    // random engine of entropy injection and route utilization.
+    _perturb_gen = perturb_gen;
+    size_t route_util_idx = 0;
+    for (auto& grid_row : grid_manager->get_grid_2d_list()) {
+      for (auto& grid : grid_row) {
+        grid.h_cong = route_util_list[route_util_idx++];
+        grid.v_cong = route_util_list[route_util_idx++];
+        grid.h_util = route_util_list[route_util_idx++];
+        grid.v_util = route_util_list[route_util_idx++];
+      }
+    }
+    grid_manager->set_h_util_max(h_util_max);
+    grid_manager->set_v_util_max(v_util_max);
+    grid_manager->set_h_util_sum(h_util_sum);
+    grid_manager->set_v_util_sum(v_util_sum);
+
+    return true;
+  }
+
   std::vector<NesInstance*> NesterovPlace::obtianPlacableNesInstanceList()
   {
     std::vector<NesInstance*> placable_list;
@@ -1244,23 +1706,17 @@ namespace ipl {
     auto* solver = _nes_database->_nesterov_solver;
     size_t inst_size = inst_list.size();
 
-    float sum_overflow;
-    int64_t prev_hpwl, hpwl;
-    prev_hpwl = _nes_database->_wirelength->obtainTotalWirelength();
+    auto& state = _solve_state;
+    int64_t hpwl;
 
     std::vector<Point<float>> next_slp_wirelength_grad_list(inst_size, Point<float>());
     std::vector<Point<float>> next_slp_density_grad_list(inst_size, Point<float>());
     std::vector<Point<float>> next_slp_sum_grad_list(inst_size, Point<float>());
 
-    float sum_overflow_threshold = 1e25;
-    float hpwl_attach_sum_overflow = 1e25;
-    bool max_phi_coef_record = false;
-
     Rectangle<int32_t> core_shape = _nes_database->_placer_db->get_layout()->get_core_shape();
 
     // opt setting
     const std::vector<float>& opt_overflow_list = _nes_config.get_opt_overflow_list();
-    int32_t cur_opt_overflow_step = opt_overflow_list.size() - 1;
 
     // prepare for long net opt.
     int32_t long_width, long_height;
@@ -1285,23 +1741,17 @@ namespace ipl {
     }
 
     // prepare for convergence acceleration and non-convergence treatment
-    int32_t min_perturb_interval = 50;
-    int32_t last_perturb_iter = -min_perturb_interval;
-    bool is_add_quad_penalty = false;
-    bool is_cal_phi = false;
     bool stop_placement = false;
-    std::vector<Point<int32_t>> best_position_list;
     std::vector<Point<int32_t>> cur_position_list;
-    best_position_list.resize(inst_size);
     cur_position_list.resize(inst_size);
 
-    if (_nes_config.isOptCongestion()){
+    if (_nes_config.isOptCongestion() || _nes_config.get_routability_interval() > 0){
       _nes_database->_bin_grid->evalRouteCap(_nes_config.get_thread_num());
       // _nes_database->_bin_grid->plotRouteCap();
     }
 
     // algorithm core loop.
-    for (int32_t iter_num = 1; iter_num <= _nes_config.get_max_iter(); iter_num++) {
+    for (int32_t iter_num = state.iter_num + 1; iter_num <= _nes_config.get_max_iter(); iter_num++) {
       solver->runNextIter(iter_num, _nes_config.get_thread_num());
       int32_t num_backtrack = 0;
       for (; num_backtrack < _nes_config.get_max_back_track(); num_backtrack++) {
@@ -1329,11 +1779,11 @@ namespace ipl {
           printDensityMapToCsv("density_map_" + std::to_string(iter_num));
         }
 
-        _nes_database->_density_gradient->updateDensityForce(_nes_config.get_thread_num(), is_cal_phi);
+        _nes_database->_density_gradient->updateDensityForce(_nes_config.get_thread_num(), state.is_cal_phi);
 
         updateTopologyManager();
 
-        sum_overflow = static_cast<float>(_nes_database->_bin_grid->get_overflow_area_without_filler()) / _total_inst_area;
+        state.sum_overflow = static_cast<float>(_nes_database->_bin_grid->get_overflow_area_without_filler()) / _total_inst_area;
         if (_nes_config.isOptCongestion() && iter_num >= 340 && iter_num % 10 == 0){
           _nes_database->_bin_grid->evalRouteDem(_nes_database->_topology_manager->get_network_list(), _nes_config.get_thread_num());
           _nes_database->_bin_grid->fastGaussianBlur();
@@ -1345,7 +1795,7 @@ namespace ipl {
           _nes_database->_wirelength_gradient->updateWirelengthForce(_nes_database->_wirelength_coef, _nes_database->_wirelength_coef,
             _nes_config.get_min_wirelength_force_bar(), _nes_config.get_thread_num());
         }else{
-          if (sum_overflow > 0.5){
+          if (state.sum_overflow > 0.5){
             _nes_database->_wirelength_gradient->updateWirelengthForce(_nes_database->_wirelength_coef, _nes_database->_wirelength_coef,
                                                                  _nes_config.get_min_wirelength_force_bar(), _nes_config.get_thread_num());        
           }else{
@@ -1353,7 +1803,7 @@ namespace ipl {
             _nes_database->_bin_grid->evalRouteDem(_nes_database->_topology_manager->get_network_list(), _nes_config.get_thread_num());
             _nes_database->_bin_grid->fastGaussianBlur();
             _nes_database->_bin_grid->evalRouteUtil();
-            // _nes_database->_bin_grid->plotOverflowUtil(sum_overflow, iter_num);
+            // _nes_database->_bin_grid->plotOverflowUtil(state.sum_overflow, iter_num);
 
             // writeBackPlacerDB();
             // PlacerDBInst.writeBackSourceDataBase();
@@ -1368,7 +1818,7 @@ namespace ipl {
 
         // update next target penalty object.
         updatePenaltyGradient(inst_list, next_slp_sum_grad_list, next_slp_wirelength_grad_list, next_slp_density_grad_list,
-          is_add_quad_penalty);
+          state.is_add_quad_penalty);
 
         if (_nes_database->_is_diverged) {
           break;
@@ -1404,38 +1854,44 @@ namespace ipl {
       }
 
       if (_nes_config.isOptMaxWirelength()) {
-        if (cur_opt_overflow_step >= 0 && sum_overflow < opt_overflow_list[cur_opt_overflow_step]) {
+        if (state.cur_opt_overflow_step >= 0 && state.sum_overflow < opt_overflow_list[state.cur_opt_overflow_step]) {
           // update net weight.
           updateMaxLengthNetWeight();
-          --cur_opt_overflow_step;
+          --state.cur_opt_overflow_step;
           LOG_INFO << "[NesterovSolve] Begin update netweight for max wirelength constraint.";
         }
       }
 
       if (_nes_config.isOptTiming()) {
-        if (cur_opt_overflow_step >= 0 && sum_overflow < opt_overflow_list[cur_opt_overflow_step]) {
+        if (state.cur_opt_overflow_step >= 0 && state.sum_overflow < opt_overflow_list[state.cur_opt_overflow_step]) {
           // update net weight.
           updateTimingNetWeight();
-          --cur_opt_overflow_step;
+          --state.cur_opt_overflow_step;
           LOG_INFO << "[NesterovSolve] Update netweight for timing improvement.";
         }
       }
 
-      updateWirelengthCoef(sum_overflow);
-      if (!max_phi_coef_record && sum_overflow < 0.35f) {
-        max_phi_coef_record = true;
+      updateWirelengthCoef(state.sum_overflow);
+      if (!state.max_phi_coef_record && state.sum_overflow < 0.35f) {
+        state.max_phi_coef_record = true;
         _nes_config.set_max_phi_coef(0.985 * _nes_config.get_max_phi_coef());
       }
 
       hpwl = _nes_database->_wirelength->obtainTotalWirelength();
 
-      float phi_coef = obtainPhiCoef(static_cast<float>(hpwl - prev_hpwl) / _nes_config.get_reference_hpwl(), iter_num);
-      prev_hpwl = hpwl;
+      float phi_coef = obtainPhiCoef(static_cast<float>(hpwl - state.prev_hpwl) / _nes_config.get_reference_hpwl(), iter_num);
+      state.prev_hpwl = hpwl;
       _nes_database->_density_penalty *= phi_coef;
 
+      // routability, inflate cells in congested grids once the placement is spread enough.
+      if (_nes_config.get_routability_interval() > 0 && iter_num % _nes_config.get_routability_interval() == 0
+          && state.sum_overflow < 0.3f) {
+        updateRoutabilityInflation(inst_list);
+      }
+
       // print info.
       if (iter_num == 1 || iter_num % 10 == 0) {
-        LOG_INFO << "[NesterovSolve] Iter: " << iter_num << " overflow: " << sum_overflow << " HPWL: " << prev_hpwl;
+        LOG_INFO << "[NesterovSolve] Iter: " << iter_num << " overflow: " << state.sum_overflow << " HPWL: " << state.prev_hpwl;
 
         if (PRINT_LONG_NET) {
           long_net_stream << "CURRENT ITERATION: " << iter_num << std::endl;
@@ -1455,59 +1911,60 @@ namespace ipl {
         }
       }
 
-      if (sum_overflow_threshold > sum_overflow) {
-        sum_overflow_threshold = sum_overflow;
-        hpwl_attach_sum_overflow = prev_hpwl;
+      if (state.sum_overflow_threshold > state.sum_overflow) {
+        state.sum_overflow_threshold = state.sum_overflow;
+        state.hpwl_attach_sum_overflow = state.prev_hpwl;
       }
 
-      if (sum_overflow < 0.32f && sum_overflow - sum_overflow_threshold >= 0.05f && hpwl_attach_sum_overflow * 1.25f < prev_hpwl) {
+      if (state.sum_overflow < 0.32f && state.sum_overflow - state.sum_overflow_threshold >= 0.05f
+          && state.hpwl_attach_sum_overflow * 1.25f < state.prev_hpwl) {
         LOG_ERROR << "Detect divergence. \n"
           << "    The reason may be max_phi_cof value: try to decrease max_phi_cof";
         _nes_database->_is_diverged = true;
         break;
       }
 
-      _overflow_record_list.push_back(sum_overflow);
+      _overflow_record_list.push_back(state.sum_overflow);
       _hpwl_record_list.push_back(hpwl);
 
-      if (sum_overflow < _best_overflow) {
+      if (state.sum_overflow < _best_overflow) {
         _best_hpwl = hpwl;
-        _best_overflow = sum_overflow;
-        best_position_list.swap(cur_position_list);
+        _best_overflow = state.sum_overflow;
+        state.best_position_list.swap(cur_position_list);
       }
 
-      if (sum_overflow < _nes_config.get_target_overflow() * 4 && sum_overflow > _nes_config.get_target_overflow() * 1.1) {
-        if (checkDivergence(3, 0.03 * sum_overflow) || checkLongTimeOverflowUnchanged(100, 0.03 * sum_overflow)) {
+      if (state.sum_overflow < _nes_config.get_target_overflow() * 4 && state.sum_overflow > _nes_config.get_target_overflow() * 1.1) {
+        if (checkDivergence(3, 0.03 * state.sum_overflow) || checkLongTimeOverflowUnchanged(100, 0.03 * state.sum_overflow)) {
           // rollback to best pos.
           for (size_t i = 0; i < inst_size; i++) {
-            updateDensityCenterCoordiLayoutInside(inst_list[i], best_position_list[i], core_shape);
+            updateDensityCenterCoordiLayoutInside(inst_list[i], state.best_position_list[i], core_shape);
           }
-          sum_overflow = _best_overflow;
-          prev_hpwl = _best_hpwl;
+          state.sum_overflow = _best_overflow;
+          state.prev_hpwl = _best_hpwl;
 
           stop_placement = true;
         }
       }
 
-      if (iter_num - last_perturb_iter > min_perturb_interval && checkPlateau(50, 0.01)) {
-        if (sum_overflow > 0.9) {
+      if (iter_num - state.last_perturb_iter > MIN_PERTURB_INTERVAL && checkPlateau(50, 0.01)) {
+        if (state.sum_overflow > 0.9) {
           // quad mode
-          is_add_quad_penalty = true;
-          is_cal_phi = true;
+          state.is_add_quad_penalty = true;
+          state.is_cal_phi = true;
           LOG_INFO << "Try to enable quadratic penalty for density to accelerate convergence";
-          if (sum_overflow > 0.95) {
-            float noise_intensity = std::min(std::max(40 + (120 - 40) * (sum_overflow - 0.95) * 10, 40.0), 90.0)
+          if (state.sum_overflow > 0.95) {
+            float noise_intensity = std::min(std::max(40 + (120 - 40) * (state.sum_overflow - 0.95) * 10, 40.0), 90.0)
               * _nes_database->_placer_db->get_layout()->get_site_width();
             entropyInjection(0.996, noise_intensity);
             LOG_INFO << "Try to entropy injection with noise intensity = " << noise_intensity
               << " to help convergence";
           }
-          last_perturb_iter = iter_num;
+          state.last_perturb_iter = iter_num;
         }
       }
 
       // minimun iteration is 30
-      if ((iter_num > 30 && sum_overflow <= _nes_config.get_target_overflow()) || stop_placement) {
+      if ((iter_num > 30 && state.sum_overflow <= _nes_config.get_target_overflow()) || stop_placement) {
         if (PRINT_LONG_NET) {
           long_net_stream << "CURRENT ITERATION: " << iter_num << std::endl;
           long_net_stream << std::endl;
@@ -1523,16 +1980,21 @@ namespace ipl {
           saveNesterovPlaceData(iter_num);
         }
 
-        LOG_INFO << "[NesterovSolve] Finished with Overflow:" << sum_overflow << " HPWL : " << prev_hpwl;
+        LOG_INFO << "[NesterovSolve] Finished with Overflow:" << state.sum_overflow << " HPWL : " << state.prev_hpwl;
         break;
       }
+
+      state.iter_num = iter_num;
+      if (_nes_config.get_checkpoint_interval() > 0 && iter_num % _nes_config.get_checkpoint_interval() == 0) {
+        saveCheckpoint(obtainCheckpointPath(), inst_list);
+      }
     }
 
     if (_nes_database->_is_diverged) {
       exit(1);
     }
 
-    notifyPLOverflowInfo(sum_overflow);
+    notifyPLOverflowInfo(state.sum_overflow);
     notifyPLPlaceDensity();
 
     // update PlacerDB.
@@ -1784,6 +2246,97 @@ namespace ipl {
     }
   }
 
+  void NesterovPlace::updateRoutabilityInflation(std::vector<NesInstance*>& inst_list)
+  {
+    auto* bin_grid = _nes_database->_bin_grid;
+    auto* grid_manager = bin_grid->get_grid_manager();
+    int32_t thread_num = _nes_config.get_thread_num();
+
+    bin_grid->evalPatternRouteDem(_nes_database->_topology_manager->get_network_list(), thread_num);
+    bin_grid->fastGaussianBlur();
+    bin_grid->evalRouteUtil();
+
+    size_t inst_size = inst_list.size();
+    if (_inflation_ratio_list.size() != inst_size) {
+      _inflation_ratio_list.assign(inst_size, 1.0F);
+    }
+
+    // a stdcell in an over utilized grid grows by util^2.33, bounded by max_inflation_ratio in total.
+    Rectangle<int32_t> region = grid_manager->get_shape();
+    auto& grid_2d_list = grid_manager->get_grid_2d_list();
+    float max_inflation_ratio = _nes_config.get_max_inflation_ratio();
+    std::vector<float> next_ratio_list(_inflation_ratio_list);
+    std::vector<double> inflated_area_list(inst_size, 0.0);
+
+#pragma omp parallel for num_threads(thread_num)
+    for (size_t i = 0; i < inst_size; i++) {
+      auto* n_inst = inst_list[i];
+      if (n_inst->isFiller() || n_inst->isMacro()) {
+        continue;
+      }
+
+      Point<int32_t> center = n_inst->get_density_center_coordi();
+      int32_t grid_x = std::clamp((center.get_x() - region.get_ll_x()) / grid_manager->get_grid_size_x(), 0,
+                                  grid_manager->get_grid_cnt_x() - 1);
+      int32_t grid_y = std::clamp((center.get_y() - region.get_ll_y()) / grid_manager->get_grid_size_y(), 0,
+                                  grid_manager->get_grid_cnt_y() - 1);
+      auto& grid = grid_2d_list[grid_y][grid_x];
+      float util = std::max(grid.h_util, grid.v_util);
+      if (util <= 1.0f) {
+        continue;
+      }
+
+      next_ratio_list[i] = std::min(max_inflation_ratio, _inflation_ratio_list[i] * std::pow(util, 2.33f));
+      Rectangle<int32_t> density_shape = n_inst->get_density_shape();
+      double base_area = static_cast<double>(density_shape.get_width()) * density_shape.get_height() * n_inst->get_density_scale()
+                         / _inflation_ratio_list[i];
+      inflated_area_list[i] = base_area * (next_ratio_list[i] - _inflation_ratio_list[i]);
+    }
+
+    double desired_area = 0.0;
+    for (double area : inflated_area_list) {
+      desired_area += area;
+    }
+
+    // the inflated area is taken from the fillers, and stays within 10% of the original cell area.
+    double filler_area = 0.0;
+    for (auto* n_inst : inst_list) {
+      if (n_inst->isFiller()) {
+        Rectangle<int32_t> density_shape = n_inst->get_density_shape();
+        filler_area += static_cast<double>(density_shape.get_width()) * density_shape.get_height() * n_inst->get_density_scale();
+      }
+    }
+    double allowed_area = std::min(0.1 * (_total_inst_area - _total_inflated_area) - _total_inflated_area, 0.9 * filler_area);
+    if (desired_area <= 0.0 || allowed_area <= 0.0) {
+      LOG_INFO << "[NesterovSolve] Routability: rerouted nets " << bin_grid->get_pattern_rerouted_net_num() << ", max util h/v "
+               << grid_manager->get_h_util_max() << "/" << grid_manager->get_v_util_max() << ", no cell inflated.";
+      return;
+    }
+    double scale = std::min(1.0, allowed_area / desired_area);
+    double added_area = desired_area * scale;
+
+#pragma omp parallel for num_threads(thread_num)
+    for (size_t i = 0; i < inst_size; i++) {
+      auto* n_inst = inst_list[i];
+      if (n_inst->isFiller()) {
+        n_inst->set_density_scale(n_inst->get_density_scale() * (filler_area - added_area) / filler_area);
+        continue;
+      }
+      if (inflated_area_list[i] <= 0.0) {
+        continue;
+      }
+      float next_ratio = _inflation_ratio_list[i] + (next_ratio_list[i] - _inflation_ratio_list[i]) * scale;
+      n_inst->set_density_scale(n_inst->get_density_scale() * next_ratio / _inflation_ratio_list[i]);
+      _inflation_ratio_list[i] = next_ratio;
+    }
+
+    _total_inflated_area += added_area;
+    _total_inst_area += static_cast<int64_t>(added_area);
+
+    LOG_INFO << "[NesterovSolve] Routability: rerouted nets " << bin_grid->get_pattern_rerouted_net_num() << ", max util h/v "
+             << grid_manager->get_h_util_max() << "/" << grid_manager->get_v_util_max() << ", inflated area " << added_area;
+  }
+
   void NesterovPlace::printNesterovDatabase()
   {
     int32_t nes_inst_cnt = _nes_database->_nInstance_list.size();
@@ -2001,8 +2554,6 @@ namespace ipl {
     center_x /= movable_inst_cnt;
     center_y /= movable_inst_cnt;
 
-    int32_t seed = 1000;
-    std::default_random_engine gen(seed);
     std::normal_distribution<float> dis(0, 1);
     for (auto* inst : _nes_database->_nInstance_list) {
       if (inst->isFixed()) {
@@ -2015,8 +2566,8 @@ namespace ipl {
       int32_t new_y = (inst_center.get_y() - center_y) * shrink_factor + center_y;
 
       // add some noise
-      new_x += noise_intensity * dis(gen);
-      new_y += noise_intensity * dis(gen);
+      new_x += noise_intensity * dis(_perturb_gen);
+      new_y += noise_intensity * dis(_perturb_gen);
 
       inst->updateDensityCenterLocation(new_x, new_y);
     }
@@ -31,6 +31,9 @@
 
 #include <fstream>
 #include <iostream>
+#include <random>
+#include <string>
+#include <vector>
 
 #include "Config.hh"
 #include "Log.hh"
@@ -52,6 +55,7 @@ class NesterovPlace
   NesterovPlace& operator=(NesterovPlace&&) = delete;
 
   void runNesterovPlace();
+  bool resumeNesterovPlace(const std::string& checkpoint_path);
   void printNesterovDatabase();
 
  private:
@@ -66,6 +70,30 @@ class NesterovPlace
   float _quad_penalty_coeff = 0.005;
   int64_t _total_inst_area = 0;
 
+  // routability-driven cell inflation, indexed as the placable instance list.
+  std::vector<float> _inflation_ratio_list;
+  double _total_inflated_area = 0.0;
+
+  // state carried across NesterovSolve iterations, everything here is written to checkpoint.
+  struct NesterovSolveState
+  {
+    int32_t iter_num = 0;
+    float sum_overflow = 1.0F;
+    int64_t prev_hpwl = 0;
+    float sum_overflow_threshold = 1e25;
+    float hpwl_attach_sum_overflow = 1e25;
+    bool max_phi_coef_record = false;
+    int32_t cur_opt_overflow_step = -1;
+    int32_t last_perturb_iter = 0;
+    bool is_add_quad_penalty = false;
+    bool is_cal_phi = false;
+    std::vector<Point<int32_t>> best_position_list;
+  };
+  NesterovSolveState _solve_state;
+
+  // noise of entropy injection, seeded once per run and written to checkpoint.
+  std::default_random_engine _perturb_gen;
+
   void resetOverflowRecordList();
   void resetHPWLRecordList();
   void initQuadPenaltyCoeff();
@@ -88,8 +116,14 @@ class NesterovPlace
   void initNesInstanceDensitySize();
 
   void initNesterovPlace(std::vector<NesInstance*>& inst_list);
+  void initSolveState(size_t inst_size);
   void NesterovSolve(std::vector<NesInstance*>& inst_list);
 
+  std::string obtainCheckpointPath();
+  uint64_t obtainCheckpointSignature(std::vector<NesInstance*>& inst_list);
+  bool saveCheckpoint(const std::string& path, std::vector<NesInstance*>& inst_list);
+  bool loadCheckpoint(const std::string& path, std::vector<NesInstance*>& inst_list);
+
   std::vector<NesInstance*> obtianPlacableNesInstanceList();
 
   void updateDensityCoordiLayoutInside(NesInstance* nInst, Rectangle<int32_t> core_shape);
@@ -130,6 +164,7 @@ class NesterovPlace
 
   void updateMaxLengthNetWeight();
   void updateTimingNetWeight();
+  void updateRoutabilityInflation(std::vector<NesInstance*>& inst_list);
 
   // DEBUG.
   void printAcrossLongNet(std::ofstream& file_stream, int32_t max_width, int32_t max_height);
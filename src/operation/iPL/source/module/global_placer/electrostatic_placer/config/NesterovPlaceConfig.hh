@@ -28,6 +28,7 @@
 #define IPL_OPERATOR_GP_NESTEROV_PLACE_CONFIG_H
 
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace ipl {
@@ -64,6 +65,10 @@ class NesterovPlaceConfig
   bool isOptCongestion() const { return _is_opt_congestion;}
   int32_t get_max_net_wirelength() const { return _max_net_wirelength;}
   const std::vector<float>& get_opt_overflow_list() {return _opt_overflow_list;} 
+  int32_t get_checkpoint_interval() const { return _checkpoint_interval; }
+  const std::string& get_checkpoint_path() const { return _checkpoint_path; }
+  int32_t get_routability_interval() const { return _routability_interval; }
+  float   get_max_inflation_ratio() const { return _max_inflation_ratio; }
 
   // setter.
   void set_thread_num(int32_t num_thread) { _thread_num = num_thread; }
@@ -86,6 +91,10 @@ class NesterovPlaceConfig
   void set_is_opt_congestion(bool flag) { _is_opt_congestion = flag;}
   void set_max_net_wirelength(int32_t max_wirelength) { _max_net_wirelength = max_wirelength;}
   void add_opt_target_overflow(float overflow) { _opt_overflow_list.push_back(overflow);}
+  void set_checkpoint_interval(int32_t interval) { _checkpoint_interval = interval; }
+  void set_checkpoint_path(std::string path) { _checkpoint_path = std::move(path); }
+  void set_routability_interval(int32_t interval) { _routability_interval = interval; }
+  void set_max_inflation_ratio(float ratio) { _max_inflation_ratio = ratio; }
 
  private:
   int32_t _thread_num;
@@ -122,6 +131,14 @@ class NesterovPlaceConfig
 
   // about opt target overflow list
   std::vector<float> _opt_overflow_list;
+
+  // about checkpoint, interval 0 means disabled.
+  int32_t _checkpoint_interval = 0;
+  std::string _checkpoint_path;
+
+  // about routability, pattern route estimate every interval iterations, 0 means disabled.
+  int32_t _routability_interval = 0;
+  float   _max_inflation_ratio = 2.5F;
 };
 
 }  // namespace ipl
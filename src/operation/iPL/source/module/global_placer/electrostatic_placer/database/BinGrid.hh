@@ -29,6 +29,7 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <iostream>
 #include <vector>
 
@@ -36,6 +37,7 @@
 #include "TopologyManager.hh"
 #include "Parameter.hh"
 #include "NesInstance.hh"
+#include "PatternRouteEstimator.hh"
 
 namespace ipl {
 
@@ -83,6 +85,9 @@ class BinGrid
   void updataOverflowArea(std::vector<NesInstance*>& nInst_list, int32_t thread_num);
 
   void evalRouteDem(const std::vector<NetWork*>& network_list,int32_t thread_num);
+  void evalPatternRouteDem(const std::vector<NetWork*>& network_list, int32_t thread_num);
+  int32_t get_pattern_rerouted_net_num() const { return _pattern_route_estimator.get_rerouted_net_num(); }
+  PatternRouteEstimator& get_pattern_route_estimator() { return _pattern_route_estimator; }
   void evalRouteCap(int32_t thread_num);
   void evalRouteUtil();
   void plotRouteCap();
@@ -101,6 +106,7 @@ class BinGrid
  private:
   GridManager* _grid_manager;
   int32_t _thread_nums;
+  PatternRouteEstimator _pattern_route_estimator;
 
   std::vector<NesInstance*> _macro_inst_list;
   std::vector<NesInstance*> _stdcell_list;
@@ -124,6 +130,7 @@ class BinGrid
   std::vector<AreaInfo> _bin_area_list;
 
   void resetBinToArea();
+  void accumulateOccupiedArea(std::vector<NesInstance*>& nInst_list, bool is_macro, int32_t thread_num);
 
   float calcLness(std::vector<std::pair<int32_t, int32_t>>& point_set, int32_t xmin, int32_t xmax, int32_t ymin, int32_t ymax);
   int64_t calcLowerLeftRP(std::vector<std::pair<int32_t, int32_t>>& point_set, int32_t xmin, int32_t ymin);
@@ -137,7 +144,11 @@ class BinGrid
   void addBinFillerAreaInfo(Grid* bin, int64_t filler_area);
 };
 inline BinGrid::BinGrid(GridManager* grid_manager)
-    : _grid_manager(grid_manager), _thread_nums(1), _overflow_area_wfiller(INT64_MIN), _overflow_area_wofiller(INT64_MIN)
+    : _grid_manager(grid_manager),
+      _thread_nums(1),
+      _pattern_route_estimator(grid_manager),
+      _overflow_area_wfiller(INT64_MIN),
+      _overflow_area_wofiller(INT64_MIN)
 {
   _bin_cnt_x = _grid_manager->get_grid_cnt_x();
   _bin_cnt_y = _grid_manager->get_grid_cnt_y();
@@ -189,24 +200,7 @@ inline void BinGrid::addBinnInstConnection(Grid* bin, NesInstance* nInst)
 inline void BinGrid::updateBinGrid(std::vector<NesInstance*>& nInst_list, int32_t thread_num)
 {
   updataOverflowArea(nInst_list, thread_num);
-
-#pragma omp parallel for num_threads(thread_num)
-  for (auto* nInst : _filler_list) {
-    auto nInst_density_shape = std::move(nInst->get_density_shape());
-
-    std::vector<Grid*> overlap_grid_list;
-    _grid_manager->obtainOverlapGridList(overlap_grid_list, nInst_density_shape);
-    for (auto* grid : overlap_grid_list) {
-      auto& grid_area_ref = grid->occupied_area;
-
-      int64_t overlap_area = _grid_manager->obtainOverlapArea(grid, nInst_density_shape);
-
-      int64_t inst_area = static_cast<int64_t>(overlap_area * nInst->get_density_scale());
-
-#pragma omp atomic
-      grid_area_ref += inst_area;
-    }
-  }
+  accumulateOccupiedArea(_filler_list, false, thread_num);
 }
 
 inline void BinGrid::updataOverflowArea(std::vector<NesInstance*>& nInst_list, int32_t thread_num)
@@ -214,48 +208,107 @@ inline void BinGrid::updataOverflowArea(std::vector<NesInstance*>& nInst_list, i
   int64_t overflow_area_wofiller = 0;
   _grid_manager->clearAllOccupiedArea();
 
-  for (auto* nInst : _macro_inst_list) {
-    auto nInst_density_shape = std::move(nInst->get_density_shape());
-    std::vector<Grid*> overlap_grid_list;
-    _grid_manager->obtainOverlapGridList(overlap_grid_list, nInst_density_shape);
-
-#pragma omp parallel for num_threads(thread_num)
-    for (auto* grid : overlap_grid_list) {
-      auto& grid_area_ref = grid->occupied_area;
-
-      int64_t overlap_area = _grid_manager->obtainOverlapArea(grid, nInst_density_shape);
-      int64_t inst_area = static_cast<int64_t>(overlap_area * nInst->get_density_scale());
-
-      inst_area *= grid->available_ratio;
+  accumulateOccupiedArea(_macro_inst_list, true, thread_num);
+  accumulateOccupiedArea(_stdcell_list, false, thread_num);
 
-#pragma omp atomic
-      grid_area_ref += inst_area;
+  for (auto& grid_row : _grid_manager->get_grid_2d_list()) {
+    for (auto& grid : grid_row) {
+      overflow_area_wofiller += grid.obtainGridOverflowArea();
     }
   }
+  _overflow_area_wofiller = overflow_area_wofiller;
+}
 
+inline void BinGrid::accumulateOccupiedArea(std::vector<NesInstance*>& nInst_list, bool is_macro, int32_t thread_num)
+{
+  if (nInst_list.empty() || _bin_cnt_x <= 0 || _bin_cnt_y <= 0) {
+    return;
+  }
+  thread_num = std::max(thread_num, 1);
+
+  auto& grid_2d_list = _grid_manager->get_grid_2d_list();
+  auto region = _grid_manager->get_shape();
+  Utility utility = _grid_manager->get_utility();
+
+  // Bin rows are split into bands and every band is accumulated by one thread, an instance crossing
+  // the band boundary is visited by both bands. No bin is shared between threads, so there is no atomic,
+  // and the integer sum is the same as the serial one whatever the thread number is.
+  int32_t band_num = std::min(_bin_cnt_y, thread_num * 4);
+  int32_t band_row_num = (_bin_cnt_y + band_num - 1) / band_num;
+  band_num = (_bin_cnt_y + band_row_num - 1) / band_row_num;
+
+  int32_t inst_num = nInst_list.size();
+  std::vector<std::pair<int32_t, int32_t>> x_range_list(inst_num);
+  std::vector<std::pair<int32_t, int32_t>> y_range_list(inst_num);
 #pragma omp parallel for num_threads(thread_num)
-  for (auto* nInst : _stdcell_list) {
-    auto nInst_density_shape = std::move(nInst->get_density_shape());
-
-    std::vector<Grid*> overlap_grid_list;
-    _grid_manager->obtainOverlapGridList(overlap_grid_list, nInst_density_shape);
-    for (auto* grid : overlap_grid_list) {
-      auto& grid_area_ref = grid->occupied_area;
-
-      int64_t overlap_area = _grid_manager->obtainOverlapArea(grid, nInst_density_shape);
-      int64_t inst_area = static_cast<int64_t>(overlap_area * nInst->get_density_scale());
+  for (int32_t i = 0; i < inst_num; i++) {
+    auto density_shape = nInst_list[i]->get_density_shape();
+    auto x_range = utility.obtainMinMaxIdx(region.get_ll_x(), _bin_size_x, density_shape.get_ll_x(), density_shape.get_ur_x());
+    auto y_range = utility.obtainMinMaxIdx(region.get_ll_y(), _bin_size_y, density_shape.get_ll_y(), density_shape.get_ur_y());
+    utility.correctPairRange(x_range, 0, _bin_cnt_x);
+    utility.correctPairRange(y_range, 0, _bin_cnt_y);
+    x_range_list[i] = x_range;
+    y_range_list[i] = y_range;
+  }
 
-#pragma omp atomic
-      grid_area_ref += inst_area;
+  std::vector<std::vector<int32_t>> band_inst_list(band_num);
+  for (int32_t i = 0; i < inst_num; i++) {
+    if (x_range_list[i].first >= x_range_list[i].second || y_range_list[i].first >= y_range_list[i].second) {
+      continue;
+    }
+    for (int32_t band_idx = y_range_list[i].first / band_row_num; band_idx <= (y_range_list[i].second - 1) / band_row_num; band_idx++) {
+      band_inst_list[band_idx].push_back(i);
     }
   }
 
-  for (auto& grid_row : _grid_manager->get_grid_2d_list()) {
-    for (auto& grid : grid_row) {
-      overflow_area_wofiller += grid.obtainGridOverflowArea();
+#pragma omp parallel for num_threads(thread_num) schedule(dynamic, 1)
+  for (int32_t band_idx = 0; band_idx < band_num; band_idx++) {
+    int32_t band_min_row = band_idx * band_row_num;
+    int32_t band_max_row = std::min(band_min_row + band_row_num, _bin_cnt_y);
+
+    // the bins are uniform, so the overlap area is the product of x overlap and y overlap.
+    std::vector<int64_t> overlap_x_list;
+    std::vector<int64_t> inst_area_list;
+    for (int32_t inst_idx : band_inst_list[band_idx]) {
+      auto* nInst = nInst_list[inst_idx];
+      auto density_shape = nInst->get_density_shape();
+      float density_scale = nInst->get_density_scale();
+
+      int32_t x_min = x_range_list[inst_idx].first;
+      int32_t x_cnt = x_range_list[inst_idx].second - x_min;
+      overlap_x_list.resize(x_cnt);
+      inst_area_list.resize(x_cnt);
+      for (int32_t j = 0; j < x_cnt; j++) {
+        auto& grid_shape = grid_2d_list[0][x_min + j].shape;
+        int64_t overlap_lx = std::max(grid_shape.get_ll_x(), density_shape.get_ll_x());
+        int64_t overlap_ux = std::min(grid_shape.get_ur_x(), density_shape.get_ur_x());
+        overlap_x_list[j] = std::max(int64_t(0), overlap_ux - overlap_lx);
+      }
+
+      int32_t row_min = std::max(y_range_list[inst_idx].first, band_min_row);
+      int32_t row_max = std::min(y_range_list[inst_idx].second, band_max_row);
+      for (int32_t i = row_min; i < row_max; i++) {
+        auto& grid_row = grid_2d_list[i];
+        int64_t overlap_ly = std::max(grid_row[x_min].shape.get_ll_y(), density_shape.get_ll_y());
+        int64_t overlap_uy = std::min(grid_row[x_min].shape.get_ur_y(), density_shape.get_ur_y());
+        int64_t overlap_y = std::max(int64_t(0), overlap_uy - overlap_ly);
+
+#pragma omp simd
+        for (int32_t j = 0; j < x_cnt; j++) {
+          inst_area_list[j] = static_cast<int64_t>(overlap_x_list[j] * overlap_y * density_scale);
+        }
+
+        for (int32_t j = 0; j < x_cnt; j++) {
+          auto& grid = grid_row[x_min + j];
+          int64_t inst_area = inst_area_list[j];
+          if (is_macro) {
+            inst_area *= grid.available_ratio;
+          }
+          grid.occupied_area += inst_area;
+        }
+      }
     }
   }
-  _overflow_area_wofiller = overflow_area_wofiller;
 }
 
 inline void BinGrid::evalRouteDem(const std::vector<NetWork*>& network_list,int32_t thread_num)
@@ -351,6 +404,14 @@ inline void BinGrid::evalRouteDem(const std::vector<NetWork*>& network_list,int3
   }
 }
 
+inline void BinGrid::evalPatternRouteDem(const std::vector<NetWork*>& network_list, int32_t thread_num)
+{
+  // a track through a grid counts as its wire area (length times pitch), so the util is the used fraction of tracks.
+  float wire_space_h = _route_cap_h > 0 ? _bin_size_y / (static_cast<float>(_route_cap_h) / _bin_cnt_y) : _bin_size_y;
+  float wire_space_v = _route_cap_v > 0 ? _bin_size_x / (static_cast<float>(_route_cap_v) / _bin_cnt_x) : _bin_size_x;
+  _pattern_route_estimator.evalRouteDem(network_list, _bin_size_x * wire_space_h, _bin_size_y * wire_space_v, thread_num);
+}
+
 inline void BinGrid::fastGaussianBlur()
 {
   _grid_manager->blurRouteDemand();
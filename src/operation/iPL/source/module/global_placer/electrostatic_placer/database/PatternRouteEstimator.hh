@@ -0,0 +1,474 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+/*
+ * @Description: Fast L/Z pattern route congestion estimate on the GridManager grid, incremental in moved nets.
+ */
+
+#ifndef IPL_OPERATOR_NESTEROV_PLACE_DATABASE_PATTERN_ROUTE_ESTIMATOR_H
+#define IPL_OPERATOR_NESTEROV_PLACE_DATABASE_PATTERN_ROUTE_ESTIMATOR_H
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <vector>
+
+#include "GridManager.hh"
+#include "TopologyManager.hh"
+
+namespace ipl {
+
+class PatternRouteEstimator
+{
+ public:
+  PatternRouteEstimator() = delete;
+  explicit PatternRouteEstimator(GridManager* grid_manager);
+  PatternRouteEstimator(const PatternRouteEstimator&) = delete;
+  PatternRouteEstimator(PatternRouteEstimator&&) = delete;
+  ~PatternRouteEstimator() = default;
+
+  PatternRouteEstimator& operator=(const PatternRouteEstimator&) = delete;
+  PatternRouteEstimator& operator=(PatternRouteEstimator&&) = delete;
+
+  int32_t get_rerouted_net_num() const { return _rerouted_net_num; }
+
+  // Route the nets whose pin grids changed since the last call and write the track demand, scaled by h_unit / v_unit,
+  // into grid h_cong / v_cong. Unchanged nets keep their previous route.
+  void evalRouteDem(const std::vector<NetWork*>& network_list, float h_unit, float v_unit, int32_t thread_num);
+  void reset();
+
+  // flattened route of every net for checkpoints: net num, then per net the pin grids and the segments.
+  std::vector<int32_t> obtainRouteStateList() const;
+  bool restoreRouteStateList(const std::vector<int32_t>& state_list);
+
+ private:
+  // wire over grids [lo, hi] of one row (horizontal) or one column (vertical).
+  struct Segment
+  {
+    int32_t track;
+    int32_t lo;
+    int32_t hi;
+    bool is_horizontal;
+  };
+
+  GridManager* _grid_manager;
+  int32_t _grid_cnt_x;
+  int32_t _grid_cnt_y;
+  int32_t _rerouted_net_num;
+
+  std::vector<std::vector<int32_t>> _net_pin_grid_list;
+  std::vector<std::vector<Segment>> _net_segment_list;
+
+  // track demand kept as per-row / per-column difference arrays, so rip-up and reroute are O(1) per segment.
+  std::vector<int32_t> _h_diff_list;
+  std::vector<int32_t> _v_diff_list;
+  std::vector<int32_t> _h_dem_list;
+  std::vector<int32_t> _v_dem_list;
+
+  // prefix sums of the per grid cost along rows (h) and columns (v).
+  std::vector<float> _h_cost_prefix_list;
+  std::vector<float> _v_cost_prefix_list;
+
+  void obtainPinGridList(NetWork* network, std::vector<int32_t>& pin_grid_list);
+  void updateCostPrefix(float h_unit, float v_unit, int32_t thread_num);
+  void routeNet(const std::vector<int32_t>& pin_grid_list, std::vector<Segment>& segment_list);
+  void routeTwoPin(int32_t x1, int32_t y1, int32_t x2, int32_t y2, std::vector<Segment>& segment_list);
+  float obtainHCost(int32_t row, int32_t x1, int32_t x2);
+  float obtainVCost(int32_t column, int32_t y1, int32_t y2);
+  void addSegment(std::vector<Segment>& segment_list, bool is_horizontal, int32_t track, int32_t a, int32_t b);
+  void applySegmentList(const std::vector<Segment>& segment_list, int32_t delta);
+};
+inline PatternRouteEstimator::PatternRouteEstimator(GridManager* grid_manager) : _grid_manager(grid_manager), _rerouted_net_num(0)
+{
+  _grid_cnt_x = _grid_manager->get_grid_cnt_x();
+  _grid_cnt_y = _grid_manager->get_grid_cnt_y();
+  reset();
+}
+
+inline void PatternRouteEstimator::reset()
+{
+  _net_pin_grid_list.clear();
+  _net_segment_list.clear();
+  _h_diff_list.assign(static_cast<size_t>(_grid_cnt_y) * (_grid_cnt_x + 1), 0);
+  _v_diff_list.assign(static_cast<size_t>(_grid_cnt_x) * (_grid_cnt_y + 1), 0);
+  _h_dem_list.assign(static_cast<size_t>(_grid_cnt_y) * _grid_cnt_x, 0);
+  _v_dem_list.assign(static_cast<size_t>(_grid_cnt_x) * _grid_cnt_y, 0);
+  _h_cost_prefix_list.assign(static_cast<size_t>(_grid_cnt_y) * (_grid_cnt_x + 1), 0.0F);
+  _v_cost_prefix_list.assign(static_cast<size_t>(_grid_cnt_x) * (_grid_cnt_y + 1), 0.0F);
+}
+
+inline void PatternRouteEstimator::evalRouteDem(const std::vector<NetWork*>& network_list, float h_unit, float v_unit,
+                                                int32_t thread_num)
+{
+  if (_net_pin_grid_list.size() != network_list.size()) {
+    reset();
+    _net_pin_grid_list.resize(network_list.size());
+    _net_segment_list.resize(network_list.size());
+  }
+
+  // nets are routed against the congestion of the previous call, so the result does not depend on the routing order.
+  updateCostPrefix(h_unit, v_unit, thread_num);
+
+  std::vector<std::vector<int32_t>> new_pin_grid_list(network_list.size());
+  std::vector<std::vector<Segment>> new_segment_list(network_list.size());
+  std::vector<char> is_changed_list(network_list.size(), 0);
+
+  int32_t net_chunk_size = std::max(int(network_list.size() / thread_num / 16), 1);
+#pragma omp parallel for num_threads(thread_num) schedule(dynamic, net_chunk_size)
+  for (size_t i = 0; i < network_list.size(); i++) {
+    auto* network = network_list[i];
+    if (!network->isIgnoreNetwork()) {
+      obtainPinGridList(network, new_pin_grid_list[i]);
+    }
+    if (new_pin_grid_list[i] == _net_pin_grid_list[i]) {
+      continue;
+    }
+    is_changed_list[i] = 1;
+    routeNet(new_pin_grid_list[i], new_segment_list[i]);
+  }
+
+  _rerouted_net_num = 0;
+  for (size_t i = 0; i < network_list.size(); i++) {
+    if (!is_changed_list[i]) {
+      continue;
+    }
+    applySegmentList(_net_segment_list[i], -1);
+    applySegmentList(new_segment_list[i], 1);
+    _net_pin_grid_list[i].swap(new_pin_grid_list[i]);
+    _net_segment_list[i].swap(new_segment_list[i]);
+    _rerouted_net_num++;
+  }
+
+  auto& grid_2d_list = _grid_manager->get_grid_2d_list();
+#pragma omp parallel for num_threads(thread_num)
+  for (int32_t i = 0; i < _grid_cnt_y; i++) {
+    const int32_t* diff = &_h_diff_list[static_cast<size_t>(i) * (_grid_cnt_x + 1)];
+    int32_t* dem = &_h_dem_list[static_cast<size_t>(i) * _grid_cnt_x];
+    int32_t sum = 0;
+    for (int32_t j = 0; j < _grid_cnt_x; j++) {
+      sum += diff[j];
+      dem[j] = sum;
+      grid_2d_list[i][j].h_cong = sum * h_unit;
+    }
+  }
+#pragma omp parallel for num_threads(thread_num)
+  for (int32_t j = 0; j < _grid_cnt_x; j++) {
+    const int32_t* diff = &_v_diff_list[static_cast<size_t>(j) * (_grid_cnt_y + 1)];
+    int32_t* dem = &_v_dem_list[static_cast<size_t>(j) * _grid_cnt_y];
+    int32_t sum = 0;
+    for (int32_t i = 0; i < _grid_cnt_y; i++) {
+      sum += diff[i];
+      dem[i] = sum;
+      grid_2d_list[i][j].v_cong = sum * v_unit;
+    }
+  }
+}
+
+inline std::vector<int32_t> PatternRouteEstimator::obtainRouteStateList() const
+{
+  std::vector<int32_t> state_list;
+  state_list.push_back(static_cast<int32_t>(_net_pin_grid_list.size()));
+  for (size_t i = 0; i < _net_pin_grid_list.size(); i++) {
+    state_list.push_back(static_cast<int32_t>(_net_pin_grid_list[i].size()));
+    state_list.insert(state_list.end(), _net_pin_grid_list[i].begin(), _net_pin_grid_list[i].end());
+    state_list.push_back(static_cast<int32_t>(_net_segment_list[i].size()));
+    for (auto& segment : _net_segment_list[i]) {
+      state_list.push_back(segment.track);
+      state_list.push_back(segment.lo);
+      state_list.push_back(segment.hi);
+      state_list.push_back(segment.is_horizontal ? 1 : 0);
+    }
+  }
+  return state_list;
+}
+
+inline bool PatternRouteEstimator::restoreRouteStateList(const std::vector<int32_t>& state_list)
+{
+  size_t pos = 0;
+  auto read = [&state_list, &pos](int32_t& value) {
+    if (pos >= state_list.size()) {
+      return false;
+    }
+    value = state_list[pos++];
+    return true;
+  };
+
+  // parse everything first, the current route is kept if the state does not fit this grid.
+  int32_t net_num = 0;
+  if (!read(net_num) || net_num < 0) {
+    return false;
+  }
+  std::vector<std::vector<int32_t>> net_pin_grid_list(net_num);
+  std::vector<std::vector<Segment>> net_segment_list(net_num);
+  int32_t grid_num = _grid_cnt_x * _grid_cnt_y;
+  for (int32_t i = 0; i < net_num; i++) {
+    int32_t pin_num = 0;
+    if (!read(pin_num) || pin_num < 0 || static_cast<size_t>(pin_num) > state_list.size() - pos) {
+      return false;
+    }
+    net_pin_grid_list[i].resize(pin_num);
+    for (auto& pin_grid : net_pin_grid_list[i]) {
+      if (!read(pin_grid) || pin_grid < 0 || pin_grid >= grid_num) {
+        return false;
+      }
+    }
+
+    int32_t segment_num = 0;
+    if (!read(segment_num) || segment_num < 0 || static_cast<size_t>(segment_num) > (state_list.size() - pos) / 4) {
+      return false;
+    }
+    net_segment_list[i].resize(segment_num);
+    for (auto& segment : net_segment_list[i]) {
+      int32_t is_horizontal = 0;
+      if (!read(segment.track) || !read(segment.lo) || !read(segment.hi) || !read(is_horizontal)) {
+        return false;
+      }
+      segment.is_horizontal = (is_horizontal != 0);
+      int32_t track_cnt = segment.is_horizontal ? _grid_cnt_y : _grid_cnt_x;
+      int32_t grid_cnt = segment.is_horizontal ? _grid_cnt_x : _grid_cnt_y;
+      if (segment.track < 0 || segment.track >= track_cnt || segment.lo < 0 || segment.lo > segment.hi || segment.hi >= grid_cnt) {
+        return false;
+      }
+    }
+  }
+  if (pos != state_list.size()) {
+    return false;
+  }
+
+  reset();
+  _net_pin_grid_list = std::move(net_pin_grid_list);
+  _net_segment_list = std::move(net_segment_list);
+  for (auto& segment_list : _net_segment_list) {
+    applySegmentList(segment_list, 1);
+  }
+  for (int32_t i = 0; i < _grid_cnt_y; i++) {
+    int32_t sum = 0;
+    for (int32_t j = 0; j < _grid_cnt_x; j++) {
+      sum += _h_diff_list[static_cast<size_t>(i) * (_grid_cnt_x + 1) + j];
+      _h_dem_list[static_cast<size_t>(i) * _grid_cnt_x + j] = sum;
+    }
+  }
+  for (int32_t j = 0; j < _grid_cnt_x; j++) {
+    int32_t sum = 0;
+    for (int32_t i = 0; i < _grid_cnt_y; i++) {
+      sum += _v_diff_list[static_cast<size_t>(j) * (_grid_cnt_y + 1) + i];
+      _v_dem_list[static_cast<size_t>(j) * _grid_cnt_y + i] = sum;
+    }
+  }
+  return true;
+}
+
+inline void PatternRouteEstimator::obtainPinGridList(NetWork* network, std::vector<int32_t>& pin_grid_list)
+{
+  Rectangle<int32_t> shape = _grid_manager->get_shape();
+  int32_t grid_size_x = _grid_manager->get_grid_size_x();
+  int32_t grid_size_y = _grid_manager->get_grid_size_y();
+
+  for (auto* node : network->get_node_list()) {
+    Point<int32_t> location = node->get_location();
+    int32_t x = std::clamp((location.get_x() - shape.get_ll_x()) / grid_size_x, 0, _grid_cnt_x - 1);
+    int32_t y = std::clamp((location.get_y() - shape.get_ll_y()) / grid_size_y, 0, _grid_cnt_y - 1);
+    pin_grid_list.push_back(y * _grid_cnt_x + x);
+  }
+  std::sort(pin_grid_list.begin(), pin_grid_list.end());
+  pin_grid_list.erase(std::unique(pin_grid_list.begin(), pin_grid_list.end()), pin_grid_list.end());
+  if (pin_grid_list.size() < 2) {
+    pin_grid_list.clear();
+  }
+}
+
+inline void PatternRouteEstimator::updateCostPrefix(float h_unit, float v_unit, int32_t thread_num)
+{
+  // cost of one track through a grid rises smoothly once the utilization approaches its capacity.
+  auto obtainGridCost = [](int32_t dem, float cap) {
+    float util = cap > 0 ? dem / cap : 2.0F;
+    return 1.0F + 1.0F / (1.0F + std::exp(-4.0F * (util - 1.0F)));
+  };
+
+  auto& grid_2d_list = _grid_manager->get_grid_2d_list();
+#pragma omp parallel for num_threads(thread_num)
+  for (int32_t i = 0; i < _grid_cnt_y; i++) {
+    float* prefix = &_h_cost_prefix_list[static_cast<size_t>(i) * (_grid_cnt_x + 1)];
+    const int32_t* dem = &_h_dem_list[static_cast<size_t>(i) * _grid_cnt_x];
+    prefix[0] = 0.0F;
+    for (int32_t j = 0; j < _grid_cnt_x; j++) {
+      prefix[j + 1] = prefix[j] + obtainGridCost(dem[j], grid_2d_list[i][j].h_cap / h_unit);
+    }
+  }
+#pragma omp parallel for num_threads(thread_num)
+  for (int32_t j = 0; j < _grid_cnt_x; j++) {
+    float* prefix = &_v_cost_prefix_list[static_cast<size_t>(j) * (_grid_cnt_y + 1)];
+    const int32_t* dem = &_v_dem_list[static_cast<size_t>(j) * _grid_cnt_y];
+    prefix[0] = 0.0F;
+    for (int32_t i = 0; i < _grid_cnt_y; i++) {
+      prefix[i + 1] = prefix[i] + obtainGridCost(dem[i], grid_2d_list[i][j].v_cap / v_unit);
+    }
+  }
+}
+
+inline void PatternRouteEstimator::routeNet(const std::vector<int32_t>& pin_grid_list, std::vector<Segment>& segment_list)
+{
+  int32_t pin_num = pin_grid_list.size();
+  if (pin_num < 2) {
+    return;
+  }
+
+  std::vector<int32_t> x_list(pin_num);
+  std::vector<int32_t> y_list(pin_num);
+  for (int32_t i = 0; i < pin_num; i++) {
+    x_list[i] = pin_grid_list[i] % _grid_cnt_x;
+    y_list[i] = pin_grid_list[i] / _grid_cnt_x;
+  }
+
+  // small nets are decomposed by a Prim MST, large ones by a chain along the longer side of the bounding box.
+  const int32_t max_mst_pin_num = 32;
+  if (pin_num <= max_mst_pin_num) {
+    std::vector<char> is_connected(pin_num, 0);
+    std::vector<int32_t> min_dist(pin_num, INT32_MAX);
+    std::vector<int32_t> parent(pin_num, 0);
+    int32_t cur = 0;
+    is_connected[cur] = 1;
+    for (int32_t k = 1; k < pin_num; k++) {
+      int32_t next = -1;
+      for (int32_t i = 0; i < pin_num; i++) {
+        if (is_connected[i]) {
+          continue;
+        }
+        int32_t dist = std::abs(x_list[i] - x_list[cur]) + std::abs(y_list[i] - y_list[cur]);
+        if (dist < min_dist[i]) {
+          min_dist[i] = dist;
+          parent[i] = cur;
+        }
+        if (next == -1 || min_dist[i] < min_dist[next]) {
+          next = i;
+        }
+      }
+      is_connected[next] = 1;
+      routeTwoPin(x_list[parent[next]], y_list[parent[next]], x_list[next], y_list[next], segment_list);
+      cur = next;
+    }
+  } else {
+    auto x_range = std::minmax_element(x_list.begin(), x_list.end());
+    auto y_range = std::minmax_element(y_list.begin(), y_list.end());
+    bool is_sort_by_x = (*x_range.second - *x_range.first) >= (*y_range.second - *y_range.first);
+
+    std::vector<int32_t> order(pin_num);
+    for (int32_t i = 0; i < pin_num; i++) {
+      order[i] = i;
+    }
+    const auto& key_list = is_sort_by_x ? x_list : y_list;
+    std::stable_sort(order.begin(), order.end(), [&key_list](int32_t a, int32_t b) { return key_list[a] < key_list[b]; });
+    for (int32_t k = 1; k < pin_num; k++) {
+      routeTwoPin(x_list[order[k - 1]], y_list[order[k - 1]], x_list[order[k]], y_list[order[k]], segment_list);
+    }
+  }
+}
+
+inline void PatternRouteEstimator::routeTwoPin(int32_t x1, int32_t y1, int32_t x2, int32_t y2, std::vector<Segment>& segment_list)
+{
+  if (x1 == x2 || y1 == y2) {
+    addSegment(segment_list, true, y1, x1, x2);
+    addSegment(segment_list, false, x1, y1, y2);
+    return;
+  }
+
+  // HVH patterns bend at column c, VHV patterns bend at row r; the end values of c and r are the two L shapes.
+  float best_cost = FLT_MAX;
+  bool best_is_hvh = true;
+  int32_t best_bend = x1;
+  int32_t step_x = x2 > x1 ? 1 : -1;
+  for (int32_t c = x1;; c += step_x) {
+    float cost = obtainHCost(y1, x1, c) + obtainVCost(c, y1, y2) + obtainHCost(y2, c, x2);
+    if (cost < best_cost) {
+      best_cost = cost;
+      best_is_hvh = true;
+      best_bend = c;
+    }
+    if (c == x2) {
+      break;
+    }
+  }
+  int32_t step_y = y2 > y1 ? 1 : -1;
+  for (int32_t r = y1;; r += step_y) {
+    float cost = obtainVCost(x1, y1, r) + obtainHCost(r, x1, x2) + obtainVCost(x2, r, y2);
+    if (cost < best_cost) {
+      best_cost = cost;
+      best_is_hvh = false;
+      best_bend = r;
+    }
+    if (r == y2) {
+      break;
+    }
+  }
+
+  if (best_is_hvh) {
+    addSegment(segment_list, true, y1, x1, best_bend);
+    addSegment(segment_list, false, best_bend, y1, y2);
+    addSegment(segment_list, true, y2, best_bend, x2);
+  } else {
+    addSegment(segment_list, false, x1, y1, best_bend);
+    addSegment(segment_list, true, best_bend, x1, x2);
+    addSegment(segment_list, false, x2, best_bend, y2);
+  }
+}
+
+inline float PatternRouteEstimator::obtainHCost(int32_t row, int32_t x1, int32_t x2)
+{
+  if (x1 == x2) {
+    return 0.0F;
+  }
+  const float* prefix = &_h_cost_prefix_list[static_cast<size_t>(row) * (_grid_cnt_x + 1)];
+  return prefix[std::max(x1, x2) + 1] - prefix[std::min(x1, x2)];
+}
+
+inline float PatternRouteEstimator::obtainVCost(int32_t column, int32_t y1, int32_t y2)
+{
+  if (y1 == y2) {
+    return 0.0F;
+  }
+  const float* prefix = &_v_cost_prefix_list[static_cast<size_t>(column) * (_grid_cnt_y + 1)];
+  return prefix[std::max(y1, y2) + 1] - prefix[std::min(y1, y2)];
+}
+
+inline void PatternRouteEstimator::addSegment(std::vector<Segment>& segment_list, bool is_horizontal, int32_t track, int32_t a,
+                                              int32_t b)
+{
+  if (a == b) {
+    return;
+  }
+  segment_list.push_back(Segment{track, std::min(a, b), std::max(a, b), is_horizontal});
+}
+
+inline void PatternRouteEstimator::applySegmentList(const std::vector<Segment>& segment_list, int32_t delta)
+{
+  for (auto& segment : segment_list) {
+    if (segment.is_horizontal) {
+      int32_t* diff = &_h_diff_list[static_cast<size_t>(segment.track) * (_grid_cnt_x + 1)];
+      diff[segment.lo] += delta;
+      diff[segment.hi + 1] -= delta;
+    } else {
+      int32_t* diff = &_v_diff_list[static_cast<size_t>(segment.track) * (_grid_cnt_y + 1)];
+      diff[segment.lo] += delta;
+      diff[segment.hi + 1] -= delta;
+    }
+  }
+}
+
+}  // namespace ipl
+
+#endif
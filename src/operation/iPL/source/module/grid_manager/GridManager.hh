@@ -90,12 +90,12 @@ public:
   int64_t fixed_area;
   int64_t placeable_area = 0;
 
-  float h_cong;
-  float v_cong;
+  float h_cong = 0.0F;
+  float v_cong = 0.0F;
   int32_t h_cap;
   int32_t v_cap;
-  float h_util;
-  float v_util;
+  float h_util = 0.0F;
+  float v_util = 0.0F;
   int num_node;
 
   std::vector<Grid*> neighbors;
@@ -129,6 +129,12 @@ class GridManager
   float get_h_util_sum() const {return _h_util_sum;}
   float get_v_util_sum() const {return _v_util_sum;}
 
+  // setter.
+  void set_h_util_max(float util) { _h_util_max = util; }
+  void set_v_util_max(float util) { _v_util_max = util; }
+  void set_h_util_sum(float util) { _h_util_sum = util; }
+  void set_v_util_sum(float util) { _v_util_sum = util; }
+
   // function.
   void obtainOverlapGridList(std::vector<Grid*>& grid_list, Rectangle<int32_t>& rect);
   std::vector<Rectangle<int32_t>> obtainAvailableRectList(int32_t row_low, int32_t row_high, int32_t grid_left, int32_t grid_right,
@@ -56,6 +56,7 @@ class DBWrapper
   virtual void updateFromSourceDataBase() = 0;
   virtual void updateFromSourceDataBase(std::vector<std::string> inst_list) = 0;
   virtual void writeBackSourceDatabase() = 0;
+  virtual void deleteInstances(std::vector<Instance*> inst_list) = 0;
   virtual void initInstancesForFragmentedRow() = 0;
   virtual void saveVerilogForDebug(std::string path) = 0;
 };
@@ -861,6 +861,24 @@ void IDBWrapper::writeBackSourceDatabase()
   }
 }
 
+void IDBWrapper::deleteInstances(std::vector<Instance*> inst_list)
+{
+  auto* idb_inst_list = _idbw_database->get_idb_builder()->get_def_service()->get_design()->get_instance_list();
+  for (auto* inst : inst_list) {
+    auto idb_inst_iter = _idbw_database->_idb_inst_map.find(inst);
+    if (idb_inst_iter != _idbw_database->_idb_inst_map.end()) {
+      _idbw_database->_ipl_inst_map.erase(idb_inst_iter->second);
+      _idbw_database->_idb_inst_map.erase(idb_inst_iter);
+    }
+    // instances added by iPL are written back by name without mapping.
+    idb_inst_list->remove_instance(inst->get_name());
+  }
+  _idbw_database->_design->remove_instance_list(inst_list);
+  for (auto* inst : inst_list) {
+    delete inst;
+  }
+}
+
 void IDBWrapper::writeDef(std::string file_name = "")
 {
   _idbw_database->_idb_builder->saveDef("./" + file_name);
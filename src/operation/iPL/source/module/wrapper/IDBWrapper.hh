@@ -62,6 +62,7 @@ class IDBWrapper : public DBWrapper
   void updateFromSourceDataBase() override;
   void updateFromSourceDataBase(std::vector<std::string> inst_list) override;
   void writeBackSourceDatabase() override;
+  void deleteInstances(std::vector<Instance*> inst_list) override;
   void initInstancesForFragmentedRow() override;
 
   // FOR DEBUG.
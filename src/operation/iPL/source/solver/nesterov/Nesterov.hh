@@ -61,6 +61,17 @@ class Nesterov
   void set_next_parameter(float next_parameter) { _next_parameter = next_parameter; }
   void set_next_steplength(float next_steplength) { _next_steplength = next_steplength; }
 
+  // for checkpoint
+  float get_current_parameter() const { return _current_parameter; }
+  float get_current_steplength() const { return _current_steplength; }
+  const std::vector<Point<int32_t>>& get_current_slp_coordis() const { return _current_slp_coordis; }
+  void set_current_iter(int current_iter) { _current_iter = current_iter; }
+  void set_current_parameter(float current_parameter) { _current_parameter = current_parameter; }
+  void set_current_steplength(float current_steplength) { _current_steplength = current_steplength; }
+  void set_current_coordis(const std::vector<Point<int32_t>>& current_coordis) { _current_coordis = current_coordis; }
+  void set_current_slp_coordis(const std::vector<Point<int32_t>>& current_slp_coordis) { _current_slp_coordis = current_slp_coordis; }
+  void set_current_gradients(const std::vector<Point<float>>& current_gradients) { _current_gradients = current_gradients; }
+
   // function.
   void initNesterov(std::vector<Point<int32_t>> previous_coordis, std::vector<Point<float>> previous_grads,
                     std::vector<Point<int32_t>> current_coordis, std::vector<Point<float>> current_grads);
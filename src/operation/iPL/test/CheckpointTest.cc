@@ -0,0 +1,85 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+/*
+ * @Description: A global placement resumed from a checkpoint ends where the uninterrupted run ends.
+ */
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "PLAPI.hh"
+#include "PlacerDB.hh"
+#include "gtest/gtest.h"
+#include "idm.h"
+
+namespace ipl {
+class CheckpointTest : public testing::Test
+{
+  void SetUp()
+  {
+    std::string idb_json_file = "/DREAMPlace/iEDA/bin/db_default_config_t28.json";
+    dmInst->init(idb_json_file);
+  }
+  void TearDown() final {}
+
+ protected:
+  std::vector<Point<int32_t>> obtainInstanceCenterList()
+  {
+    std::vector<Point<int32_t>> center_list;
+    for (auto* inst : PlacerDBInst.get_design()->get_instance_list()) {
+      center_list.push_back(inst->get_center_coordi());
+    }
+    return center_list;
+  }
+};
+
+TEST_F(CheckpointTest, resume_matches_straight_run)
+{
+  std::string pl_json_file = "/DREAMPlace/iEDA/bin/pl_default_config.json";
+  std::string checkpoint_path = "/tmp/ipl_checkpoint_test.bin";
+  auto* idb_builder = dmInst->get_idb_builder();
+
+  iPLAPIInst.initAPI(pl_json_file, idb_builder);
+
+  // one thread keeps the float reductions in a fixed order, routability inflation exercises the route state.
+  auto& nes_config = PlacerDBInst.get_placer_config()->get_nes_config();
+  nes_config.set_thread_num(1);
+  nes_config.set_routability_interval(10);
+  nes_config.set_checkpoint_interval(100);
+  nes_config.set_checkpoint_path(checkpoint_path);
+
+  // the straight run leaves the checkpoint of its last hundredth iteration behind.
+  iPLAPIInst.runGP();
+  std::vector<Point<int32_t>> straight_center_list = obtainInstanceCenterList();
+
+  // resume from it and finish the remaining iterations again.
+  nes_config.set_checkpoint_interval(0);
+  iPLAPIInst.resumeGP(checkpoint_path);
+  std::vector<Point<int32_t>> resume_center_list = obtainInstanceCenterList();
+
+  ASSERT_EQ(straight_center_list.size(), resume_center_list.size());
+  for (size_t i = 0; i < straight_center_list.size(); i++) {
+    EXPECT_EQ(straight_center_list[i].get_x(), resume_center_list[i].get_x()) << "instance " << i;
+    EXPECT_EQ(straight_center_list[i].get_y(), resume_center_list[i].get_y()) << "instance " << i;
+  }
+
+  iPLAPIInst.destoryInst();
+  std::remove(checkpoint_path.c_str());
+}
+
+}  // namespace ipl
@@ -36,6 +36,7 @@
 #include "icts_io.h"
 #include "idm.h"
 #include "idrc_api.h"
+#include "idrc_config.h"
 
 namespace irt {
 
@@ -81,6 +82,8 @@ void RTInterface::initRT(std::map<std::string, std::any> config_map)
   DataManager::initInst();
   RTDM.input(config_map, dmInst->get_idb_builder());
   GDSPlotter::initInst();
+  // TA经getViolationList调用iDRC时使用RT的线程数，DR用自身的shape索引检查，不调用iDRC
+  DrcConfigInst->set_thread_number(RTDM.getConfig().thread_number);
 
   RTLOG.info(Loc::current(), "Completed", monitor.getStatsInfo());
 }
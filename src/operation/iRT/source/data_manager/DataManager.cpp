@@ -82,14 +82,11 @@ void DataManager::updateFixedRectToGCellMap(ChangeType change_type, int32_t net_
 
   for (int32_t x = ext_layer_rect->get_grid_ll_x(); x <= ext_layer_rect->get_grid_ur_x(); x++) {
     for (int32_t y = ext_layer_rect->get_grid_ll_y(); y <= ext_layer_rect->get_grid_ur_y(); y++) {
-      auto& net_fixed_rect_map = gcell_map[x][y].get_type_layer_net_fixed_rect_map()[is_routing][ext_layer_rect->get_layer_idx()];
+      int32_t key = GCell::getFixedRectKey(is_routing, ext_layer_rect->get_layer_idx());
       if (change_type == ChangeType::kAdd) {
-        net_fixed_rect_map[net_idx].insert(ext_layer_rect);
+        gcell_map[x][y].get_fixed_rect_set().insert(net_idx, ext_layer_rect, key);
       } else {
-        net_fixed_rect_map[net_idx].erase(ext_layer_rect);
-        if (net_fixed_rect_map[net_idx].empty()) {
-          net_fixed_rect_map.erase(net_idx);
-        }
+        gcell_map[x][y].get_fixed_rect_set().erase(net_idx, ext_layer_rect, key);
       }
     }
   }
@@ -132,14 +129,10 @@ void DataManager::updateGlobalNetResultToGCellMap(ChangeType change_type, int32_
 
   for (int32_t x = first_x; x <= second_x; x++) {
     for (int32_t y = first_y; y <= second_y; y++) {
-      auto& global_net_result_map = gcell_map[x][y].get_global_net_result_map();
       if (change_type == ChangeType::kAdd) {
-        global_net_result_map[net_idx].insert(segment);
+        gcell_map[x][y].get_global_net_result_set().insert(net_idx, segment);
       } else {
-        global_net_result_map[net_idx].erase(segment);
-        if (global_net_result_map[net_idx].empty()) {
-          global_net_result_map.erase(net_idx);
-        }
+        gcell_map[x][y].get_global_net_result_set().erase(net_idx, segment);
       }
     }
   }
@@ -158,14 +151,10 @@ void DataManager::updateDetailedNetResultToGCellMap(ChangeType change_type, int3
 
   for (int32_t x = grid_rect.get_ll_x(); x <= grid_rect.get_ur_x(); x++) {
     for (int32_t y = grid_rect.get_ll_y(); y <= grid_rect.get_ur_y(); y++) {
-      auto& detailed_net_result_map = gcell_map[x][y].get_detailed_net_result_map();
       if (change_type == ChangeType::kAdd) {
-        detailed_net_result_map[net_idx].insert(segment);
+        gcell_map[x][y].get_detailed_net_result_set().insert(net_idx, segment);
       } else {
-        detailed_net_result_map[net_idx].erase(segment);
-        if (detailed_net_result_map[net_idx].empty()) {
-          detailed_net_result_map.erase(net_idx);
-        }
+        gcell_map[x][y].get_detailed_net_result_set().erase(net_idx, segment);
       }
     }
   }
@@ -181,14 +170,10 @@ void DataManager::updateNetPatchToGCellMap(ChangeType change_type, int32_t net_i
 
   for (int32_t x = ext_layer_rect->get_grid_ll_x(); x <= ext_layer_rect->get_grid_ur_x(); x++) {
     for (int32_t y = ext_layer_rect->get_grid_ll_y(); y <= ext_layer_rect->get_grid_ur_y(); y++) {
-      auto& net_patch_map = gcell_map[x][y].get_net_patch_map();
       if (change_type == ChangeType::kAdd) {
-        net_patch_map[net_idx].insert(ext_layer_rect);
+        gcell_map[x][y].get_net_patch_set().insert(net_idx, ext_layer_rect);
       } else {
-        net_patch_map[net_idx].erase(ext_layer_rect);
-        if (net_patch_map[net_idx].empty()) {
-          net_patch_map.erase(net_idx);
-        }
+        gcell_map[x][y].get_net_patch_set().erase(net_idx, ext_layer_rect);
       }
     }
   }
@@ -228,12 +213,10 @@ std::map<bool, std::map<int32_t, std::map<int32_t, std::set<EXTLayerRect*>>>> Da
   std::map<bool, std::map<int32_t, std::map<int32_t, std::set<EXTLayerRect*>>>> type_layer_net_fixed_rect_map;
   for (int32_t x = region.get_grid_ll_x(); x <= region.get_grid_ur_x(); x++) {
     for (int32_t y = region.get_grid_ll_y(); y <= region.get_grid_ur_y(); y++) {
-      for (auto& [is_routing, layer_net_fixed_rect_map] : gcell_map[x][y].get_type_layer_net_fixed_rect_map()) {
-        for (auto& [layer_idx, net_fixed_rect_map] : layer_net_fixed_rect_map) {
-          for (auto& [net_idx, fixed_rect_set] : net_fixed_rect_map) {
-            type_layer_net_fixed_rect_map[is_routing][layer_idx][net_idx].insert(fixed_rect_set.begin(), fixed_rect_set.end());
-          }
-        }
+      for (auto& fixed_rect : gcell_map[x][y].get_fixed_rect_set()) {
+        bool is_routing = GCell::isRoutingFixedRectKey(fixed_rect.key);
+        int32_t layer_idx = GCell::getLayerIdxByFixedRectKey(fixed_rect.key);
+        type_layer_net_fixed_rect_map[is_routing][layer_idx][fixed_rect.net_idx].insert(fixed_rect.item);
       }
     }
   }
@@ -262,8 +245,8 @@ std::map<int32_t, std::set<Segment<LayerCoord>*>> DataManager::getGlobalNetResul
   std::map<int32_t, std::set<Segment<LayerCoord>*>> global_net_result_map;
   for (int32_t x = region.get_grid_ll_x(); x <= region.get_grid_ur_x(); x++) {
     for (int32_t y = region.get_grid_ll_y(); y <= region.get_grid_ur_y(); y++) {
-      for (auto& [net_idx, result_set] : gcell_map[x][y].get_global_net_result_map()) {
-        global_net_result_map[net_idx].insert(result_set.begin(), result_set.end());
+      for (auto& net_item : gcell_map[x][y].get_global_net_result_set()) {
+        global_net_result_map[net_item.net_idx].insert(net_item.item);
       }
     }
   }
@@ -277,8 +260,8 @@ std::map<int32_t, std::set<Segment<LayerCoord>*>> DataManager::getDetailedNetRes
   std::map<int32_t, std::set<Segment<LayerCoord>*>> detailed_net_result_map;
   for (int32_t x = region.get_grid_ll_x(); x <= region.get_grid_ur_x(); x++) {
     for (int32_t y = region.get_grid_ll_y(); y <= region.get_grid_ur_y(); y++) {
-      for (auto& [net_idx, result_set] : gcell_map[x][y].get_detailed_net_result_map()) {
-        detailed_net_result_map[net_idx].insert(result_set.begin(), result_set.end());
+      for (auto& net_item : gcell_map[x][y].get_detailed_net_result_set()) {
+        detailed_net_result_map[net_item.net_idx].insert(net_item.item);
       }
     }
   }
@@ -292,8 +275,8 @@ std::map<int32_t, std::set<EXTLayerRect*>> DataManager::getNetPatchMap(EXTPlanar
   std::map<int32_t, std::set<EXTLayerRect*>> net_patch_map;
   for (int32_t x = region.get_grid_ll_x(); x <= region.get_grid_ur_x(); x++) {
     for (int32_t y = region.get_grid_ll_y(); y <= region.get_grid_ur_y(); y++) {
-      for (auto& [net_idx, patch_set] : gcell_map[x][y].get_net_patch_map()) {
-        net_patch_map[net_idx].insert(patch_set.begin(), patch_set.end());
+      for (auto& net_item : gcell_map[x][y].get_net_patch_set()) {
+        net_patch_map[net_item.net_idx].insert(net_item.item);
       }
     }
   }
@@ -1763,7 +1746,7 @@ void DataManager::buildGCellMap()
 
           for (int32_t x = ext_layer_rect->get_grid_ll_x(); x <= ext_layer_rect->get_grid_ur_x(); x++) {
             for (int32_t y = ext_layer_rect->get_grid_ll_y(); y <= ext_layer_rect->get_grid_ur_y(); y++) {
-              gcell_map[x][y].get_type_layer_net_fixed_rect_map()[is_routing][layer_idx][net_idx].insert(ext_layer_rect);
+              gcell_map[x][y].get_fixed_rect_set().append(net_idx, ext_layer_rect, GCell::getFixedRectKey(is_routing, layer_idx));
             }
           }
         }
@@ -1780,10 +1763,24 @@ void DataManager::buildGCellMap()
     bool is_routing = shape.is_routing;
     for (int32_t x = ext_layer_rect->get_grid_ll_x(); x <= ext_layer_rect->get_grid_ur_x(); x++) {
       for (int32_t y = ext_layer_rect->get_grid_ll_y(); y <= ext_layer_rect->get_grid_ur_y(); y++) {
-        gcell_map[x][y].get_type_layer_net_fixed_rect_map()[is_routing][layer_idx][net_idx].insert(ext_layer_rect);
+        gcell_map[x][y].get_fixed_rect_set().append(net_idx, ext_layer_rect, GCell::getFixedRectKey(is_routing, layer_idx));
       }
     }
   }
+  // 批量append后统一排序，并统计fixed_rect存储的内存
+  size_t fixed_rect_num = 0;
+  size_t fixed_rect_memory = 0;
+#pragma omp parallel for collapse(2) reduction(+ : fixed_rect_num, fixed_rect_memory)
+  for (int32_t x = 0; x < gcell_map.get_x_size(); x++) {
+    for (int32_t y = 0; y < gcell_map.get_y_size(); y++) {
+      NetItemSet<EXTLayerRect>& fixed_rect_set = gcell_map[x][y].get_fixed_rect_set();
+      fixed_rect_set.sortAndUnique();
+      fixed_rect_num += fixed_rect_set.size();
+      fixed_rect_memory += fixed_rect_set.getMemorySize();
+    }
+  }
+  RTLOG.info(Loc::current(), "The gcell fixed rect num is ", fixed_rect_num, ", memory is ",
+             RTUTIL.formatByTwoDecimalPlaces(fixed_rect_memory / 1024.0 / 1024.0), "MB");
   RTLOG.info(Loc::current(), "Completed", monitor.getStatsInfo());
 }
 
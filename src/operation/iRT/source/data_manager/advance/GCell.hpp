@@ -17,6 +17,7 @@
 #pragma once
 
 #include "AccessPoint.hpp"
+#include "NetItemSet.hpp"
 #include "Violation.hpp"
 
 namespace irt {
@@ -27,22 +28,15 @@ class GCell : public PlanarRect
   GCell() = default;
   ~GCell() = default;
   // getter
-  std::map<bool, std::map<int32_t, std::map<int32_t, std::set<EXTLayerRect*>>>>& get_type_layer_net_fixed_rect_map()
-  {
-    return _type_layer_net_fixed_rect_map;
-  }
+  NetItemSet<EXTLayerRect>& get_fixed_rect_set() { return _fixed_rect_set; }
   std::map<int32_t, std::set<AccessPoint*>>& get_net_access_point_map() { return _net_access_point_map; }
   std::map<int32_t, std::map<Orientation, int32_t>>& get_routing_orient_supply_map() { return _routing_orient_supply_map; }
-  std::map<int32_t, std::set<Segment<LayerCoord>*>>& get_global_net_result_map() { return _global_net_result_map; }
-  std::map<int32_t, std::set<Segment<LayerCoord>*>>& get_detailed_net_result_map() { return _detailed_net_result_map; }
-  std::map<int32_t, std::set<EXTLayerRect*>>& get_net_patch_map() { return _net_patch_map; }
+  NetItemSet<Segment<LayerCoord>>& get_global_net_result_set() { return _global_net_result_set; }
+  NetItemSet<Segment<LayerCoord>>& get_detailed_net_result_set() { return _detailed_net_result_set; }
+  NetItemSet<EXTLayerRect>& get_net_patch_set() { return _net_patch_set; }
   std::set<Violation*>& get_violation_set() { return _violation_set; }
   // setter
-  void set_type_layer_net_fixed_rect_map(
-      const std::map<bool, std::map<int32_t, std::map<int32_t, std::set<EXTLayerRect*>>>>& type_layer_net_fixed_rect_map)
-  {
-    _type_layer_net_fixed_rect_map = type_layer_net_fixed_rect_map;
-  }
+  void set_fixed_rect_set(const NetItemSet<EXTLayerRect>& fixed_rect_set) { _fixed_rect_set = fixed_rect_set; }
   void set_net_access_point_map(const std::map<int32_t, std::set<AccessPoint*>>& net_access_point_map)
   {
     _net_access_point_map = net_access_point_map;
@@ -51,31 +45,34 @@ class GCell : public PlanarRect
   {
     _routing_orient_supply_map = routing_orient_supply_map;
   }
-  void set_global_net_result_map(const std::map<int32_t, std::set<Segment<LayerCoord>*>>& global_net_result_map)
+  void set_global_net_result_set(const NetItemSet<Segment<LayerCoord>>& global_net_result_set)
   {
-    _global_net_result_map = global_net_result_map;
+    _global_net_result_set = global_net_result_set;
   }
-  void set_detailed_net_result_map(const std::map<int32_t, std::set<Segment<LayerCoord>*>>& detailed_net_result_map)
+  void set_detailed_net_result_set(const NetItemSet<Segment<LayerCoord>>& detailed_net_result_set)
   {
-    _detailed_net_result_map = detailed_net_result_map;
+    _detailed_net_result_set = detailed_net_result_set;
   }
-  void set_net_patch_map(const std::map<int32_t, std::set<EXTLayerRect*>>& net_patch_map) { _net_patch_map = net_patch_map; }
+  void set_net_patch_set(const NetItemSet<EXTLayerRect>& net_patch_set) { _net_patch_set = net_patch_set; }
   void set_violation_set(const std::set<Violation*>& violation_set) { _violation_set = violation_set; }
   // function
+  static int32_t getFixedRectKey(bool is_routing, int32_t layer_idx) { return layer_idx * 2 + (is_routing ? 1 : 0); }
+  static bool isRoutingFixedRectKey(int32_t key) { return key % 2 == 1; }
+  static int32_t getLayerIdxByFixedRectKey(int32_t key) { return key / 2; }
 
  private:
-  // obstacle & pin_shape 如果是routing则true，cut则false
-  std::map<bool, std::map<int32_t, std::map<int32_t, std::set<EXTLayerRect*>>>> _type_layer_net_fixed_rect_map;
+  // obstacle & pin_shape 以(type, layer)编码为key，routing为奇数，cut为偶数
+  NetItemSet<EXTLayerRect> _fixed_rect_set;
   // access point 只有routing层有
   std::map<int32_t, std::set<AccessPoint*>> _net_access_point_map;
   // global supply 三维 只有routing层有
   std::map<int32_t, std::map<Orientation, int32_t>> _routing_orient_supply_map;
   // global routing result
-  std::map<int32_t, std::set<Segment<LayerCoord>*>> _global_net_result_map;
+  NetItemSet<Segment<LayerCoord>> _global_net_result_set;
   // detail routing result
-  std::map<int32_t, std::set<Segment<LayerCoord>*>> _detailed_net_result_map;
+  NetItemSet<Segment<LayerCoord>> _detailed_net_result_set;
   // detail patch shape 只有routing层有
-  std::map<int32_t, std::set<EXTLayerRect*>> _net_patch_map;
+  NetItemSet<EXTLayerRect> _net_patch_set;
   // detail violation region
   std::set<Violation*> _violation_set;
 };
@@ -121,6 +121,12 @@ inline void GridMap<T>::init(int32_t x_size, int32_t y_size)
 {
   if constexpr (std::is_same<T, int32_t>::value || std::is_same<T, double>::value) {
     init(x_size, y_size, 0);
+  } else if constexpr (!std::is_copy_assignable<T>::value) {
+    // 只能移动的类型直接默认构造
+    freeDataMap();
+    _x_size = x_size;
+    _y_size = y_size;
+    initDataMap();
   } else {
     init(x_size, y_size, T());
   }
@@ -0,0 +1,90 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+namespace irt {
+
+// gcell上按(key, net_idx, item)排序的紧凑数组，替代std::map<int32_t, std::set<T*>>
+// key用于再分一级(如fixed_rect的type与layer)，不需要时为0
+template <typename T>
+class NetItemSet
+{
+ public:
+  struct NetItem
+  {
+    int32_t key = 0;
+    int32_t net_idx = -1;
+    T* item = nullptr;
+  };
+  NetItemSet() = default;
+  ~NetItemSet() = default;
+  // getter
+  std::vector<NetItem>& get_net_item_list() { return _net_item_list; }
+  // function
+  void insert(int32_t net_idx, T* item, int32_t key = 0)
+  {
+    NetItem net_item{key, net_idx, item};
+    auto iter = std::lower_bound(_net_item_list.begin(), _net_item_list.end(), net_item, CmpNetItem());
+    if (iter != _net_item_list.end() && isSame(*iter, net_item)) {
+      return;
+    }
+    _net_item_list.insert(iter, net_item);
+  }
+  void erase(int32_t net_idx, T* item, int32_t key = 0)
+  {
+    NetItem net_item{key, net_idx, item};
+    auto iter = std::lower_bound(_net_item_list.begin(), _net_item_list.end(), net_item, CmpNetItem());
+    if (iter != _net_item_list.end() && isSame(*iter, net_item)) {
+      _net_item_list.erase(iter);
+    }
+    if (_net_item_list.empty()) {
+      _net_item_list.shrink_to_fit();
+    }
+  }
+  // 批量插入后统一排序去重
+  void append(int32_t net_idx, T* item, int32_t key = 0) { _net_item_list.push_back(NetItem{key, net_idx, item}); }
+  void sortAndUnique()
+  {
+    std::sort(_net_item_list.begin(), _net_item_list.end(), CmpNetItem());
+    _net_item_list.erase(std::unique(_net_item_list.begin(), _net_item_list.end(), isSame), _net_item_list.end());
+    _net_item_list.shrink_to_fit();
+  }
+  bool empty() const { return _net_item_list.empty(); }
+  size_t size() const { return _net_item_list.size(); }
+  size_t getMemorySize() const { return sizeof(NetItemSet<T>) + _net_item_list.capacity() * sizeof(NetItem); }
+  typename std::vector<NetItem>::const_iterator begin() const { return _net_item_list.begin(); }
+  typename std::vector<NetItem>::const_iterator end() const { return _net_item_list.end(); }
+
+ private:
+  std::vector<NetItem> _net_item_list;
+  // function
+  struct CmpNetItem
+  {
+    bool operator()(const NetItem& a, const NetItem& b) const
+    {
+      return std::tie(a.key, a.net_idx, a.item) < std::tie(b.key, b.net_idx, b.item);
+    }
+  };
+  static bool isSame(const NetItem& a, const NetItem& b) { return a.key == b.key && a.net_idx == b.net_idx && a.item == b.item; }
+};
+
+}  // namespace irt
@@ -0,0 +1,74 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#pragma once
+
+#include <array>
+#include <utility>
+
+#include "Logger.hpp"
+#include "Orientation.hpp"
+
+namespace irt {
+
+// 以六个布线方向(east,west,south,north,above,below)为下标的定长数组，用于替代结点上的std::map<Orientation, T>
+template <typename T>
+class OrientArray
+{
+ public:
+  static constexpr int32_t kOrientNum = 6;
+
+  OrientArray()
+  {
+    for (int32_t i = 0; i < kOrientNum; i++) {
+      _orient_value_list[i] = std::make_pair(static_cast<Orientation>(i + 1), T());
+    }
+  }
+  ~OrientArray() = default;
+  // function
+  static bool isValid(Orientation orientation) { return Orientation::kEast <= orientation && orientation <= Orientation::kBelow; }
+  T& operator[](Orientation orientation) { return _orient_value_list[getIndex(orientation)].second; }
+  const T& operator[](Orientation orientation) const { return _orient_value_list[getIndex(orientation)].second; }
+  T get(Orientation orientation) const { return isValid(orientation) ? _orient_value_list[getIndex(orientation)].second : T(); }
+  // 非默认值的槽位数
+  int32_t size() const
+  {
+    int32_t size = 0;
+    for (const std::pair<Orientation, T>& orient_value : _orient_value_list) {
+      if (orient_value.second != T()) {
+        size++;
+      }
+    }
+    return size;
+  }
+  bool empty() const { return size() == 0; }
+  // 遍历全部六个槽位，使用时需跳过默认值
+  typename std::array<std::pair<Orientation, T>, kOrientNum>::iterator begin() { return _orient_value_list.begin(); }
+  typename std::array<std::pair<Orientation, T>, kOrientNum>::iterator end() { return _orient_value_list.end(); }
+
+ private:
+  std::array<std::pair<Orientation, T>, kOrientNum> _orient_value_list;
+  // function
+  static int32_t getIndex(Orientation orientation)
+  {
+    if (!isValid(orientation)) {
+      RTLOG.error(Loc::current(), "The orientation is out of bounds!");
+    }
+    return static_cast<int32_t>(orientation) - 1;
+  }
+};
+
+}  // namespace irt
@@ -0,0 +1,88 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#pragma once
+
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "Orientation.hpp"
+
+namespace irt {
+
+// 结点上各方向的net集合，结点上通常只有少量net，使用紧凑的小数组替代std::map<Orientation, std::set<int32_t>>
+class OrientNetSet
+{
+ public:
+  OrientNetSet() = default;
+  ~OrientNetSet() = default;
+  // function
+  void insert(Orientation orientation, int32_t net_idx)
+  {
+    if (!exist(orientation, net_idx)) {
+      _orient_net_list.emplace_back(orientation, net_idx);
+    }
+  }
+  void erase(Orientation orientation, int32_t net_idx)
+  {
+    for (size_t i = 0; i < _orient_net_list.size(); i++) {
+      if (_orient_net_list[i].first == orientation && _orient_net_list[i].second == net_idx) {
+        _orient_net_list[i] = _orient_net_list.back();
+        _orient_net_list.pop_back();
+        break;
+      }
+    }
+    if (_orient_net_list.empty()) {
+      _orient_net_list.shrink_to_fit();
+    }
+  }
+  bool exist(Orientation orientation, int32_t net_idx) const
+  {
+    for (const std::pair<Orientation, int32_t>& orient_net : _orient_net_list) {
+      if (orient_net.first == orientation && orient_net.second == net_idx) {
+        return true;
+      }
+    }
+    return false;
+  }
+  // 该方向上除net_idx外的net数
+  int32_t getOtherNetNum(Orientation orientation, int32_t net_idx) const
+  {
+    int32_t net_num = 0;
+    for (const std::pair<Orientation, int32_t>& orient_net : _orient_net_list) {
+      if (orient_net.first == orientation && orient_net.second != net_idx) {
+        net_num++;
+      }
+    }
+    return net_num;
+  }
+  bool empty() const { return _orient_net_list.empty(); }
+  std::map<Orientation, std::set<int32_t>> getOrientNetMap() const
+  {
+    std::map<Orientation, std::set<int32_t>> orient_net_map;
+    for (const std::pair<Orientation, int32_t>& orient_net : _orient_net_list) {
+      orient_net_map[orient_net.first].insert(orient_net.second);
+    }
+    return orient_net_map;
+  }
+
+ private:
+  std::vector<std::pair<Orientation, int32_t>> _orient_net_list;
+};
+
+}  // namespace irt
@@ -16,21 +16,67 @@
 // ***************************************************************************************
 #pragma once
 
+#include <cmath>
+#include <cstdint>
 #include <queue>
+#include <vector>
+
+#include "RTHeader.hpp"
 
 namespace irt {
 
-template <class T, class Container = std::vector<T>, class Compare = std::less<typename Container::value_type>>
-class PriorityQueue : public std::priority_queue<T, Container, Compare>
+// 基于std::priority_queue的open list，入队时保存代价快照，按(cost,tie_cost,tie_num)排序
+// 代价相同(误差RT_ERROR内)时tie_cost小者优先，再相同时tie_num大者优先，最后后入队者优先
+// 不支持decrease-key，代价降低时重复push，由调用者在pop时跳过已关闭的结点
+template <typename T>
+class PriorityQueue
 {
  public:
   PriorityQueue() = default;
   ~PriorityQueue() = default;
   // function
-  Container::iterator begin() { return this->c.begin(); }
-  Container::iterator end() { return this->c.end(); }
+  void push(const T& item, double cost, double tie_cost = 0, int32_t tie_num = 0)
+  {
+    _entry_queue.push(Entry{item, cost, tie_cost, tie_num, _order++});
+  }
+  const T& top() const { return _entry_queue.top().item; }
+  void pop() { _entry_queue.pop(); }
+  bool empty() const { return _entry_queue.empty(); }
+  size_t size() const { return _entry_queue.size(); }
+  void clear()
+  {
+    _entry_queue = std::priority_queue<Entry, std::vector<Entry>, CmpEntry>();
+    _order = 0;
+  }
 
  private:
+  // 入队时的代价快照，结点代价之后的变化不影响堆序
+  struct Entry
+  {
+    T item;
+    double cost;
+    double tie_cost;
+    int32_t tie_num;
+    uint64_t order;
+  };
+  struct CmpEntry
+  {
+    bool operator()(const Entry& a, const Entry& b) const
+    {
+      if (std::abs(a.cost - b.cost) > RT_ERROR) {
+        return a.cost > b.cost;
+      }
+      if (std::abs(a.tie_cost - b.tie_cost) > RT_ERROR) {
+        return a.tie_cost > b.tie_cost;
+      }
+      if (a.tie_num != b.tie_num) {
+        return a.tie_num < b.tie_num;
+      }
+      return a.order < b.order;
+    }
+  };
+  std::priority_queue<Entry, std::vector<Entry>, CmpEntry> _entry_queue;
+  uint64_t _order = 0;
 };
 
 }  // namespace irt
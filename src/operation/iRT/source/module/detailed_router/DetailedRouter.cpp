@@ -168,6 +168,37 @@ void DetailedRouter::initDRBoxMap(DRModel& dr_model)
   int32_t y_box_num = std::ceil((y_gcell_num - offset) / 1.0 / size);
 
   GridMap<DRBox>& dr_box_map = dr_model.get_dr_box_map();
+  std::map<PlanarRect, DRBoxCache, CmpPlanarRectByXASC>& rect_box_cache_map = dr_model.get_rect_box_cache_map();
+  // 回收上一轮box的graph缓存
+  for (int32_t x = 0; x < dr_box_map.get_x_size(); x++) {
+    for (int32_t y = 0; y < dr_box_map.get_y_size(); y++) {
+      DRBox& dr_box = dr_box_map[x][y];
+      if (!dr_box.get_dr_box_cache().empty()) {
+        rect_box_cache_map[dr_box.get_box_rect().get_real_rect()] = std::move(dr_box.get_dr_box_cache());
+      }
+    }
+  }
+  // offset按{0,-3,-6}循环，超过一个周期未被复用的缓存释放
+  for (auto iter = rect_box_cache_map.begin(); iter != rect_box_cache_map.end();) {
+    if (dr_model.get_iter() - iter->second.get_iter() > 3) {
+      iter = rect_box_cache_map.erase(iter);
+    } else {
+      iter++;
+    }
+  }
+  // 超过上限时优先释放最旧的缓存
+  int32_t max_box_cache_num = getMaxBoxCacheNum();
+  if (static_cast<int32_t>(rect_box_cache_map.size()) > max_box_cache_num) {
+    std::vector<std::map<PlanarRect, DRBoxCache, CmpPlanarRectByXASC>::iterator> iter_list;
+    for (auto iter = rect_box_cache_map.begin(); iter != rect_box_cache_map.end(); iter++) {
+      iter_list.push_back(iter);
+    }
+    std::stable_sort(iter_list.begin(), iter_list.end(), [](auto& a, auto& b) { return a->second.get_iter() < b->second.get_iter(); });
+    for (size_t i = 0; i < iter_list.size() - max_box_cache_num; i++) {
+      rect_box_cache_map.erase(iter_list[i]);
+    }
+  }
+  dr_model.get_box_cache_num() = static_cast<int32_t>(rect_box_cache_map.size());
   dr_box_map.init(x_box_num, y_box_num);
 
   for (int32_t x = 0; x < dr_box_map.get_x_size(); x++) {
@@ -192,6 +223,10 @@ void DetailedRouter::initDRBoxMap(DRModel& dr_model)
       dr_box_id.set_y(y);
       dr_box.set_dr_box_id(dr_box_id);
       dr_box.set_dr_parameter(&dr_parameter);
+      if (RTUTIL.exist(rect_box_cache_map, box_real_rect)) {
+        dr_box.set_dr_box_cache(std::move(rect_box_cache_map[box_real_rect]));
+        rect_box_cache_map.erase(box_real_rect);
+      }
     }
   }
 }
@@ -235,21 +270,30 @@ void DetailedRouter::routeDRBoxMap(DRModel& dr_model)
 #pragma omp parallel for
     for (DRBoxId& dr_box_id : dr_box_id_list) {
       DRBox& dr_box = dr_box_map[dr_box_id.get_x()][dr_box_id.get_y()];
-      buildFixedRectList(dr_box);
+      // 跳过的box也要带上原结果，uploadNetResult只由box结果重建
       buildNetResultMap(dr_box);
+      if (!needBuilding(dr_box)) {
+        continue;
+      }
+      buildFixedRectList(dr_box);
       buildViolationList(dr_box);
       initDRTaskList(dr_model, dr_box);
       if (needRouting(dr_box)) {
-        buildBoxTrackAxis(dr_box);
-        buildLayerNodeMap(dr_box);
-        buildDRNodeValid(dr_box);
-        buildDRNodeNeighbor(dr_box);
-        buildOrientNetMap(dr_box);
+        if (!loadBoxCache(dr_box)) {
+          buildBoxTrackAxis(dr_box);
+          buildLayerNodeMap(dr_box);
+          buildDRNodeValid(dr_box);
+          buildDRNodeNeighbor(dr_box);
+          buildFixedOrientNetMap(dr_box);
+        }
+        buildRoutedOrientNetMap(dr_box);
+        buildShapeIndex(dr_box);
         // debugCheckDRBox(dr_box);
         // debugPlotDRBox(dr_box, -1, "before_routing");
         routeDRBox(dr_box);
         // debugPlotDRBox(dr_box, -1, "after_routing");
         uploadViolation(dr_box);
+        saveBoxCache(dr_model, dr_box);
       }
       freeDRBox(dr_box);
     }
@@ -261,6 +305,15 @@ void DetailedRouter::routeDRBoxMap(DRModel& dr_model)
   RTLOG.info(Loc::current(), "Completed", monitor.getStatsInfo());
 }
 
+bool DetailedRouter::needBuilding(DRBox& dr_box)
+{
+  // 非完全拆线时，区域内没有violation的box不需要构建
+  if (dr_box.get_dr_parameter()->get_complete_rip_up() == false && RTDM.getViolationSet(dr_box.get_box_rect()).empty()) {
+    return false;
+  }
+  return true;
+}
+
 void DetailedRouter::buildFixedRectList(DRBox& dr_box)
 {
   dr_box.set_type_layer_net_fixed_rect_map(RTDM.getTypeLayerNetFixedRectMap(dr_box.get_box_rect()));
@@ -381,6 +434,43 @@ bool DetailedRouter::needRouting(DRBox& dr_box)
   return true;
 }
 
+int32_t DetailedRouter::getMaxBoxCacheNum()
+{
+  // 每个线程同时只持有一个box的graph，缓存占用不超过其16倍
+  return std::max(1, RTDM.getConfig().thread_number) * 16;
+}
+
+bool DetailedRouter::loadBoxCache(DRBox& dr_box)
+{
+  DRBoxCache& dr_box_cache = dr_box.get_dr_box_cache();
+  if (dr_box_cache.empty()) {
+    return false;
+  }
+  bool is_hit = (dr_box_cache.get_max_neighbor_range() == dr_box.get_dr_parameter()->get_max_neighbor_range()
+                 && dr_box_cache.get_key_coord_list() == getKeyCoordList(dr_box));
+  if (is_hit) {
+    dr_box.set_box_track_axis(dr_box_cache.get_box_track_axis());
+    dr_box.get_layer_node_map() = std::move(dr_box_cache.get_layer_node_map());
+  }
+  dr_box.set_dr_box_cache(DRBoxCache());
+  return is_hit;
+}
+
+std::vector<LayerCoord> DetailedRouter::getKeyCoordList(DRBox& dr_box)
+{
+  std::vector<LayerCoord> key_coord_list;
+  for (DRTask* dr_task : dr_box.get_dr_task_list()) {
+    for (DRGroup& dr_group : dr_task->get_dr_group_list()) {
+      for (auto& [coord, direction_set] : dr_group.get_coord_direction_map()) {
+        key_coord_list.push_back(coord);
+      }
+    }
+  }
+  std::sort(key_coord_list.begin(), key_coord_list.end(), CmpLayerCoordByXASC());
+  key_coord_list.erase(std::unique(key_coord_list.begin(), key_coord_list.end()), key_coord_list.end());
+  return key_coord_list;
+}
+
 void DetailedRouter::buildBoxTrackAxis(DRBox& dr_box)
 {
   std::vector<RoutingLayer>& routing_layer_list = RTDM.getDatabase().get_routing_layer_list();
@@ -626,7 +716,7 @@ void DetailedRouter::buildDRNodeNeighbor(DRBox& dr_box)
   }
 }
 
-void DetailedRouter::buildOrientNetMap(DRBox& dr_box)
+void DetailedRouter::buildFixedOrientNetMap(DRBox& dr_box)
 {
   for (auto& [is_routing, layer_net_fixed_rect_map] : dr_box.get_type_layer_net_fixed_rect_map()) {
     for (auto& [layer_idx, net_fixed_rect_map] : layer_net_fixed_rect_map) {
@@ -637,6 +727,10 @@ void DetailedRouter::buildOrientNetMap(DRBox& dr_box)
       }
     }
   }
+}
+
+void DetailedRouter::buildRoutedOrientNetMap(DRBox& dr_box)
+{
   for (auto& [net_idx, segment_list] : dr_box.get_net_result_map()) {
     for (Segment<LayerCoord>& segment : segment_list) {
       updateNetResultToGraph(dr_box, ChangeType::kAdd, net_idx, segment);
@@ -802,7 +896,7 @@ bool DetailedRouter::searchEnded(DRBox& dr_box)
 
 void DetailedRouter::expandSearching(DRBox& dr_box)
 {
-  PriorityQueue<DRNode*, std::vector<DRNode*>, CmpDRNodeCost>& open_queue = dr_box.get_open_queue();
+  PriorityQueue<DRNode*>& open_queue = dr_box.get_open_queue();
   DRNode* path_head_node = dr_box.get_path_head_node();
 
   for (auto& [orientation, neighbor_node] : path_head_node->get_neighbor_node_map()) {
@@ -816,8 +910,9 @@ void DetailedRouter::expandSearching(DRBox& dr_box)
     if (neighbor_node->isOpen() && know_cost < neighbor_node->get_known_cost()) {
       neighbor_node->set_known_cost(know_cost);
       neighbor_node->set_parent_node(path_head_node);
-      // 对优先队列中的值修改了，需要重新建堆
-      std::make_heap(open_queue.begin(), open_queue.end(), CmpDRNodeCost());
+      // 代价降低后重新入队，旧的入队记录在出队时跳过
+      open_queue.push(neighbor_node, neighbor_node->getTotalCost(), neighbor_node->get_estimated_cost(),
+                      neighbor_node->get_neighbor_node_map().size());
     } else if (neighbor_node->isNone()) {
       neighbor_node->set_known_cost(know_cost);
       neighbor_node->set_parent_node(path_head_node);
@@ -839,8 +934,7 @@ bool DetailedRouter::isRoutingFailed(DRBox& dr_box)
 
 void DetailedRouter::resetSinglePath(DRBox& dr_box)
 {
-  PriorityQueue<DRNode*, std::vector<DRNode*>, CmpDRNodeCost> empty_queue;
-  dr_box.set_open_queue(empty_queue);
+  dr_box.get_open_queue().clear();
 
   std::vector<DRNode*>& single_path_visited_node_list = dr_box.get_single_path_visited_node_list();
   for (DRNode* visited_node : single_path_visited_node_list) {
@@ -950,6 +1044,7 @@ void DetailedRouter::updateTaskResult(DRBox& dr_box)
   for (Segment<LayerCoord>& routing_segment : routing_segment_list) {
     updateNetResultToGraph(dr_box, ChangeType::kAdd, curr_net_idx, routing_segment);
   }
+  updateNetResultToShapeIndex(dr_box, curr_net_idx);
 }
 
 std::vector<Segment<LayerCoord>> DetailedRouter::getRoutingSegmentList(DRBox& dr_box)
@@ -994,11 +1089,11 @@ void DetailedRouter::resetSingleTask(DRBox& dr_box)
 
 void DetailedRouter::pushToOpenList(DRBox& dr_box, DRNode* curr_node)
 {
-  PriorityQueue<DRNode*, std::vector<DRNode*>, CmpDRNodeCost>& open_queue = dr_box.get_open_queue();
+  PriorityQueue<DRNode*>& open_queue = dr_box.get_open_queue();
   std::vector<DRNode*>& single_task_visited_node_list = dr_box.get_single_task_visited_node_list();
   std::vector<DRNode*>& single_path_visited_node_list = dr_box.get_single_path_visited_node_list();
 
-  open_queue.push(curr_node);
+  open_queue.push(curr_node, curr_node->getTotalCost(), curr_node->get_estimated_cost(), curr_node->get_neighbor_node_map().size());
   curr_node->set_state(DRNodeState::kOpen);
   single_task_visited_node_list.push_back(curr_node);
   single_path_visited_node_list.push_back(curr_node);
@@ -1006,13 +1101,19 @@ void DetailedRouter::pushToOpenList(DRBox& dr_box, DRNode* curr_node)
 
 DRNode* DetailedRouter::popFromOpenList(DRBox& dr_box)
 {
-  PriorityQueue<DRNode*, std::vector<DRNode*>, CmpDRNodeCost>& open_queue = dr_box.get_open_queue();
+  PriorityQueue<DRNode*>& open_queue = dr_box.get_open_queue();
 
   DRNode* node = nullptr;
-  if (!open_queue.empty()) {
+  while (!open_queue.empty()) {
     node = open_queue.top();
     open_queue.pop();
+    if (node->isClose()) {
+      // 代价降低时重复入队的旧记录
+      node = nullptr;
+      continue;
+    }
     node->set_state(DRNodeState::kClose);
+    break;
   }
   return node;
 }
@@ -1142,11 +1243,26 @@ double DetailedRouter::getEstimateCost(DRBox& dr_box, DRNode* start_node, DRNode
 
 double DetailedRouter::getEstimateWireCost(DRBox& dr_box, DRNode* start_node, DRNode* end_node)
 {
+  std::vector<RoutingLayer>& routing_layer_list = RTDM.getDatabase().get_routing_layer_list();
   double prefer_wire_unit = dr_box.get_dr_parameter()->get_prefer_wire_unit();
+  double non_prefer_wire_unit = dr_box.get_dr_parameter()->get_non_prefer_wire_unit();
+  double via_unit = dr_box.get_dr_parameter()->get_via_unit();
 
   double wire_cost = 0;
   wire_cost += RTUTIL.getManhattanDistance(start_node->get_planar_coord(), end_node->get_planar_coord());
   wire_cost *= prefer_wire_unit;
+  // 同层时，非prefer方向上的距离要么走非prefer线，要么至少经过两个通孔换层
+  if (start_node->get_layer_idx() == end_node->get_layer_idx()) {
+    int32_t non_prefer_span = 0;
+    if (routing_layer_list[start_node->get_layer_idx()].isPreferH()) {
+      non_prefer_span = std::abs(start_node->get_y() - end_node->get_y());
+    } else {
+      non_prefer_span = std::abs(start_node->get_x() - end_node->get_x());
+    }
+    if (non_prefer_span > 0) {
+      wire_cost += std::max(0.0, std::min((non_prefer_wire_unit - prefer_wire_unit) * non_prefer_span, 2 * via_unit));
+    }
+  }
   return wire_cost;
 }
 
@@ -1188,49 +1304,56 @@ void DetailedRouter::updateViolationList(DRBox& dr_box)
 
 std::vector<Violation> DetailedRouter::getViolationList(DRBox& dr_box)
 {
-  std::vector<idb::IdbLayerShape*> env_shape_list;
-  std::map<int32_t, std::vector<idb::IdbLayerShape*>> net_pin_shape_map;
-  for (auto& [is_routing, layer_net_fixed_rect_map] : dr_box.get_type_layer_net_fixed_rect_map()) {
-    for (auto& [layer_idx, net_fixed_rect_map] : layer_net_fixed_rect_map) {
-      for (auto& [net_idx, fixed_rect_set] : net_fixed_rect_map) {
-        if (net_idx == -1) {
-          for (auto& fixed_rect : fixed_rect_set) {
-            env_shape_list.push_back(RTDM.getIDBLayerShapeByFixedRect(fixed_rect, is_routing));
-          }
-        } else {
-          for (auto& fixed_rect : fixed_rect_set) {
-            net_pin_shape_map[net_idx].push_back(RTDM.getIDBLayerShapeByFixedRect(fixed_rect, is_routing));
-          }
-        }
-      }
-    }
-  }
-  std::map<int32_t, std::vector<idb::IdbRegularWireSegment*>> net_wire_via_map;
-  for (auto& [net_idx, segment_list] : dr_box.get_net_result_map()) {
-    for (Segment<LayerCoord>& segment : segment_list) {
-      net_wire_via_map[net_idx].push_back(RTDM.getIDBSegmentByNetResult(net_idx, segment));
+  std::vector<RoutingLayer>& routing_layer_list = RTDM.getDatabase().get_routing_layer_list();
+  std::vector<CutLayer>& cut_layer_list = RTDM.getDatabase().get_cut_layer_list();
+
+  DRShapeIndex& dr_shape_index = dr_box.get_dr_shape_index();
+  std::vector<NetShape>& shape_list = dr_shape_index.get_shape_list();
+  std::map<std::pair<int32_t, int32_t>, Violation>& shape_pair_violation_map = dr_shape_index.get_shape_pair_violation_map();
+  std::map<int32_t, std::set<int32_t>>& shape_neighbor_map = dr_shape_index.get_shape_neighbor_map();
+
+  // 只检查上次检查后变化的shape，其余shape之间的违例沿用缓存结果
+  for (int32_t shape_id : dr_shape_index.get_dirty_shape_set()) {
+    NetShape& net_shape = shape_list[shape_id];
+    // 由于pin_shape之间的drc违例存在，第一布线层的drc违例先过滤
+    if (net_shape.get_is_routing() && net_shape.get_layer_idx() == 0) {
+      continue;
     }
-  }
-  std::vector<Violation> violation_list = RTI.getViolationList(env_shape_list, net_pin_shape_map, net_wire_via_map, "DR");
-  // free memory
-  {
-    for (idb::IdbLayerShape* env_shape : env_shape_list) {
-      delete env_shape;
-      env_shape = nullptr;
-    }
-    for (auto& [net_idx, pin_shape_list] : net_pin_shape_map) {
-      for (idb::IdbLayerShape* pin_shape : pin_shape_list) {
-        delete pin_shape;
-        pin_shape = nullptr;
+    int32_t query_spacing = 0;
+    if (net_shape.get_is_routing()) {
+      query_spacing = routing_layer_list[net_shape.get_layer_idx()].get_spacing_table().get_width_parallel_length_map().back().front();
+    } else {
+      query_spacing = cut_layer_list[net_shape.get_layer_idx()].get_spacing();
+    }
+    std::vector<std::pair<BGRectInt, int32_t>> query_result;
+    dr_shape_index.get_type_layer_shape_rtree_map()[net_shape.get_is_routing()][net_shape.get_layer_idx()].query(
+        bgi::intersects(RTUTIL.convertToBGRectInt(RTUTIL.getEnlargedRect(net_shape.get_rect(), query_spacing))),
+        std::back_inserter(query_result));
+    for (auto& [bg_rect, neighbor_id] : query_result) {
+      NetShape& neighbor_shape = shape_list[neighbor_id];
+      // self的drc违例先过滤
+      if (neighbor_shape.get_net_idx() == net_shape.get_net_idx()) {
+        continue;
       }
-    }
-    for (auto& [net_idx, wire_via_list] : net_wire_via_map) {
-      for (idb::IdbRegularWireSegment* wire_via : wire_via_list) {
-        delete wire_via;
-        wire_via = nullptr;
+      std::pair<int32_t, int32_t> shape_pair = std::minmax(shape_id, neighbor_id);
+      if (RTUTIL.exist(shape_pair_violation_map, shape_pair)) {
+        continue;
+      }
+      Violation violation;
+      if (getShapeViolation(net_shape, neighbor_shape, violation)) {
+        shape_pair_violation_map[shape_pair] = violation;
+        shape_neighbor_map[shape_id].insert(neighbor_id);
+        shape_neighbor_map[neighbor_id].insert(shape_id);
       }
     }
   }
+  dr_shape_index.get_dirty_shape_set().clear();
+
+  std::vector<Violation> violation_list;
+  violation_list.reserve(shape_pair_violation_map.size());
+  for (auto& [shape_pair, violation] : shape_pair_violation_map) {
+    violation_list.push_back(violation);
+  }
   return violation_list;
 }
 
@@ -1241,6 +1364,38 @@ void DetailedRouter::uploadViolation(DRBox& dr_box)
   }
 }
 
+void DetailedRouter::saveBoxCache(DRModel& dr_model, DRBox& dr_box)
+{
+  // 只有仍有violation的box会在后续迭代中重新布线
+  if (dr_box.get_violation_list().empty()) {
+    return;
+  }
+  int32_t box_cache_num;
+#pragma omp atomic capture
+  box_cache_num = ++dr_model.get_box_cache_num();
+  if (box_cache_num > getMaxBoxCacheNum()) {
+    return;
+  }
+  std::vector<GridMap<DRNode>>& layer_node_map = dr_box.get_layer_node_map();
+  // 去掉net_result与violation的代价，保留fixed_rect的代价
+  for (GridMap<DRNode>& dr_node_map : layer_node_map) {
+    for (int32_t x = 0; x < dr_node_map.get_x_size(); x++) {
+      for (int32_t y = 0; y < dr_node_map.get_y_size(); y++) {
+        DRNode& dr_node = dr_node_map[x][y];
+        dr_node.set_orient_routed_rect_map(OrientNetSet());
+        dr_node.set_orient_violation_number_map(OrientArray<int32_t>());
+      }
+    }
+  }
+  DRBoxCache dr_box_cache;
+  dr_box_cache.set_iter(dr_model.get_iter());
+  dr_box_cache.set_max_neighbor_range(dr_box.get_dr_parameter()->get_max_neighbor_range());
+  dr_box_cache.set_key_coord_list(getKeyCoordList(dr_box));
+  dr_box_cache.set_box_track_axis(dr_box.get_box_track_axis());
+  dr_box_cache.get_layer_node_map() = std::move(layer_node_map);
+  dr_box.set_dr_box_cache(std::move(dr_box_cache));
+}
+
 void DetailedRouter::freeDRBox(DRBox& dr_box)
 {
   for (DRTask* dr_task : dr_box.get_dr_task_list()) {
@@ -1249,6 +1404,7 @@ void DetailedRouter::freeDRBox(DRBox& dr_box)
   }
   dr_box.get_dr_task_list().clear();
   dr_box.get_layer_node_map().clear();
+  dr_box.set_dr_shape_index(DRShapeIndex());
 }
 
 int32_t DetailedRouter::getViolationNum()
@@ -1323,9 +1479,9 @@ void DetailedRouter::updateFixedRectToGraph(DRBox& dr_box, ChangeType change_typ
     }
     for (Orientation orientation : orientation_set) {
       if (change_type == ChangeType::kAdd) {
-        dr_node->get_orient_fixed_rect_map()[orientation].insert(net_shape.get_net_idx());
+        dr_node->get_orient_fixed_rect_map().insert(orientation, net_shape.get_net_idx());
       } else if (change_type == ChangeType::kDel) {
-        dr_node->get_orient_fixed_rect_map()[orientation].erase(net_shape.get_net_idx());
+        dr_node->get_orient_fixed_rect_map().erase(orientation, net_shape.get_net_idx());
       }
     }
   }
@@ -1340,9 +1496,9 @@ void DetailedRouter::updateNetResultToGraph(DRBox& dr_box, ChangeType change_typ
       }
       for (Orientation orientation : orientation_set) {
         if (change_type == ChangeType::kAdd) {
-          dr_node->get_orient_routed_rect_map()[orientation].insert(net_shape.get_net_idx());
+          dr_node->get_orient_routed_rect_map().insert(orientation, net_shape.get_net_idx());
         } else if (change_type == ChangeType::kDel) {
-          dr_node->get_orient_routed_rect_map()[orientation].erase(net_shape.get_net_idx());
+          dr_node->get_orient_routed_rect_map().erase(orientation, net_shape.get_net_idx());
         }
       }
     }
@@ -1407,7 +1563,7 @@ std::map<DRNode*, std::set<Orientation>> DetailedRouter::getRoutingNodeOrientati
         if (orientation == Orientation::kAbove || orientation == Orientation::kBelow) {
           continue;
         }
-        if (!RTUTIL.exist(node.get_neighbor_node_map(), orientation)) {
+        if (node.getNeighborNode(orientation) == nullptr) {
           continue;
         }
         node_orientation_map[&node].insert(orientation);
@@ -1432,7 +1588,7 @@ std::map<DRNode*, std::set<Orientation>> DetailedRouter::getRoutingNodeOrientati
             || orientation == Orientation::kNorth) {
           continue;
         }
-        if (!RTUTIL.exist(node.get_neighbor_node_map(), orientation)) {
+        if (node.getNeighborNode(orientation) == nullptr) {
           continue;
         }
         node_orientation_map[&node].insert(orientation);
@@ -1488,6 +1644,112 @@ std::map<DRNode*, std::set<Orientation>> DetailedRouter::getCutNodeOrientationMa
 
 #endif
 
+#if 1  // drc
+
+void DetailedRouter::buildShapeIndex(DRBox& dr_box)
+{
+  for (auto& [is_routing, layer_net_fixed_rect_map] : dr_box.get_type_layer_net_fixed_rect_map()) {
+    for (auto& [layer_idx, net_fixed_rect_map] : layer_net_fixed_rect_map) {
+      for (auto& [net_idx, fixed_rect_set] : net_fixed_rect_map) {
+        for (EXTLayerRect* fixed_rect : fixed_rect_set) {
+          NetShape net_shape(net_idx, fixed_rect->getRealLayerRect(), is_routing);
+          addShapeToIndex(dr_box, net_shape);
+        }
+      }
+    }
+  }
+  for (auto& [net_idx, segment_list] : dr_box.get_net_result_map()) {
+    updateNetResultToShapeIndex(dr_box, net_idx);
+  }
+}
+
+int32_t DetailedRouter::addShapeToIndex(DRBox& dr_box, NetShape& net_shape)
+{
+  DRShapeIndex& dr_shape_index = dr_box.get_dr_shape_index();
+  std::vector<NetShape>& shape_list = dr_shape_index.get_shape_list();
+
+  int32_t shape_id = static_cast<int32_t>(shape_list.size());
+  shape_list.push_back(net_shape);
+  dr_shape_index.get_type_layer_shape_rtree_map()[net_shape.get_is_routing()][net_shape.get_layer_idx()].insert(
+      std::make_pair(RTUTIL.convertToBGRectInt(net_shape.get_rect()), shape_id));
+  dr_shape_index.get_dirty_shape_set().insert(shape_id);
+  return shape_id;
+}
+
+void DetailedRouter::deleteShapeFromIndex(DRBox& dr_box, int32_t shape_id)
+{
+  DRShapeIndex& dr_shape_index = dr_box.get_dr_shape_index();
+  std::map<std::pair<int32_t, int32_t>, Violation>& shape_pair_violation_map = dr_shape_index.get_shape_pair_violation_map();
+  std::map<int32_t, std::set<int32_t>>& shape_neighbor_map = dr_shape_index.get_shape_neighbor_map();
+
+  NetShape& net_shape = dr_shape_index.get_shape_list()[shape_id];
+  dr_shape_index.get_type_layer_shape_rtree_map()[net_shape.get_is_routing()][net_shape.get_layer_idx()].remove(
+      std::make_pair(RTUTIL.convertToBGRectInt(net_shape.get_rect()), shape_id));
+  dr_shape_index.get_dirty_shape_set().erase(shape_id);
+  // 删除与该shape相关的违例
+  if (RTUTIL.exist(shape_neighbor_map, shape_id)) {
+    for (int32_t neighbor_id : shape_neighbor_map[shape_id]) {
+      shape_pair_violation_map.erase(std::minmax(shape_id, neighbor_id));
+      shape_neighbor_map[neighbor_id].erase(shape_id);
+    }
+    shape_neighbor_map.erase(shape_id);
+  }
+}
+
+void DetailedRouter::updateNetResultToShapeIndex(DRBox& dr_box, int32_t net_idx)
+{
+  std::vector<int32_t>& shape_id_list = dr_box.get_dr_shape_index().get_net_result_shape_map()[net_idx];
+  for (int32_t shape_id : shape_id_list) {
+    deleteShapeFromIndex(dr_box, shape_id);
+  }
+  shape_id_list.clear();
+  for (NetShape& net_shape : RTDM.getNetShapeList(net_idx, dr_box.get_net_result_map()[net_idx])) {
+    shape_id_list.push_back(addShapeToIndex(dr_box, net_shape));
+  }
+}
+
+bool DetailedRouter::getShapeViolation(NetShape& a_shape, NetShape& b_shape, Violation& violation)
+{
+  ScaleAxis& gcell_axis = RTDM.getDatabase().get_gcell_axis();
+  std::vector<RoutingLayer>& routing_layer_list = RTDM.getDatabase().get_routing_layer_list();
+  std::vector<CutLayer>& cut_layer_list = RTDM.getDatabase().get_cut_layer_list();
+
+  PlanarRect& a_rect = a_shape.get_rect();
+  PlanarRect& b_rect = b_shape.get_rect();
+  int32_t max_ll_x = std::max(a_rect.get_ll_x(), b_rect.get_ll_x());
+  int32_t min_ur_x = std::min(a_rect.get_ur_x(), b_rect.get_ur_x());
+  int32_t max_ll_y = std::max(a_rect.get_ll_y(), b_rect.get_ll_y());
+  int32_t min_ur_y = std::min(a_rect.get_ur_y(), b_rect.get_ur_y());
+  int64_t x_spacing = std::max(0, max_ll_x - min_ur_x);
+  int64_t y_spacing = std::max(0, max_ll_y - min_ur_y);
+  if (x_spacing > 0 || y_spacing > 0) {
+    // 不相交时检查default spacing
+    int64_t min_spacing = 0;
+    if (a_shape.get_is_routing()) {
+      RoutingLayer& routing_layer = routing_layer_list[a_shape.get_layer_idx()];
+      min_spacing = std::max(routing_layer.getMinSpacing(a_rect), routing_layer.getMinSpacing(b_rect));
+    } else {
+      min_spacing = cut_layer_list[a_shape.get_layer_idx()].get_spacing();
+    }
+    if (x_spacing * x_spacing + y_spacing * y_spacing >= min_spacing * min_spacing) {
+      return false;
+    }
+  }
+  // 相交或贴合为short，否则为两个shape之间的区域
+  EXTLayerRect violation_shape;
+  violation_shape.set_real_ll(std::min(max_ll_x, min_ur_x), std::min(max_ll_y, min_ur_y));
+  violation_shape.set_real_ur(std::max(max_ll_x, min_ur_x), std::max(max_ll_y, min_ur_y));
+  violation_shape.set_grid_rect(RTUTIL.getClosedGCellGridRect(violation_shape.get_real_rect(), gcell_axis));
+  violation_shape.set_layer_idx(a_shape.get_layer_idx());
+
+  violation.set_violation_shape(violation_shape);
+  violation.set_is_routing(a_shape.get_is_routing());
+  violation.set_violation_net_set({a_shape.get_net_idx(), b_shape.get_net_idx()});
+  return true;
+}
+
+#endif
+
 #if 1  // exhibit
 
 void DetailedRouter::updateSummary(DRModel& dr_model)
@@ -1626,14 +1888,12 @@ void DetailedRouter::writeNetCSV(DRModel& dr_model)
   for (int32_t x = 0; x < gcell_map.get_x_size(); x++) {
     for (int32_t y = 0; y < gcell_map.get_y_size(); y++) {
       std::map<int32_t, std::set<int32_t>> net_layer_map;
-      for (auto& [net_idx, segment_set] : gcell_map[x][y].get_detailed_net_result_map()) {
-        for (Segment<LayerCoord>* segment : segment_set) {
-          int32_t first_layer_idx = segment->get_first().get_layer_idx();
-          int32_t second_layer_idx = segment->get_second().get_layer_idx();
-          RTUTIL.swapByASC(first_layer_idx, second_layer_idx);
-          for (int32_t layer_idx = first_layer_idx; layer_idx <= second_layer_idx; layer_idx++) {
-            net_layer_map[net_idx].insert(layer_idx);
-          }
+      for (auto& net_segment : gcell_map[x][y].get_detailed_net_result_set()) {
+        int32_t first_layer_idx = net_segment.item->get_first().get_layer_idx();
+        int32_t second_layer_idx = net_segment.item->get_second().get_layer_idx();
+        RTUTIL.swapByASC(first_layer_idx, second_layer_idx);
+        for (int32_t layer_idx = first_layer_idx; layer_idx <= second_layer_idx; layer_idx++) {
+          net_layer_map[net_segment.net_idx].insert(layer_idx);
         }
       }
       for (auto& [net_idx, layer_set] : net_layer_map) {
@@ -1714,8 +1974,11 @@ void DetailedRouter::debugCheckDRBox(DRBox& dr_box)
           RTLOG.error(Loc::current(), "The dr_node is out of box!");
         }
         for (auto& [orient, neighbor] : dr_node.get_neighbor_node_map()) {
+          if (neighbor == nullptr) {
+            continue;
+          }
           Orientation opposite_orient = RTUTIL.getOppositeOrientation(orient);
-          if (!RTUTIL.exist(neighbor->get_neighbor_node_map(), opposite_orient)) {
+          if (neighbor->getNeighborNode(opposite_orient) == nullptr) {
             RTLOG.error(Loc::current(), "The dr_node neighbor is not bidirectional!");
           }
           if (neighbor->get_neighbor_node_map()[opposite_orient] != &dr_node) {
@@ -1874,7 +2137,7 @@ void DetailedRouter::debugPlotDRBox(DRBox& dr_box, int32_t curr_task_idx, std::s
           gp_text_orient_fixed_rect_map_info.set_coord(real_rect.get_ll_x(), y);
           gp_text_orient_fixed_rect_map_info.set_text_type(static_cast<int32_t>(GPDataType::kInfo));
           std::string orient_fixed_rect_map_info_message = "--";
-          for (auto& [orient, net_set] : dr_node.get_orient_fixed_rect_map()) {
+          for (auto& [orient, net_set] : dr_node.get_orient_fixed_rect_map().getOrientNetMap()) {
             orient_fixed_rect_map_info_message += RTUTIL.getString("(", GetOrientationName()(orient));
             for (int32_t net_idx : net_set) {
               orient_fixed_rect_map_info_message += RTUTIL.getString(",", net_idx);
@@ -1902,7 +2165,7 @@ void DetailedRouter::debugPlotDRBox(DRBox& dr_box, int32_t curr_task_idx, std::s
           gp_text_orient_routed_rect_map_info.set_coord(real_rect.get_ll_x(), y);
           gp_text_orient_routed_rect_map_info.set_text_type(static_cast<int32_t>(GPDataType::kInfo));
           std::string orient_routed_rect_map_info_message = "--";
-          for (auto& [orient, net_set] : dr_node.get_orient_routed_rect_map()) {
+          for (auto& [orient, net_set] : dr_node.get_orient_routed_rect_map().getOrientNetMap()) {
             orient_routed_rect_map_info_message += RTUTIL.getString("(", GetOrientationName()(orient));
             for (int32_t net_idx : net_set) {
               orient_routed_rect_map_info_message += RTUTIL.getString(",", net_idx);
@@ -1931,6 +2194,9 @@ void DetailedRouter::debugPlotDRBox(DRBox& dr_box, int32_t curr_task_idx, std::s
           gp_text_orient_violation_number_map_info.set_text_type(static_cast<int32_t>(GPDataType::kInfo));
           std::string orient_violation_number_map_info_message = "--";
           for (auto& [orient, violation_number] : dr_node.get_orient_violation_number_map()) {
+            if (violation_number == 0) {
+              continue;
+            }
             orient_violation_number_map_info_message
                 += RTUTIL.getString("(", GetOrientationName()(orient), ",", violation_number != 0, ")");
           }
@@ -1987,6 +2253,9 @@ void DetailedRouter::debugPlotDRBox(DRBox& dr_box, int32_t curr_task_idx, std::s
         int32_t width = std::min(x_reduced_span, y_reduced_span) / 2;
 
         for (auto& [orientation, neighbor_node] : dr_node.get_neighbor_node_map()) {
+          if (neighbor_node == nullptr) {
+            continue;
+          }
           GPPath gp_path;
           switch (orientation) {
             case Orientation::kEast:
@@ -60,16 +60,21 @@ class DetailedRouter
   void initDRBoxMap(DRModel& dr_model);
   void buildBoxSchedule(DRModel& dr_model);
   void routeDRBoxMap(DRModel& dr_model);
+  bool needBuilding(DRBox& dr_box);
   void buildFixedRectList(DRBox& dr_box);
   void buildNetResultMap(DRBox& dr_box);
   void buildViolationList(DRBox& dr_box);
   void initDRTaskList(DRModel& dr_model, DRBox& dr_box);
   bool needRouting(DRBox& dr_box);
+  int32_t getMaxBoxCacheNum();
+  bool loadBoxCache(DRBox& dr_box);
+  std::vector<LayerCoord> getKeyCoordList(DRBox& dr_box);
   void buildBoxTrackAxis(DRBox& dr_box);
   void buildLayerNodeMap(DRBox& dr_box);
   void buildDRNodeValid(DRBox& dr_box);
   void buildDRNodeNeighbor(DRBox& dr_box);
-  void buildOrientNetMap(DRBox& dr_box);
+  void buildFixedOrientNetMap(DRBox& dr_box);
+  void buildRoutedOrientNetMap(DRBox& dr_box);
   void routeDRBox(DRBox& dr_box);
   std::vector<DRTask*> initTaskSchedule(DRBox& dr_box);
   std::vector<DRTask*> getTaskScheduleByViolation(DRBox& dr_box);
@@ -105,6 +110,7 @@ class DetailedRouter
   void updateViolationList(DRBox& dr_box);
   std::vector<Violation> getViolationList(DRBox& dr_box);
   void uploadViolation(DRBox& dr_box);
+  void saveBoxCache(DRModel& dr_model, DRBox& dr_box);
   void freeDRBox(DRBox& dr_box);
   int32_t getViolationNum();
   void uploadNetResult(DRModel& dr_model);
@@ -119,6 +125,14 @@ class DetailedRouter
   void updateViolationToGraph(DRBox& dr_box, ChangeType change_type, Violation& violation);
 #endif
 
+#if 1  // drc
+  void buildShapeIndex(DRBox& dr_box);
+  int32_t addShapeToIndex(DRBox& dr_box, NetShape& net_shape);
+  void deleteShapeFromIndex(DRBox& dr_box, int32_t shape_id);
+  void updateNetResultToShapeIndex(DRBox& dr_box, int32_t net_idx);
+  bool getShapeViolation(NetShape& a_shape, NetShape& b_shape, Violation& violation);
+#endif
+
 #if 1  // exhibit
   void updateSummary(DRModel& dr_model);
   void printSummary(DRModel& dr_model);
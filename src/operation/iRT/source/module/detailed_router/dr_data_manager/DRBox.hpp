@@ -16,9 +16,11 @@
 // ***************************************************************************************
 #pragma once
 
+#include "DRBoxCache.hpp"
 #include "DRBoxId.hpp"
 #include "DRNode.hpp"
 #include "DRParameter.hpp"
+#include "DRShapeIndex.hpp"
 #include "DRTask.hpp"
 #include "LayerCoord.hpp"
 #include "LayerRect.hpp"
@@ -46,6 +48,8 @@ class DRBox
   std::vector<Violation>& get_violation_list() { return _violation_list; }
   ScaleAxis& get_box_track_axis() { return _box_track_axis; }
   std::vector<GridMap<DRNode>>& get_layer_node_map() { return _layer_node_map; }
+  DRShapeIndex& get_dr_shape_index() { return _dr_shape_index; }
+  DRBoxCache& get_dr_box_cache() { return _dr_box_cache; }
   // setter
   void set_box_rect(const EXTPlanarRect& box_rect) { _box_rect = box_rect; }
   void set_dr_box_id(const DRBoxId& dr_box_id) { _dr_box_id = dr_box_id; }
@@ -60,6 +64,8 @@ class DRBox
   void set_violation_list(const std::vector<Violation>& violation_list) { _violation_list = violation_list; }
   void set_box_track_axis(const ScaleAxis& box_track_axis) { _box_track_axis = box_track_axis; }
   void set_layer_node_map(const std::vector<GridMap<DRNode>>& layer_node_map) { _layer_node_map = layer_node_map; }
+  void set_dr_shape_index(const DRShapeIndex& dr_shape_index) { _dr_shape_index = dr_shape_index; }
+  void set_dr_box_cache(DRBoxCache&& dr_box_cache) { _dr_box_cache = std::move(dr_box_cache); }
   // function
 #if 1  // astar
   // single task
@@ -85,11 +91,11 @@ class DRBox
     _routing_segment_list = routing_segment_list;
   }
   // single path
-  PriorityQueue<DRNode*, std::vector<DRNode*>, CmpDRNodeCost>& get_open_queue() { return _open_queue; }
+  PriorityQueue<DRNode*>& get_open_queue() { return _open_queue; }
   std::vector<DRNode*>& get_single_path_visited_node_list() { return _single_path_visited_node_list; }
   DRNode* get_path_head_node() { return _path_head_node; }
   int32_t get_end_node_list_idx() const { return _end_node_list_idx; }
-  void set_open_queue(const PriorityQueue<DRNode*, std::vector<DRNode*>, CmpDRNodeCost>& open_queue) { _open_queue = open_queue; }
+  void set_open_queue(const PriorityQueue<DRNode*>& open_queue) { _open_queue = open_queue; }
   void set_single_path_visited_node_list(const std::vector<DRNode*>& single_path_visited_node_list)
   {
     _single_path_visited_node_list = single_path_visited_node_list;
@@ -108,6 +114,8 @@ class DRBox
   std::vector<Violation> _violation_list;
   ScaleAxis _box_track_axis;
   std::vector<GridMap<DRNode>> _layer_node_map;
+  DRShapeIndex _dr_shape_index;
+  DRBoxCache _dr_box_cache;
 #if 1  // astar
   // single task
   DRTask* _curr_dr_task = nullptr;
@@ -117,7 +125,7 @@ class DRBox
   std::vector<DRNode*> _single_task_visited_node_list;
   std::vector<Segment<LayerCoord>> _routing_segment_list;
   // single path
-  PriorityQueue<DRNode*, std::vector<DRNode*>, CmpDRNodeCost> _open_queue;
+  PriorityQueue<DRNode*> _open_queue;
   std::vector<DRNode*> _single_path_visited_node_list;
   DRNode* _path_head_node = nullptr;
   int32_t _end_node_list_idx = -1;
@@ -0,0 +1,62 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#pragma once
+
+#include "DRNode.hpp"
+#include "GridMap.hpp"
+#include "LayerCoord.hpp"
+#include "ScaleAxis.hpp"
+
+namespace irt {
+
+// box的graph缓存，只保留fixed_rect的代价，net_result与violation在复用时重新加载
+class DRBoxCache
+{
+ public:
+  DRBoxCache() = default;
+  // node的neighbor指向本缓存内的GridMap，只能移动，拷贝后的neighbor仍指向原GridMap
+  DRBoxCache(const DRBoxCache& other) = delete;
+  DRBoxCache(DRBoxCache&& other) = default;
+  ~DRBoxCache() = default;
+  DRBoxCache& operator=(const DRBoxCache& other) = delete;
+  DRBoxCache& operator=(DRBoxCache&& other) = default;
+  // getter
+  int32_t get_iter() const { return _iter; }
+  int32_t get_max_neighbor_range() const { return _max_neighbor_range; }
+  std::vector<LayerCoord>& get_key_coord_list() { return _key_coord_list; }
+  ScaleAxis& get_box_track_axis() { return _box_track_axis; }
+  std::vector<GridMap<DRNode>>& get_layer_node_map() { return _layer_node_map; }
+  // setter
+  void set_iter(const int32_t iter) { _iter = iter; }
+  void set_max_neighbor_range(const int32_t max_neighbor_range) { _max_neighbor_range = max_neighbor_range; }
+  void set_key_coord_list(const std::vector<LayerCoord>& key_coord_list) { _key_coord_list = key_coord_list; }
+  void set_box_track_axis(const ScaleAxis& box_track_axis) { _box_track_axis = box_track_axis; }
+  void set_layer_node_map(const std::vector<GridMap<DRNode>>& layer_node_map) { _layer_node_map = layer_node_map; }
+  // function
+  bool empty() const { return _layer_node_map.empty(); }
+
+ private:
+  // 缓存生成时的迭代
+  int32_t _iter = -1;
+  int32_t _max_neighbor_range = -1;
+  // task的端点决定了track_axis与node的有效性，作为graph的版本
+  std::vector<LayerCoord> _key_coord_list;
+  ScaleAxis _box_track_axis;
+  std::vector<GridMap<DRNode>> _layer_node_map;
+};
+
+}  // namespace irt
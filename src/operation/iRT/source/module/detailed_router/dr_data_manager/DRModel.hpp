@@ -16,6 +16,8 @@
 // ***************************************************************************************
 #pragma once
 
+#include "DRBox.hpp"
+#include "DRBoxCache.hpp"
 #include "DRBoxId.hpp"
 #include "DRNet.hpp"
 #include "DRParameter.hpp"
@@ -27,6 +29,9 @@ class DRModel
 {
  public:
   DRModel() = default;
+  // box缓存只能移动
+  DRModel(const DRModel& other) = delete;
+  DRModel(DRModel&& other) = default;
   ~DRModel() = default;
   // getter
   std::vector<DRNet>& get_dr_net_list() { return _dr_net_list; }
@@ -34,11 +39,12 @@ class DRModel
   DRParameter& get_dr_parameter() { return _dr_parameter; }
   GridMap<DRBox>& get_dr_box_map() { return _dr_box_map; }
   std::vector<std::vector<DRBoxId>>& get_dr_box_id_list_list() { return _dr_box_id_list_list; }
+  std::map<PlanarRect, DRBoxCache, CmpPlanarRectByXASC>& get_rect_box_cache_map() { return _rect_box_cache_map; }
+  int32_t& get_box_cache_num() { return _box_cache_num; }
   // setter
   void set_dr_net_list(const std::vector<DRNet>& dr_net_list) { _dr_net_list = dr_net_list; }
   void set_iter(const int32_t iter) { _iter = iter; }
   void set_dr_parameter(const DRParameter& dr_parameter) { _dr_parameter = dr_parameter; }
-  void set_dr_box_map(const GridMap<DRBox>& dr_box_map) { _dr_box_map = dr_box_map; }
   void set_dr_box_id_list_list(const std::vector<std::vector<DRBoxId>>& dr_box_id_list_list) { _dr_box_id_list_list = dr_box_id_list_list; }
 
  private:
@@ -47,6 +53,10 @@ class DRModel
   DRParameter _dr_parameter;
   GridMap<DRBox> _dr_box_map;
   std::vector<std::vector<DRBoxId>> _dr_box_id_list_list;
+  // 以box_rect为key的graph缓存，跨迭代复用
+  std::map<PlanarRect, DRBoxCache, CmpPlanarRectByXASC> _rect_box_cache_map;
+  // 本轮存活的缓存数，不超过getMaxBoxCacheNum
+  int32_t _box_cache_num = 0;
 };
 
 }  // namespace irt
@@ -0,0 +1,72 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#pragma once
+
+#include "NetShape.hpp"
+#include "RTHeader.hpp"
+#include "Violation.hpp"
+
+namespace irt {
+
+class DRShapeIndex
+{
+ public:
+  DRShapeIndex() = default;
+  ~DRShapeIndex() = default;
+  // getter
+  std::vector<NetShape>& get_shape_list() { return _shape_list; }
+  std::map<bool, std::map<int32_t, bgi::rtree<std::pair<BGRectInt, int32_t>, bgi::quadratic<16>>>>& get_type_layer_shape_rtree_map()
+  {
+    return _type_layer_shape_rtree_map;
+  }
+  std::map<int32_t, std::vector<int32_t>>& get_net_result_shape_map() { return _net_result_shape_map; }
+  std::set<int32_t>& get_dirty_shape_set() { return _dirty_shape_set; }
+  std::map<std::pair<int32_t, int32_t>, Violation>& get_shape_pair_violation_map() { return _shape_pair_violation_map; }
+  std::map<int32_t, std::set<int32_t>>& get_shape_neighbor_map() { return _shape_neighbor_map; }
+  // setter
+  void set_shape_list(const std::vector<NetShape>& shape_list) { _shape_list = shape_list; }
+  void set_type_layer_shape_rtree_map(
+      const std::map<bool, std::map<int32_t, bgi::rtree<std::pair<BGRectInt, int32_t>, bgi::quadratic<16>>>>& type_layer_shape_rtree_map)
+  {
+    _type_layer_shape_rtree_map = type_layer_shape_rtree_map;
+  }
+  void set_net_result_shape_map(const std::map<int32_t, std::vector<int32_t>>& net_result_shape_map)
+  {
+    _net_result_shape_map = net_result_shape_map;
+  }
+  void set_dirty_shape_set(const std::set<int32_t>& dirty_shape_set) { _dirty_shape_set = dirty_shape_set; }
+  void set_shape_pair_violation_map(const std::map<std::pair<int32_t, int32_t>, Violation>& shape_pair_violation_map)
+  {
+    _shape_pair_violation_map = shape_pair_violation_map;
+  }
+  void set_shape_neighbor_map(const std::map<int32_t, std::set<int32_t>>& shape_neighbor_map) { _shape_neighbor_map = shape_neighbor_map; }
+  // function
+
+ private:
+  // 以shape在_shape_list中的下标作为id，删除后不复用
+  std::vector<NetShape> _shape_list;
+  std::map<bool, std::map<int32_t, bgi::rtree<std::pair<BGRectInt, int32_t>, bgi::quadratic<16>>>> _type_layer_shape_rtree_map;
+  // net的布线结果对应的shape
+  std::map<int32_t, std::vector<int32_t>> _net_result_shape_map;
+  // 新加入且未检查的shape
+  std::set<int32_t> _dirty_shape_set;
+  // 两个shape之间的违例，以及每个shape参与违例的另一方
+  std::map<std::pair<int32_t, int32_t>, Violation> _shape_pair_violation_map;
+  std::map<int32_t, std::set<int32_t>> _shape_neighbor_map;
+};
+
+}  // namespace irt
@@ -52,7 +52,13 @@ void GlobalRouter::route()
 {
   Monitor monitor;
   RTLOG.info(Loc::current(), "Starting...");
-
+  GRModel gr_model = initGRModel();
+  buildLayerNodeMap(gr_model);
+  buildGRNodeNeighbor(gr_model);
+  buildOrientSupply(gr_model);
+  buildNetResult(gr_model);
+  iterativeGRModel(gr_model);
+  uploadNetResult(gr_model);
   RTLOG.info(Loc::current(), "Completed", monitor.getStatsInfo());
 }
 
@@ -60,4 +66,810 @@ void GlobalRouter::route()
 
 GlobalRouter* GlobalRouter::_gr_instance = nullptr;
 
+GRModel GlobalRouter::initGRModel()
+{
+  std::vector<Net>& net_list = RTDM.getDatabase().get_net_list();
+
+  GRModel gr_model;
+  gr_model.set_gr_net_list(convertToGRNetList(net_list));
+  return gr_model;
+}
+
+std::vector<GRNet> GlobalRouter::convertToGRNetList(std::vector<Net>& net_list)
+{
+  std::vector<GRNet> gr_net_list;
+  gr_net_list.reserve(net_list.size());
+  for (size_t i = 0; i < net_list.size(); i++) {
+    gr_net_list.emplace_back(convertToGRNet(net_list[i]));
+  }
+  return gr_net_list;
+}
+
+GRNet GlobalRouter::convertToGRNet(Net& net)
+{
+  GRNet gr_net;
+  gr_net.set_origin_net(&net);
+  gr_net.set_net_idx(net.get_net_idx());
+  gr_net.set_connect_type(net.get_connect_type());
+  for (Pin& pin : net.get_pin_list()) {
+    gr_net.get_gr_pin_list().push_back(GRPin(pin));
+  }
+  gr_net.set_bounding_box(net.get_bounding_box());
+  return gr_net;
+}
+
+void GlobalRouter::buildLayerNodeMap(GRModel& gr_model)
+{
+  Monitor monitor;
+  RTLOG.info(Loc::current(), "Starting...");
+
+  GridMap<GCell>& gcell_map = RTDM.getDatabase().get_gcell_map();
+  std::vector<RoutingLayer>& routing_layer_list = RTDM.getDatabase().get_routing_layer_list();
+
+  std::vector<GridMap<GRNode>>& layer_node_map = gr_model.get_layer_node_map();
+  layer_node_map.resize(routing_layer_list.size());
+#pragma omp parallel for
+  for (int32_t layer_idx = 0; layer_idx < static_cast<int32_t>(layer_node_map.size()); layer_idx++) {
+    GridMap<GRNode>& gr_node_map = layer_node_map[layer_idx];
+    gr_node_map.init(gcell_map.get_x_size(), gcell_map.get_y_size());
+    for (int32_t x = 0; x < gcell_map.get_x_size(); x++) {
+      for (int32_t y = 0; y < gcell_map.get_y_size(); y++) {
+        GRNode& gr_node = gr_node_map[x][y];
+        gr_node.set_coord(x, y);
+        gr_node.set_layer_idx(layer_idx);
+      }
+    }
+  }
+
+  RTLOG.info(Loc::current(), "Completed", monitor.getStatsInfo());
+}
+
+void GlobalRouter::buildGRNodeNeighbor(GRModel& gr_model)
+{
+  Monitor monitor;
+  RTLOG.info(Loc::current(), "Starting...");
+
+  std::vector<RoutingLayer>& routing_layer_list = RTDM.getDatabase().get_routing_layer_list();
+  GridMap<GCell>& gcell_map = RTDM.getDatabase().get_gcell_map();
+  int32_t bottom_routing_layer_idx = RTDM.getConfig().bottom_routing_layer_idx;
+  int32_t top_routing_layer_idx = RTDM.getConfig().top_routing_layer_idx;
+
+  std::vector<GridMap<GRNode>>& layer_node_map = gr_model.get_layer_node_map();
+
+#pragma omp parallel for
+  for (int32_t layer_idx = 0; layer_idx < static_cast<int32_t>(layer_node_map.size()); layer_idx++) {
+    bool routing_h = routing_layer_list[layer_idx].isPreferH();
+    bool routing_v = !routing_h;
+    if (layer_idx < bottom_routing_layer_idx || top_routing_layer_idx < layer_idx) {
+      routing_h = false;
+      routing_v = false;
+    }
+    GridMap<GRNode>& gr_node_map = layer_node_map[layer_idx];
+    for (int32_t x = 0; x < gcell_map.get_x_size(); x++) {
+      for (int32_t y = 0; y < gcell_map.get_y_size(); y++) {
+        OrientArray<GRNode*>& neighbor_node_map = gr_node_map[x][y].get_neighbor_node_map();
+        if (routing_h) {
+          if (x != 0) {
+            neighbor_node_map[Orientation::kWest] = &gr_node_map[x - 1][y];
+          }
+          if (x != (gr_node_map.get_x_size() - 1)) {
+            neighbor_node_map[Orientation::kEast] = &gr_node_map[x + 1][y];
+          }
+        }
+        if (routing_v) {
+          if (y != 0) {
+            neighbor_node_map[Orientation::kSouth] = &gr_node_map[x][y - 1];
+          }
+          if (y != (gr_node_map.get_y_size() - 1)) {
+            neighbor_node_map[Orientation::kNorth] = &gr_node_map[x][y + 1];
+          }
+        }
+        if (layer_idx != 0) {
+          neighbor_node_map[Orientation::kBelow] = &layer_node_map[layer_idx - 1][x][y];
+        }
+        if (layer_idx != static_cast<int32_t>(layer_node_map.size()) - 1) {
+          neighbor_node_map[Orientation::kAbove] = &layer_node_map[layer_idx + 1][x][y];
+        }
+      }
+    }
+  }
+
+  RTLOG.info(Loc::current(), "Completed", monitor.getStatsInfo());
+}
+
+void GlobalRouter::buildOrientSupply(GRModel& gr_model)
+{
+  Monitor monitor;
+  RTLOG.info(Loc::current(), "Starting...");
+
+  GridMap<GCell>& gcell_map = RTDM.getDatabase().get_gcell_map();
+
+  std::vector<GridMap<GRNode>>& layer_node_map = gr_model.get_layer_node_map();
+
+#pragma omp parallel for collapse(2)
+  for (int32_t x = 0; x < gcell_map.get_x_size(); x++) {
+    for (int32_t y = 0; y < gcell_map.get_y_size(); y++) {
+      for (int32_t layer_idx = 0; layer_idx < static_cast<int32_t>(layer_node_map.size()); layer_idx++) {
+        OrientArray<int32_t>& orient_supply_map = layer_node_map[layer_idx][x][y].get_orient_supply_map();
+        for (auto& [orient, supply] : gcell_map[x][y].get_routing_orient_supply_map()[layer_idx]) {
+          orient_supply_map[orient] = supply;
+        }
+      }
+    }
+  }
+
+  RTLOG.info(Loc::current(), "Completed", monitor.getStatsInfo());
+}
+
+void GlobalRouter::buildNetResult(GRModel& gr_model)
+{
+  Monitor monitor;
+  RTLOG.info(Loc::current(), "Starting...");
+
+  Die& die = RTDM.getDatabase().get_die();
+
+  std::vector<GRNet>& gr_net_list = gr_model.get_gr_net_list();
+
+  // 以initial_router的结果作为初始解
+  for (auto& [net_idx, segment_set] : RTDM.getGlobalNetResultMap(die)) {
+    GRNet& gr_net = gr_net_list[net_idx];
+    for (Segment<LayerCoord>* segment : segment_set) {
+      gr_net.get_routing_segment_list().push_back(*segment);
+    }
+    updateDemand(gr_model, &gr_net, ChangeType::kAdd);
+  }
+
+  RTLOG.info(Loc::current(), "Completed", monitor.getStatsInfo());
+}
+
+void GlobalRouter::iterativeGRModel(GRModel& gr_model)
+{
+  /**
+   * congestion_unit, history_unit, enlarged_size
+   */
+  std::vector<GRParameter> gr_parameter_list = {
+      /** format **/ {2, 1, 2},
+      /** format **/ {4, 2, 4},
+      /** format **/ {8, 4, 6},
+      /** format **/ {16, 8, 8},
+      /** format **/ {32, 16, 10},
+  };
+  for (size_t i = 0, iter = 1; i < gr_parameter_list.size(); i++, iter++) {
+    Monitor iter_monitor;
+    RTLOG.info(Loc::current(), "***** Begin iteration ", iter, "/", gr_parameter_list.size(), "(",
+               RTUTIL.getPercentage(iter, gr_parameter_list.size()), ") *****");
+    setGRParameter(gr_model, iter, gr_parameter_list[i]);
+    updateHistoryCost(gr_model);
+    initGRTaskList(gr_model);
+    buildTaskSchedule(gr_model);
+    routeGRTaskList(gr_model);
+    updateSummary(gr_model);
+    printSummary(gr_model);
+    RTLOG.info(Loc::current(), "***** End Iteration ", iter, "/", gr_parameter_list.size(), "(",
+               RTUTIL.getPercentage(iter, gr_parameter_list.size()), ")", iter_monitor.getStatsInfo(), "*****");
+    if (stopIteration(gr_model)) {
+      break;
+    }
+  }
+}
+
+void GlobalRouter::setGRParameter(GRModel& gr_model, int32_t iter, GRParameter& gr_parameter)
+{
+  gr_model.set_iter(iter);
+  RTLOG.info(Loc::current(), "prefer_wire_unit: ", gr_parameter.get_prefer_wire_unit());
+  RTLOG.info(Loc::current(), "via_unit: ", gr_parameter.get_via_unit());
+  RTLOG.info(Loc::current(), "corner_unit: ", gr_parameter.get_corner_unit());
+  RTLOG.info(Loc::current(), "congestion_unit: ", gr_parameter.get_congestion_unit());
+  RTLOG.info(Loc::current(), "history_unit: ", gr_parameter.get_history_unit());
+  RTLOG.info(Loc::current(), "enlarged_size: ", gr_parameter.get_enlarged_size());
+  gr_model.set_gr_parameter(gr_parameter);
+}
+
+void GlobalRouter::updateHistoryCost(GRModel& gr_model)
+{
+  double history_unit = gr_model.get_gr_parameter().get_history_unit();
+
+  std::vector<GridMap<GRNode>>& layer_node_map = gr_model.get_layer_node_map();
+
+#pragma omp parallel for
+  for (int32_t layer_idx = 0; layer_idx < static_cast<int32_t>(layer_node_map.size()); layer_idx++) {
+    GridMap<GRNode>& gr_node_map = layer_node_map[layer_idx];
+    for (int32_t x = 0; x < gr_node_map.get_x_size(); x++) {
+      for (int32_t y = 0; y < gr_node_map.get_y_size(); y++) {
+        GRNode& gr_node = gr_node_map[x][y];
+        int32_t overflow = gr_node.getOverflow();
+        if (overflow > 0) {
+          gr_node.set_history_cost(gr_node.get_history_cost() + history_unit * overflow);
+        }
+      }
+    }
+  }
+}
+
+void GlobalRouter::initGRTaskList(GRModel& gr_model)
+{
+  std::vector<GRNet>& gr_net_list = gr_model.get_gr_net_list();
+  std::vector<GRNet*>& gr_task_list = gr_model.get_gr_task_list();
+
+  std::vector<int32_t> overflow_flag_list(gr_net_list.size(), 0);
+#pragma omp parallel for
+  for (int32_t i = 0; i < static_cast<int32_t>(gr_net_list.size()); i++) {
+    GRNet& gr_net = gr_net_list[i];
+    if (gr_net.get_gr_pin_list().size() < 2 || !isOverflowNet(gr_model, &gr_net)) {
+      continue;
+    }
+    gr_net.set_search_rect(getSearchRect(gr_model, &gr_net));
+    overflow_flag_list[i] = 1;
+  }
+  gr_task_list.clear();
+  for (size_t i = 0; i < gr_net_list.size(); i++) {
+    if (overflow_flag_list[i]) {
+      gr_task_list.push_back(&gr_net_list[i]);
+    }
+  }
+  std::sort(gr_task_list.begin(), gr_task_list.end(), CmpGRNet());
+}
+
+bool GlobalRouter::isOverflowNet(GRModel& gr_model, GRNet* gr_net)
+{
+  std::vector<GridMap<GRNode>>& layer_node_map = gr_model.get_layer_node_map();
+
+  for (Segment<LayerCoord>& segment : gr_net->get_routing_segment_list()) {
+    LayerCoord& first_coord = segment.get_first();
+    LayerCoord& second_coord = segment.get_second();
+    if (first_coord.get_layer_idx() != second_coord.get_layer_idx()) {
+      continue;
+    }
+    int32_t first_x = first_coord.get_x();
+    int32_t first_y = first_coord.get_y();
+    int32_t second_x = second_coord.get_x();
+    int32_t second_y = second_coord.get_y();
+    RTUTIL.swapByASC(first_x, second_x);
+    RTUTIL.swapByASC(first_y, second_y);
+    GridMap<GRNode>& gr_node_map = layer_node_map[first_coord.get_layer_idx()];
+    for (int32_t x = first_x; x <= second_x; x++) {
+      for (int32_t y = first_y; y <= second_y; y++) {
+        if (gr_node_map[x][y].getOverflow() > 0) {
+          return true;
+        }
+      }
+    }
+  }
+  return false;
+}
+
+PlanarRect GlobalRouter::getSearchRect(GRModel& gr_model, GRNet* gr_net)
+{
+  GridMap<GCell>& gcell_map = RTDM.getDatabase().get_gcell_map();
+  int32_t enlarged_size = gr_model.get_gr_parameter().get_enlarged_size();
+
+  // 搜索区域需覆盖pin、原有结果以及外扩后的bounding_box，保证拆线和重布都在区域内
+  std::vector<PlanarCoord> coord_list;
+  for (GRPin& gr_pin : gr_net->get_gr_pin_list()) {
+    coord_list.push_back(gr_pin.get_key_access_point().get_grid_coord());
+  }
+  for (Segment<LayerCoord>& segment : gr_net->get_routing_segment_list()) {
+    coord_list.push_back(segment.get_first());
+    coord_list.push_back(segment.get_second());
+  }
+  PlanarRect search_rect = RTUTIL.getBoundingBox(coord_list);
+  search_rect.set_ll(std::max(0, search_rect.get_ll_x() - enlarged_size), std::max(0, search_rect.get_ll_y() - enlarged_size));
+  search_rect.set_ur(std::min(gcell_map.get_x_size() - 1, search_rect.get_ur_x() + enlarged_size),
+                     std::min(gcell_map.get_y_size() - 1, search_rect.get_ur_y() + enlarged_size));
+  return search_rect;
+}
+
+void GlobalRouter::buildTaskSchedule(GRModel& gr_model)
+{
+  GridMap<GCell>& gcell_map = RTDM.getDatabase().get_gcell_map();
+
+  std::vector<GRNet*>& gr_task_list = gr_model.get_gr_task_list();
+
+  // 在粗粒度网格上标记每一批已占用的区域，搜索区域互不相交的net放入同一批次
+  int32_t schedule_scale = std::max(1, std::max(gcell_map.get_x_size(), gcell_map.get_y_size()) / 256);
+  GridMap<int32_t> schedule_map(gcell_map.get_x_size() / schedule_scale + 1, gcell_map.get_y_size() / schedule_scale + 1, -1);
+
+  std::vector<std::vector<GRNet*>> gr_task_list_list;
+  std::vector<GRNet*> remain_task_list = gr_task_list;
+  while (!remain_task_list.empty()) {
+    int32_t batch_idx = static_cast<int32_t>(gr_task_list_list.size());
+    std::vector<GRNet*> batch_task_list;
+    std::vector<GRNet*> next_task_list;
+    for (GRNet* gr_task : remain_task_list) {
+      PlanarRect& search_rect = gr_task->get_search_rect();
+      int32_t ll_x = search_rect.get_ll_x() / schedule_scale;
+      int32_t ll_y = search_rect.get_ll_y() / schedule_scale;
+      int32_t ur_x = search_rect.get_ur_x() / schedule_scale;
+      int32_t ur_y = search_rect.get_ur_y() / schedule_scale;
+      bool is_conflict = false;
+      for (int32_t x = ll_x; x <= ur_x && !is_conflict; x++) {
+        for (int32_t y = ll_y; y <= ur_y; y++) {
+          if (schedule_map[x][y] == batch_idx) {
+            is_conflict = true;
+            break;
+          }
+        }
+      }
+      if (is_conflict) {
+        next_task_list.push_back(gr_task);
+        continue;
+      }
+      for (int32_t x = ll_x; x <= ur_x; x++) {
+        for (int32_t y = ll_y; y <= ur_y; y++) {
+          schedule_map[x][y] = batch_idx;
+        }
+      }
+      batch_task_list.push_back(gr_task);
+    }
+    gr_task_list_list.push_back(batch_task_list);
+    remain_task_list = next_task_list;
+  }
+  gr_model.set_gr_task_list_list(gr_task_list_list);
+}
+
+void GlobalRouter::routeGRTaskList(GRModel& gr_model)
+{
+  Monitor monitor;
+  RTLOG.info(Loc::current(), "Starting...");
+
+  std::vector<GRNet*>& gr_task_list = gr_model.get_gr_task_list();
+  std::vector<std::vector<GRNet*>>& gr_task_list_list = gr_model.get_gr_task_list_list();
+
+  RTLOG.info(Loc::current(), "Rerouting ", gr_task_list.size(), " overflow nets in ", gr_task_list_list.size(), " batches");
+
+  int32_t batch_size = RTUTIL.getBatchSize(gr_task_list.size());
+
+  Monitor stage_monitor;
+  size_t routed_task_num = 0;
+  for (std::vector<GRNet*>& batch_task_list : gr_task_list_list) {
+#pragma omp parallel for schedule(dynamic)
+    for (int32_t i = 0; i < static_cast<int32_t>(batch_task_list.size()); i++) {
+      routeGRNet(gr_model, batch_task_list[i]);
+    }
+    size_t pre_routed_task_num = routed_task_num;
+    routed_task_num += batch_task_list.size();
+    if (pre_routed_task_num / batch_size != routed_task_num / batch_size || routed_task_num == gr_task_list.size()) {
+      RTLOG.info(Loc::current(), "Routed ", routed_task_num, "/", gr_task_list.size(), "(",
+                 RTUTIL.getPercentage(routed_task_num, gr_task_list.size()), ") nets", stage_monitor.getStatsInfo());
+    }
+  }
+
+  RTLOG.info(Loc::current(), "Completed", monitor.getStatsInfo());
+}
+
+void GlobalRouter::routeGRNet(GRModel& gr_model, GRNet* gr_net)
+{
+  // 拆线
+  updateDemand(gr_model, gr_net, ChangeType::kDel);
+  // 重布，失败时保留原结果
+  std::vector<Segment<LayerCoord>> routing_segment_list;
+  if (routeGRTask(gr_model, gr_net, routing_segment_list)) {
+    MTree<LayerCoord> coord_tree = getCoordTree(gr_net, routing_segment_list);
+    std::vector<Segment<LayerCoord>> tree_segment_list;
+    for (Segment<TNode<LayerCoord>*>& coord_segment : RTUTIL.getSegListByTree(coord_tree)) {
+      tree_segment_list.emplace_back(coord_segment.get_first()->value(), coord_segment.get_second()->value());
+    }
+    gr_net->set_routing_segment_list(tree_segment_list);
+    gr_net->set_is_rerouted(true);
+  }
+  updateDemand(gr_model, gr_net, ChangeType::kAdd);
+}
+
+bool GlobalRouter::routeGRTask(GRModel& gr_model, GRNet* gr_net, std::vector<Segment<LayerCoord>>& routing_segment_list)
+{
+  std::vector<GridMap<GRNode>>& layer_node_map = gr_model.get_layer_node_map();
+
+  std::vector<GRNode*> key_node_list;
+  for (GRPin& gr_pin : gr_net->get_gr_pin_list()) {
+    LayerCoord grid_coord = gr_pin.get_key_access_point().getGridLayerCoord();
+    key_node_list.push_back(&layer_node_map[grid_coord.get_layer_idx()][grid_coord.get_x()][grid_coord.get_y()]);
+  }
+  // 从第一个pin出发，每次将距离树最近的pin连入树中
+  std::vector<GRNode*> tree_node_list = {key_node_list.front()};
+  std::set<GRNode*> end_node_set(key_node_list.begin(), key_node_list.end());
+  end_node_set.erase(key_node_list.front());
+  while (!end_node_set.empty()) {
+    std::vector<GRNode*> path_node_list = routeSinglePath(gr_model, gr_net, tree_node_list, end_node_set);
+    if (path_node_list.empty()) {
+      return false;
+    }
+    for (Segment<LayerCoord>& routing_segment : getRoutingSegmentListByPath(path_node_list)) {
+      routing_segment_list.push_back(routing_segment);
+    }
+    for (GRNode* path_node : path_node_list) {
+      end_node_set.erase(path_node);
+      tree_node_list.push_back(path_node);
+    }
+  }
+  return true;
+}
+
+std::vector<GRNode*> GlobalRouter::routeSinglePath(GRModel& gr_model, GRNet* gr_net, std::vector<GRNode*>& tree_node_list,
+                                                   std::set<GRNode*>& end_node_set)
+{
+  PlanarRect& search_rect = gr_net->get_search_rect();
+
+  std::vector<PlanarCoord> end_coord_list;
+  int32_t end_bottom_layer_idx = INT32_MAX;
+  int32_t end_top_layer_idx = INT32_MIN;
+  for (GRNode* end_node : end_node_set) {
+    end_coord_list.push_back(end_node->get_planar_coord());
+    end_bottom_layer_idx = std::min(end_bottom_layer_idx, end_node->get_layer_idx());
+    end_top_layer_idx = std::max(end_top_layer_idx, end_node->get_layer_idx());
+  }
+  PlanarRect end_rect = RTUTIL.getBoundingBox(end_coord_list);
+
+  // 同一批次内net的搜索区域互不相交，结点上的搜索状态不会被其他线程访问
+  std::priority_queue<std::pair<double, GRNode*>, std::vector<std::pair<double, GRNode*>>, std::greater<std::pair<double, GRNode*>>>
+      open_queue;
+  std::vector<GRNode*> visited_node_list;
+  for (GRNode* tree_node : tree_node_list) {
+    if (!tree_node->isNone()) {
+      continue;
+    }
+    tree_node->set_state(GRNodeState::kOpen);
+    tree_node->set_estimated_cost(getEstimateCost(gr_model, tree_node, end_rect, end_bottom_layer_idx, end_top_layer_idx));
+    open_queue.emplace(tree_node->getTotalCost(), tree_node);
+    visited_node_list.push_back(tree_node);
+  }
+  GRNode* path_head_node = nullptr;
+  while (!open_queue.empty()) {
+    GRNode* curr_node = open_queue.top().second;
+    open_queue.pop();
+    if (curr_node->isClose()) {
+      continue;
+    }
+    curr_node->set_state(GRNodeState::kClose);
+    if (RTUTIL.exist(end_node_set, curr_node)) {
+      path_head_node = curr_node;
+      break;
+    }
+    for (auto& [orientation, neighbor_node] : curr_node->get_neighbor_node_map()) {
+      if (neighbor_node == nullptr) {
+        continue;
+      }
+      if (!RTUTIL.isInside(search_rect, neighbor_node->get_planar_coord())) {
+        continue;
+      }
+      if (neighbor_node->isClose()) {
+        continue;
+      }
+      double know_cost = getKnowCost(gr_model, curr_node, neighbor_node);
+      if (neighbor_node->isNone()) {
+        neighbor_node->set_estimated_cost(getEstimateCost(gr_model, neighbor_node, end_rect, end_bottom_layer_idx, end_top_layer_idx));
+        visited_node_list.push_back(neighbor_node);
+      } else if (know_cost >= neighbor_node->get_known_cost()) {
+        continue;
+      }
+      neighbor_node->set_state(GRNodeState::kOpen);
+      neighbor_node->set_known_cost(know_cost);
+      neighbor_node->set_parent_node(curr_node);
+      open_queue.emplace(neighbor_node->getTotalCost(), neighbor_node);
+    }
+  }
+  std::vector<GRNode*> path_node_list;
+  for (GRNode* path_node = path_head_node; path_node != nullptr; path_node = path_node->get_parent_node()) {
+    path_node_list.push_back(path_node);
+  }
+  for (GRNode* visited_node : visited_node_list) {
+    visited_node->set_state(GRNodeState::kNone);
+    visited_node->set_parent_node(nullptr);
+    visited_node->set_known_cost(0);
+    visited_node->set_estimated_cost(0);
+  }
+  return path_node_list;
+}
+
+std::vector<Segment<LayerCoord>> GlobalRouter::getRoutingSegmentListByPath(std::vector<GRNode*>& path_node_list)
+{
+  std::vector<Segment<LayerCoord>> routing_segment_list;
+  if (path_node_list.size() < 2) {
+    // 终点已在树上
+    return routing_segment_list;
+  }
+  GRNode* start_node = path_node_list.front();
+  Orientation curr_orientation = RTUTIL.getOrientation(*path_node_list[0], *path_node_list[1]);
+  for (size_t i = 1; i < path_node_list.size(); i++) {
+    if (i + 1 == path_node_list.size() || RTUTIL.getOrientation(*path_node_list[i], *path_node_list[i + 1]) != curr_orientation) {
+      routing_segment_list.emplace_back(*start_node, *path_node_list[i]);
+      if (i + 1 < path_node_list.size()) {
+        start_node = path_node_list[i];
+        curr_orientation = RTUTIL.getOrientation(*path_node_list[i], *path_node_list[i + 1]);
+      }
+    }
+  }
+  return routing_segment_list;
+}
+
+double GlobalRouter::getKnowCost(GRModel& gr_model, GRNode* start_node, GRNode* end_node)
+{
+  std::vector<RoutingLayer>& routing_layer_list = RTDM.getDatabase().get_routing_layer_list();
+  GRParameter& gr_parameter = gr_model.get_gr_parameter();
+
+  double cost = 0;
+  cost += start_node->get_known_cost();
+  cost += getNodeCost(gr_model, start_node, RTUTIL.getOrientation(*start_node, *end_node));
+  cost += getNodeCost(gr_model, end_node, RTUTIL.getOrientation(*end_node, *start_node));
+  if (start_node->get_layer_idx() == end_node->get_layer_idx()) {
+    double wire_cost = RTUTIL.getManhattanDistance(start_node->get_planar_coord(), end_node->get_planar_coord());
+    if (routing_layer_list[start_node->get_layer_idx()].get_prefer_direction() == RTUTIL.getDirection(*start_node, *end_node)) {
+      wire_cost *= gr_parameter.get_prefer_wire_unit();
+    }
+    cost += wire_cost;
+    GRNode* parent_node = start_node->get_parent_node();
+    if (parent_node != nullptr && parent_node->get_layer_idx() == start_node->get_layer_idx()
+        && RTUTIL.getDirection(*parent_node, *start_node) != RTUTIL.getDirection(*start_node, *end_node)) {
+      cost += gr_parameter.get_corner_unit();
+    }
+  } else {
+    cost += gr_parameter.get_via_unit() * std::abs(start_node->get_layer_idx() - end_node->get_layer_idx());
+  }
+  return cost;
+}
+
+double GlobalRouter::getNodeCost(GRModel& gr_model, GRNode* curr_node, Orientation orientation)
+{
+  double congestion_unit = gr_model.get_gr_parameter().get_congestion_unit();
+
+  double node_cost = 0;
+  if (orientation != Orientation::kAbove && orientation != Orientation::kBelow) {
+    node_cost += (1 + curr_node->get_history_cost()) * curr_node->getCongestionCost(orientation) * congestion_unit;
+  }
+  return node_cost;
+}
+
+double GlobalRouter::getEstimateCost(GRModel& gr_model, GRNode* curr_node, PlanarRect& end_rect, int32_t end_bottom_layer_idx,
+                                     int32_t end_top_layer_idx)
+{
+  GRParameter& gr_parameter = gr_model.get_gr_parameter();
+
+  // 到剩余终点的bounding_box的距离，为可采纳的下界
+  int32_t x_distance = std::max({0, end_rect.get_ll_x() - curr_node->get_x(), curr_node->get_x() - end_rect.get_ur_x()});
+  int32_t y_distance = std::max({0, end_rect.get_ll_y() - curr_node->get_y(), curr_node->get_y() - end_rect.get_ur_y()});
+  int32_t layer_distance
+      = std::max({0, end_bottom_layer_idx - curr_node->get_layer_idx(), curr_node->get_layer_idx() - end_top_layer_idx});
+
+  double estimate_cost = 0;
+  estimate_cost += (x_distance + y_distance) * gr_parameter.get_prefer_wire_unit();
+  estimate_cost += layer_distance * gr_parameter.get_via_unit();
+  return estimate_cost;
+}
+
+MTree<LayerCoord> GlobalRouter::getCoordTree(GRNet* gr_net, std::vector<Segment<LayerCoord>>& routing_segment_list)
+{
+  std::vector<LayerCoord> candidate_root_coord_list;
+  std::map<LayerCoord, std::set<int32_t>, CmpLayerCoordByXASC> key_coord_pin_map;
+  std::vector<GRPin>& gr_pin_list = gr_net->get_gr_pin_list();
+  for (size_t i = 0; i < gr_pin_list.size(); i++) {
+    LayerCoord coord = gr_pin_list[i].get_key_access_point().getGridLayerCoord();
+    candidate_root_coord_list.push_back(coord);
+    key_coord_pin_map[coord].insert(static_cast<int32_t>(i));
+  }
+  return RTUTIL.getTreeByFullFlow(candidate_root_coord_list, routing_segment_list, key_coord_pin_map);
+}
+
+void GlobalRouter::updateDemand(GRModel& gr_model, GRNet* gr_net, ChangeType change_type)
+{
+  std::map<LayerCoord, std::set<Orientation>, CmpLayerCoordByXASC> usage_map;
+  for (Segment<LayerCoord>& coord_segment : gr_net->get_routing_segment_list()) {
+    LayerCoord& first_coord = coord_segment.get_first();
+    LayerCoord& second_coord = coord_segment.get_second();
+
+    Orientation orientation = RTUTIL.getOrientation(first_coord, second_coord);
+    if (orientation == Orientation::kNone || orientation == Orientation::kOblique) {
+      RTLOG.error(Loc::current(), "The orientation is error!");
+    }
+    Orientation opposite_orientation = RTUTIL.getOppositeOrientation(orientation);
+
+    int32_t first_x = first_coord.get_x();
+    int32_t first_y = first_coord.get_y();
+    int32_t first_layer_idx = first_coord.get_layer_idx();
+    int32_t second_x = second_coord.get_x();
+    int32_t second_y = second_coord.get_y();
+    int32_t second_layer_idx = second_coord.get_layer_idx();
+    RTUTIL.swapByASC(first_x, second_x);
+    RTUTIL.swapByASC(first_y, second_y);
+    RTUTIL.swapByASC(first_layer_idx, second_layer_idx);
+
+    for (int32_t x = first_x; x <= second_x; x++) {
+      for (int32_t y = first_y; y <= second_y; y++) {
+        for (int32_t layer_idx = first_layer_idx; layer_idx <= second_layer_idx; layer_idx++) {
+          LayerCoord coord(x, y, layer_idx);
+          if (coord != first_coord) {
+            usage_map[coord].insert(opposite_orientation);
+          }
+          if (coord != second_coord) {
+            usage_map[coord].insert(orientation);
+          }
+        }
+      }
+    }
+  }
+  std::vector<GridMap<GRNode>>& layer_node_map = gr_model.get_layer_node_map();
+  for (auto& [usage_coord, orientation_list] : usage_map) {
+    GRNode& gr_node = layer_node_map[usage_coord.get_layer_idx()][usage_coord.get_x()][usage_coord.get_y()];
+    gr_node.updateDemand(orientation_list, change_type);
+  }
+}
+
+bool GlobalRouter::stopIteration(GRModel& gr_model)
+{
+  std::map<int32_t, GRSummary>& iter_gr_summary_map = RTDM.getSummary().iter_gr_summary_map;
+  int32_t iter = gr_model.get_iter();
+
+  int32_t total_overflow = iter_gr_summary_map[iter].total_overflow;
+  if (total_overflow == 0) {
+    RTLOG.info(Loc::current(), "***** Iteration stopped early *****");
+    return true;
+  }
+  // 连续两轮溢出没有下降视为收敛
+  if (iter > 2 && total_overflow >= iter_gr_summary_map[iter - 2].total_overflow
+      && iter_gr_summary_map[iter - 1].total_overflow >= iter_gr_summary_map[iter - 2].total_overflow) {
+    RTLOG.info(Loc::current(), "***** Iteration converged *****");
+    return true;
+  }
+  return false;
+}
+
+void GlobalRouter::uploadNetResult(GRModel& gr_model)
+{
+  Monitor monitor;
+  RTLOG.info(Loc::current(), "Starting...");
+
+  Die& die = RTDM.getDatabase().get_die();
+
+  std::vector<GRNet>& gr_net_list = gr_model.get_gr_net_list();
+
+  for (auto& [net_idx, segment_set] : RTDM.getGlobalNetResultMap(die)) {
+    if (!gr_net_list[net_idx].get_is_rerouted()) {
+      continue;
+    }
+    for (Segment<LayerCoord>* segment : segment_set) {
+      RTDM.updateGlobalNetResultToGCellMap(ChangeType::kDel, net_idx, segment);
+    }
+  }
+  for (GRNet& gr_net : gr_net_list) {
+    if (!gr_net.get_is_rerouted()) {
+      continue;
+    }
+    for (Segment<LayerCoord>& routing_segment : gr_net.get_routing_segment_list()) {
+      RTDM.updateGlobalNetResultToGCellMap(ChangeType::kAdd, gr_net.get_net_idx(), new Segment<LayerCoord>(routing_segment));
+    }
+  }
+
+  RTLOG.info(Loc::current(), "Completed", monitor.getStatsInfo());
+}
+
+#if 1  // exhibit
+
+void GlobalRouter::updateSummary(GRModel& gr_model)
+{
+  int32_t micron_dbu = RTDM.getDatabase().get_micron_dbu();
+  GridMap<GCell>& gcell_map = RTDM.getDatabase().get_gcell_map();
+  std::vector<RoutingLayer>& routing_layer_list = RTDM.getDatabase().get_routing_layer_list();
+  std::vector<CutLayer>& cut_layer_list = RTDM.getDatabase().get_cut_layer_list();
+  std::vector<std::vector<ViaMaster>>& layer_via_master_list = RTDM.getDatabase().get_layer_via_master_list();
+  GRSummary& gr_summary = RTDM.getSummary().iter_gr_summary_map[gr_model.get_iter()];
+
+  std::vector<GridMap<GRNode>>& layer_node_map = gr_model.get_layer_node_map();
+
+  for (RoutingLayer& routing_layer : routing_layer_list) {
+    gr_summary.routing_demand_map[routing_layer.get_layer_idx()] = 0;
+    gr_summary.routing_overflow_map[routing_layer.get_layer_idx()] = 0;
+    gr_summary.routing_wire_length_map[routing_layer.get_layer_idx()] = 0;
+  }
+  gr_summary.total_demand = 0;
+  gr_summary.total_overflow = 0;
+  gr_summary.total_wire_length = 0;
+  for (CutLayer& cut_layer : cut_layer_list) {
+    gr_summary.cut_via_num_map[cut_layer.get_layer_idx()] = 0;
+  }
+  gr_summary.total_via_num = 0;
+
+  for (int32_t layer_idx = 0; layer_idx < static_cast<int32_t>(layer_node_map.size()); layer_idx++) {
+    GridMap<GRNode>& gr_node_map = layer_node_map[layer_idx];
+    for (int32_t x = 0; x < gr_node_map.get_x_size(); x++) {
+      for (int32_t y = 0; y < gr_node_map.get_y_size(); y++) {
+        OrientArray<int32_t>& orient_supply_map = gr_node_map[x][y].get_orient_supply_map();
+        OrientArray<int32_t>& orient_demand_map = gr_node_map[x][y].get_orient_demand_map();
+        int32_t node_demand = 0;
+        int32_t node_overflow = 0;
+        if (routing_layer_list[layer_idx].isPreferH()) {
+          node_demand = (orient_demand_map[Orientation::kEast] + orient_demand_map[Orientation::kWest]);
+          node_overflow = std::max(0, orient_demand_map[Orientation::kEast] - orient_supply_map[Orientation::kEast])
+                          + std::max(0, orient_demand_map[Orientation::kWest] - orient_supply_map[Orientation::kWest]);
+        } else {
+          node_demand = (orient_demand_map[Orientation::kSouth] + orient_demand_map[Orientation::kNorth]);
+          node_overflow = std::max(0, orient_demand_map[Orientation::kSouth] - orient_supply_map[Orientation::kSouth])
+                          + std::max(0, orient_demand_map[Orientation::kNorth] - orient_supply_map[Orientation::kNorth]);
+        }
+        gr_summary.routing_demand_map[layer_idx] += node_demand;
+        gr_summary.total_demand += node_demand;
+        gr_summary.routing_overflow_map[layer_idx] += node_overflow;
+        gr_summary.total_overflow += node_overflow;
+      }
+    }
+  }
+  for (GRNet& gr_net : gr_model.get_gr_net_list()) {
+    for (Segment<LayerCoord>& segment : gr_net.get_routing_segment_list()) {
+      LayerCoord& first_coord = segment.get_first();
+      int32_t first_layer_idx = first_coord.get_layer_idx();
+      LayerCoord& second_coord = segment.get_second();
+      int32_t second_layer_idx = second_coord.get_layer_idx();
+
+      if (first_layer_idx == second_layer_idx) {
+        GCell& first_gcell = gcell_map[first_coord.get_x()][first_coord.get_y()];
+        GCell& second_gcell = gcell_map[second_coord.get_x()][second_coord.get_y()];
+        double wire_length = RTUTIL.getManhattanDistance(first_gcell.getMidPoint(), second_gcell.getMidPoint()) / 1.0 / micron_dbu;
+        gr_summary.routing_wire_length_map[first_layer_idx] += wire_length;
+        gr_summary.total_wire_length += wire_length;
+      } else {
+        RTUTIL.swapByASC(first_layer_idx, second_layer_idx);
+        for (int32_t layer_idx = first_layer_idx; layer_idx < second_layer_idx; layer_idx++) {
+          gr_summary.cut_via_num_map[layer_via_master_list[layer_idx].front().get_cut_layer_idx()]++;
+          gr_summary.total_via_num++;
+        }
+      }
+    }
+  }
+}
+
+void GlobalRouter::printSummary(GRModel& gr_model)
+{
+  std::vector<RoutingLayer>& routing_layer_list = RTDM.getDatabase().get_routing_layer_list();
+  std::vector<CutLayer>& cut_layer_list = RTDM.getDatabase().get_cut_layer_list();
+  GRSummary& gr_summary = RTDM.getSummary().iter_gr_summary_map[gr_model.get_iter()];
+  std::map<int32_t, int32_t>& routing_demand_map = gr_summary.routing_demand_map;
+  int32_t& total_demand = gr_summary.total_demand;
+  std::map<int32_t, int32_t>& routing_overflow_map = gr_summary.routing_overflow_map;
+  int32_t& total_overflow = gr_summary.total_overflow;
+  std::map<int32_t, double>& routing_wire_length_map = gr_summary.routing_wire_length_map;
+  double& total_wire_length = gr_summary.total_wire_length;
+  std::map<int32_t, int32_t>& cut_via_num_map = gr_summary.cut_via_num_map;
+  int32_t& total_via_num = gr_summary.total_via_num;
+
+  fort::char_table routing_demand_map_table;
+  {
+    routing_demand_map_table << fort::header << "routing_layer" << "demand" << "proportion" << fort::endr;
+    for (RoutingLayer& routing_layer : routing_layer_list) {
+      routing_demand_map_table << routing_layer.get_layer_name() << routing_demand_map[routing_layer.get_layer_idx()]
+                               << RTUTIL.getPercentage(routing_demand_map[routing_layer.get_layer_idx()], total_demand) << fort::endr;
+    }
+    routing_demand_map_table << fort::header << "Total" << total_demand << RTUTIL.getPercentage(total_demand, total_demand) << fort::endr;
+  }
+  fort::char_table routing_overflow_map_table;
+  {
+    routing_overflow_map_table << fort::header << "routing_layer" << "overflow" << "proportion" << fort::endr;
+    for (RoutingLayer& routing_layer : routing_layer_list) {
+      routing_overflow_map_table << routing_layer.get_layer_name() << routing_overflow_map[routing_layer.get_layer_idx()]
+                                 << RTUTIL.getPercentage(routing_overflow_map[routing_layer.get_layer_idx()], total_overflow) << fort::endr;
+    }
+    routing_overflow_map_table << fort::header << "Total" << total_overflow << RTUTIL.getPercentage(total_overflow, total_overflow)
+                               << fort::endr;
+  }
+  fort::char_table routing_wire_length_map_table;
+  {
+    routing_wire_length_map_table << fort::header << "routing_layer" << "wire_length" << "proportion" << fort::endr;
+    for (RoutingLayer& routing_layer : routing_layer_list) {
+      routing_wire_length_map_table << routing_layer.get_layer_name() << routing_wire_length_map[routing_layer.get_layer_idx()]
+                                    << RTUTIL.getPercentage(routing_wire_length_map[routing_layer.get_layer_idx()], total_wire_length)
+                                    << fort::endr;
+    }
+    routing_wire_length_map_table << fort::header << "Total" << total_wire_length
+                                  << RTUTIL.getPercentage(total_wire_length, total_wire_length) << fort::endr;
+  }
+  fort::char_table cut_via_num_map_table;
+  {
+    cut_via_num_map_table << fort::header << "cut_layer" << "via_num" << "proportion" << fort::endr;
+    for (CutLayer& cut_layer : cut_layer_list) {
+      cut_via_num_map_table << cut_layer.get_layer_name() << cut_via_num_map[cut_layer.get_layer_idx()]
+                            << RTUTIL.getPercentage(cut_via_num_map[cut_layer.get_layer_idx()], total_via_num) << fort::endr;
+    }
+    cut_via_num_map_table << fort::header << "Total" << total_via_num << RTUTIL.getPercentage(total_via_num, total_via_num) << fort::endr;
+  }
+  RTUTIL.printTableList({routing_demand_map_table, routing_overflow_map_table, routing_wire_length_map_table, cut_via_num_map_table});
+}
+
+#endif
+
 }  // namespace irt
@@ -16,10 +16,13 @@
 // ***************************************************************************************
 #pragma once
 
+#include "ChangeType.hpp"
 #include "Config.hpp"
 #include "DataManager.hpp"
 #include "Database.hpp"
+#include "GRModel.hpp"
 #include "Monitor.hpp"
+#include "RTHeader.hpp"
 
 namespace irt {
 
@@ -45,6 +48,39 @@ class GlobalRouter
   GlobalRouter& operator=(const GlobalRouter& other) = delete;
   GlobalRouter& operator=(GlobalRouter&& other) = delete;
   // function
+  GRModel initGRModel();
+  std::vector<GRNet> convertToGRNetList(std::vector<Net>& net_list);
+  GRNet convertToGRNet(Net& net);
+  void buildLayerNodeMap(GRModel& gr_model);
+  void buildGRNodeNeighbor(GRModel& gr_model);
+  void buildOrientSupply(GRModel& gr_model);
+  void buildNetResult(GRModel& gr_model);
+  void iterativeGRModel(GRModel& gr_model);
+  void setGRParameter(GRModel& gr_model, int32_t iter, GRParameter& gr_parameter);
+  void updateHistoryCost(GRModel& gr_model);
+  void initGRTaskList(GRModel& gr_model);
+  bool isOverflowNet(GRModel& gr_model, GRNet* gr_net);
+  PlanarRect getSearchRect(GRModel& gr_model, GRNet* gr_net);
+  void buildTaskSchedule(GRModel& gr_model);
+  void routeGRTaskList(GRModel& gr_model);
+  void routeGRNet(GRModel& gr_model, GRNet* gr_net);
+  bool routeGRTask(GRModel& gr_model, GRNet* gr_net, std::vector<Segment<LayerCoord>>& routing_segment_list);
+  std::vector<GRNode*> routeSinglePath(GRModel& gr_model, GRNet* gr_net, std::vector<GRNode*>& tree_node_list,
+                                       std::set<GRNode*>& end_node_set);
+  std::vector<Segment<LayerCoord>> getRoutingSegmentListByPath(std::vector<GRNode*>& path_node_list);
+  double getKnowCost(GRModel& gr_model, GRNode* start_node, GRNode* end_node);
+  double getNodeCost(GRModel& gr_model, GRNode* curr_node, Orientation orientation);
+  double getEstimateCost(GRModel& gr_model, GRNode* curr_node, PlanarRect& end_rect, int32_t end_bottom_layer_idx,
+                         int32_t end_top_layer_idx);
+  MTree<LayerCoord> getCoordTree(GRNet* gr_net, std::vector<Segment<LayerCoord>>& routing_segment_list);
+  void updateDemand(GRModel& gr_model, GRNet* gr_net, ChangeType change_type);
+  bool stopIteration(GRModel& gr_model);
+  void uploadNetResult(GRModel& gr_model);
+
+#if 1  // exhibit
+  void updateSummary(GRModel& gr_model);
+  void printSummary(GRModel& gr_model);
+#endif
 };
 
 }  // namespace irt
@@ -0,0 +1,57 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#pragma once
+
+#include "GRNet.hpp"
+#include "GRNode.hpp"
+#include "GRParameter.hpp"
+#include "GridMap.hpp"
+
+namespace irt {
+
+class GRModel
+{
+ public:
+  GRModel() = default;
+  ~GRModel() = default;
+  // getter
+  std::vector<GRNet>& get_gr_net_list() { return _gr_net_list; }
+  int32_t get_iter() const { return _iter; }
+  GRParameter& get_gr_parameter() { return _gr_parameter; }
+  std::vector<GridMap<GRNode>>& get_layer_node_map() { return _layer_node_map; }
+  std::vector<GRNet*>& get_gr_task_list() { return _gr_task_list; }
+  std::vector<std::vector<GRNet*>>& get_gr_task_list_list() { return _gr_task_list_list; }
+  // setter
+  void set_gr_net_list(const std::vector<GRNet>& gr_net_list) { _gr_net_list = gr_net_list; }
+  void set_iter(const int32_t iter) { _iter = iter; }
+  void set_gr_parameter(const GRParameter& gr_parameter) { _gr_parameter = gr_parameter; }
+  void set_layer_node_map(const std::vector<GridMap<GRNode>>& layer_node_map) { _layer_node_map = layer_node_map; }
+  void set_gr_task_list(const std::vector<GRNet*>& gr_task_list) { _gr_task_list = gr_task_list; }
+  void set_gr_task_list_list(const std::vector<std::vector<GRNet*>>& gr_task_list_list) { _gr_task_list_list = gr_task_list_list; }
+
+ private:
+  std::vector<GRNet> _gr_net_list;
+  int32_t _iter = -1;
+  GRParameter _gr_parameter;
+  std::vector<GridMap<GRNode>> _layer_node_map;
+  // 本轮需要拆线重布的net
+  std::vector<GRNet*> _gr_task_list;
+  // 按搜索区域互不相交分批，批内并行
+  std::vector<std::vector<GRNet*>> _gr_task_list_list;
+};
+
+}  // namespace irt
@@ -0,0 +1,124 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#pragma once
+
+#include "Direction.hpp"
+#include "LayerCoord.hpp"
+#include "OrientArray.hpp"
+#include "Orientation.hpp"
+#include "RTHeader.hpp"
+#include "Utility.hpp"
+
+namespace irt {
+
+#if 1  // astar
+enum class GRNodeState
+{
+  kNone = 0,
+  kOpen = 1,
+  kClose = 2
+};
+#endif
+
+class GRNode : public LayerCoord
+{
+ public:
+  GRNode() = default;
+  ~GRNode() = default;
+  // getter
+  OrientArray<GRNode*>& get_neighbor_node_map() { return _neighbor_node_map; }
+  OrientArray<int32_t>& get_orient_supply_map() { return _orient_supply_map; }
+  OrientArray<int32_t>& get_orient_demand_map() { return _orient_demand_map; }
+  double get_history_cost() const { return _history_cost; }
+  // setter
+  void set_neighbor_node_map(const OrientArray<GRNode*>& neighbor_node_map) { _neighbor_node_map = neighbor_node_map; }
+  void set_orient_supply_map(const OrientArray<int32_t>& orient_supply_map) { _orient_supply_map = orient_supply_map; }
+  void set_orient_demand_map(const OrientArray<int32_t>& orient_demand_map) { _orient_demand_map = orient_demand_map; }
+  void set_history_cost(const double history_cost) { _history_cost = history_cost; }
+  // function
+  GRNode* getNeighborNode(Orientation orientation) { return _neighbor_node_map.get(orientation); }
+  double getCongestionCost(Orientation orientation)
+  {
+    double cost = 0;
+    if (orientation != Orientation::kAbove && orientation != Orientation::kBelow) {
+      int32_t node_demand = _orient_demand_map.get(orientation);
+      int32_t node_supply = _orient_supply_map.get(orientation);
+      cost += calcCost(node_demand + 1, node_supply);
+    }
+    return cost;
+  }
+  double calcCost(double demand, double supply)
+  {
+    double cost = 0;
+    if (demand == supply) {
+      cost = 1;
+    } else if (demand > supply) {
+      cost = std::pow(demand - supply + 1, 2);
+    } else if (demand < supply) {
+      cost = std::pow(demand / supply, 2);
+    }
+    return cost;
+  }
+  int32_t getOverflow()
+  {
+    int32_t overflow = 0;
+    for (Orientation orient : {Orientation::kEast, Orientation::kWest, Orientation::kSouth, Orientation::kNorth}) {
+      overflow += std::max(0, _orient_demand_map[orient] - _orient_supply_map[orient]);
+    }
+    return overflow;
+  }
+  void updateDemand(std::set<Orientation> orient_set, ChangeType change_type)
+  {
+    for (const Orientation& orient : orient_set) {
+      if (orient == Orientation::kEast || orient == Orientation::kWest || orient == Orientation::kSouth || orient == Orientation::kNorth) {
+        _orient_demand_map[orient] += (change_type == ChangeType::kAdd ? 1 : -1);
+      }
+    }
+  }
+#if 1  // astar
+  // single path
+  GRNodeState& get_state() { return _state; }
+  GRNode* get_parent_node() const { return _parent_node; }
+  double get_known_cost() const { return _known_cost; }
+  double get_estimated_cost() const { return _estimated_cost; }
+  void set_state(GRNodeState state) { _state = state; }
+  void set_parent_node(GRNode* parent_node) { _parent_node = parent_node; }
+  void set_known_cost(const double known_cost) { _known_cost = known_cost; }
+  void set_estimated_cost(const double estimated_cost) { _estimated_cost = estimated_cost; }
+  // function
+  bool isNone() { return _state == GRNodeState::kNone; }
+  bool isOpen() { return _state == GRNodeState::kOpen; }
+  bool isClose() { return _state == GRNodeState::kClose; }
+  double getTotalCost() { return (_known_cost + _estimated_cost); }
+#endif
+
+ private:
+  OrientArray<GRNode*> _neighbor_node_map;
+  OrientArray<int32_t> _orient_supply_map;
+  OrientArray<int32_t> _orient_demand_map;
+  // 协商拥塞的历史代价，每轮迭代在溢出的node上累加
+  double _history_cost = 0.0;
+#if 1  // astar
+  // single path
+  GRNodeState _state = GRNodeState::kNone;
+  GRNode* _parent_node = nullptr;
+  double _known_cost = 0.0;  // include curr
+  double _estimated_cost = 0.0;
+#endif
+};
+
+}  // namespace irt
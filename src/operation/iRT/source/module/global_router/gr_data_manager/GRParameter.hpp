@@ -0,0 +1,60 @@
+// ***************************************************************************************
+// Copyright (c) 2023-2025 Peng Cheng Laboratory
+// Copyright (c) 2023-2025 Institute of Computing Technology, Chinese Academy of Sciences
+// Copyright (c) 2023-2025 Beijing Institute of Open Source Chip
+//
+// iEDA is licensed under Mulan PSL v2.
+// You can use this software according to the terms and conditions of the Mulan PSL v2.
+// You may obtain a copy of Mulan PSL v2 at:
+// http://license.coscl.org.cn/MulanPSL2
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+// EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+// MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+//
+// See the Mulan PSL v2 for more details.
+// ***************************************************************************************
+#pragma once
+
+namespace irt {
+
+class GRParameter
+{
+ public:
+  GRParameter() = default;
+  GRParameter(double congestion_unit, double history_unit, int32_t enlarged_size)
+  {
+    _prefer_wire_unit = 1;
+    _via_unit = 1;
+    _corner_unit = 1;
+    _congestion_unit = congestion_unit;
+    _history_unit = history_unit;
+    _enlarged_size = enlarged_size;
+  }
+  ~GRParameter() = default;
+  // getter
+  double get_prefer_wire_unit() const { return _prefer_wire_unit; }
+  double get_via_unit() const { return _via_unit; }
+  double get_corner_unit() const { return _corner_unit; }
+  double get_congestion_unit() const { return _congestion_unit; }
+  double get_history_unit() const { return _history_unit; }
+  int32_t get_enlarged_size() const { return _enlarged_size; }
+  // setter
+  void set_prefer_wire_unit(const double prefer_wire_unit) { _prefer_wire_unit = prefer_wire_unit; }
+  void set_via_unit(const double via_unit) { _via_unit = via_unit; }
+  void set_corner_unit(const double corner_unit) { _corner_unit = corner_unit; }
+  void set_congestion_unit(const double congestion_unit) { _congestion_unit = congestion_unit; }
+  void set_history_unit(const double history_unit) { _history_unit = history_unit; }
+  void set_enlarged_size(const int32_t enlarged_size) { _enlarged_size = enlarged_size; }
+
+ private:
+  double _prefer_wire_unit = 0;
+  double _via_unit = 0;
+  double _corner_unit = 0;
+  double _congestion_unit = 0;
+  double _history_unit = 0;
+  // 搜索区域相对net的bounding_box的外扩(gcell数)
+  int32_t _enlarged_size = 0;
+};
+
+}  // namespace irt
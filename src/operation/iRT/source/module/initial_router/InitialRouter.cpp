@@ -62,6 +62,7 @@ void InitialRouter::route()
   buildOrientSupply(ir_model);
   // debugCheckIRModel(ir_model);
   buildTopoTree(ir_model);
+  buildTaskSchedule(ir_model);
   routeIRModel(ir_model);
   // debugOutputGuide(ir_model);
   updateSummary(ir_model);
@@ -178,7 +179,7 @@ void InitialRouter::buildIRNodeNeighbor(IRModel& ir_model)
     GridMap<IRNode>& ir_node_map = layer_node_map[layer_idx];
     for (int32_t x = 0; x < gcell_map.get_x_size(); x++) {
       for (int32_t y = 0; y < gcell_map.get_y_size(); y++) {
-        std::map<Orientation, IRNode*>& neighbor_node_map = ir_node_map[x][y].get_neighbor_node_map();
+        OrientArray<IRNode*>& neighbor_node_map = ir_node_map[x][y].get_neighbor_node_map();
         if (routing_h) {
           if (x != 0) {
             neighbor_node_map[Orientation::kWest] = &ir_node_map[x - 1][y];
@@ -221,7 +222,10 @@ void InitialRouter::buildOrientSupply(IRModel& ir_model)
   for (int32_t x = 0; x < gcell_map.get_x_size(); x++) {
     for (int32_t y = 0; y < gcell_map.get_y_size(); y++) {
       for (int32_t layer_idx = 0; layer_idx < static_cast<int32_t>(layer_node_map.size()); layer_idx++) {
-        layer_node_map[layer_idx][x][y].set_orient_supply_map(gcell_map[x][y].get_routing_orient_supply_map()[layer_idx]);
+        OrientArray<int32_t>& orient_supply_map = layer_node_map[layer_idx][x][y].get_orient_supply_map();
+        for (auto& [orient, supply] : gcell_map[x][y].get_routing_orient_supply_map()[layer_idx]) {
+          orient_supply_map[orient] = supply;
+        }
       }
     }
   }
@@ -263,42 +267,114 @@ void InitialRouter::buildTopoTree(IRModel& ir_model)
   RTLOG.info(Loc::current(), "Completed", monitor.getStatsInfo());
 }
 
+void InitialRouter::buildTaskSchedule(IRModel& ir_model)
+{
+  Monitor monitor;
+  RTLOG.info(Loc::current(), "Starting...");
+
+  GridMap<GCell>& gcell_map = RTDM.getDatabase().get_gcell_map();
+
+  std::vector<IRNet*>& ir_task_list = ir_model.get_ir_task_list();
+
+  // 在粗粒度网格上记录每个区域最后被分配的批次，net放入其区域内最大批次的下一批次
+  // 区域重叠的net保持原有的先后顺序，结果与串行布线一致且与线程数无关
+  int32_t schedule_scale = std::max(1, std::max(gcell_map.get_x_size(), gcell_map.get_y_size()) / 256);
+  GridMap<int32_t> schedule_map(gcell_map.get_x_size() / schedule_scale + 1, gcell_map.get_y_size() / schedule_scale + 1, -1);
+
+  std::vector<std::vector<IRNet*>> ir_task_list_list;
+  for (IRNet* ir_task : ir_task_list) {
+    PlanarRect routing_rect = getRoutingRect(ir_task);
+    int32_t ll_x = routing_rect.get_ll_x() / schedule_scale;
+    int32_t ll_y = routing_rect.get_ll_y() / schedule_scale;
+    int32_t ur_x = routing_rect.get_ur_x() / schedule_scale;
+    int32_t ur_y = routing_rect.get_ur_y() / schedule_scale;
+    int32_t batch_idx = 0;
+    for (int32_t x = ll_x; x <= ur_x; x++) {
+      for (int32_t y = ll_y; y <= ur_y; y++) {
+        batch_idx = std::max(batch_idx, schedule_map[x][y] + 1);
+      }
+    }
+    for (int32_t x = ll_x; x <= ur_x; x++) {
+      for (int32_t y = ll_y; y <= ur_y; y++) {
+        schedule_map[x][y] = batch_idx;
+      }
+    }
+    if (static_cast<int32_t>(ir_task_list_list.size()) <= batch_idx) {
+      ir_task_list_list.resize(batch_idx + 1);
+    }
+    ir_task_list_list[batch_idx].push_back(ir_task);
+  }
+  ir_model.set_ir_task_list_list(ir_task_list_list);
+
+  RTLOG.info(Loc::current(), "Scheduled ", ir_task_list.size(), " nets into ", ir_task_list_list.size(), " batches");
+  RTLOG.info(Loc::current(), "Completed", monitor.getStatsInfo());
+}
+
+PlanarRect InitialRouter::getRoutingRect(IRNet* ir_net)
+{
+  // 搜索只在topo的bounding_box内进行，其并集被pin与topo_tree的bounding_box覆盖
+  std::vector<PlanarCoord> coord_list;
+  for (IRPin& ir_pin : ir_net->get_ir_pin_list()) {
+    coord_list.push_back(ir_pin.get_key_access_point().get_grid_coord());
+  }
+  if (ir_net->get_topo_tree().get_root() != nullptr) {
+    for (Segment<TNode<LayerCoord>*>& coord_segment : RTUTIL.getSegListByTree(ir_net->get_topo_tree())) {
+      coord_list.push_back(coord_segment.get_first()->value());
+      coord_list.push_back(coord_segment.get_second()->value());
+    }
+  }
+  return RTUTIL.getBoundingBox(coord_list);
+}
+
 void InitialRouter::routeIRModel(IRModel& ir_model)
 {
   Monitor monitor;
   RTLOG.info(Loc::current(), "Starting...");
 
   std::vector<IRNet*>& ir_task_list = ir_model.get_ir_task_list();
+  std::vector<std::vector<IRNet*>>& ir_task_list_list = ir_model.get_ir_task_list_list();
 
   int32_t batch_size = RTUTIL.getBatchSize(ir_task_list.size());
 
   Monitor stage_monitor;
-  for (size_t i = 0; i < ir_task_list.size(); i++) {
-    routeIRNet(ir_model, ir_task_list[i]);
-    if ((i + 1) % batch_size == 0 || (i + 1) == ir_task_list.size()) {
-      RTLOG.info(Loc::current(), "Routed ", (i + 1), "/", ir_task_list.size(), "(", RTUTIL.getPercentage(i + 1, ir_task_list.size()),
-                 ") nets", stage_monitor.getStatsInfo());
+  size_t routed_task_num = 0;
+  for (std::vector<IRNet*>& ir_batch_task_list : ir_task_list_list) {
+    // 同一批次内net的区域互不相交，可并行布线
+    std::vector<MTree<LayerCoord>> coord_tree_list(ir_batch_task_list.size());
+#pragma omp parallel for schedule(dynamic)
+    for (int32_t i = 0; i < static_cast<int32_t>(ir_batch_task_list.size()); i++) {
+      coord_tree_list[i] = routeIRNet(ir_model, ir_batch_task_list[i]);
+    }
+    // 批次之间按原顺序提交结果
+    for (size_t i = 0; i < ir_batch_task_list.size(); i++) {
+      updateDemand(ir_model, ir_batch_task_list[i], coord_tree_list[i]);
+      uploadNetResult(ir_batch_task_list[i], coord_tree_list[i]);
+    }
+    size_t pre_routed_task_num = routed_task_num;
+    routed_task_num += ir_batch_task_list.size();
+    if (pre_routed_task_num / batch_size != routed_task_num / batch_size || routed_task_num == ir_task_list.size()) {
+      RTLOG.info(Loc::current(), "Routed ", routed_task_num, "/", ir_task_list.size(), "(",
+                 RTUTIL.getPercentage(routed_task_num, ir_task_list.size()), ") nets", stage_monitor.getStatsInfo());
     }
   }
 
   RTLOG.info(Loc::current(), "Completed", monitor.getStatsInfo());
 }
 
-void InitialRouter::routeIRNet(IRModel& ir_model, IRNet* ir_net)
+MTree<LayerCoord> InitialRouter::routeIRNet(IRModel& ir_model, IRNet* ir_net)
 {
+  IRSearch ir_search;
   // 构建ir_topo_list，并将通孔线段加入routing_segment_list
   std::vector<IRTopo> ir_topo_list;
   std::vector<Segment<LayerCoord>> routing_segment_list;
   makeIRTopoList(ir_model, ir_net, ir_topo_list, routing_segment_list);
   for (IRTopo& ir_topo : ir_topo_list) {
-    routeIRTopo(ir_model, &ir_topo);
+    routeIRTopo(ir_model, ir_search, &ir_topo);
     for (Segment<LayerCoord>& routing_segment : ir_topo.get_routing_segment_list()) {
       routing_segment_list.push_back(routing_segment);
     }
   }
-  MTree<LayerCoord> coord_tree = getCoordTree(ir_net, routing_segment_list);
-  updateDemand(ir_model, ir_net, coord_tree);
-  uploadNetResult(ir_net, coord_tree);
+  return getCoordTree(ir_net, routing_segment_list);
 }
 
 void InitialRouter::makeIRTopoList(IRModel& ir_model, IRNet* ir_net, std::vector<IRTopo>& ir_topo_list,
@@ -416,26 +492,26 @@ void InitialRouter::makeIRTopoList(IRModel& ir_model, IRNet* ir_net, std::vector
   }
 }
 
-void InitialRouter::routeIRTopo(IRModel& ir_model, IRTopo* ir_topo)
+void InitialRouter::routeIRTopo(IRModel& ir_model, IRSearch& ir_search, IRTopo* ir_topo)
 {
-  initSingleTask(ir_model, ir_topo);
-  while (!isConnectedAllEnd(ir_model)) {
-    routeSinglePath(ir_model);
-    updatePathResult(ir_model);
-    updateDirectionSet(ir_model);
-    resetStartAndEnd(ir_model);
-    resetSinglePath(ir_model);
-  }
-  updateTaskResult(ir_model);
-  resetSingleTask(ir_model);
+  initSingleTask(ir_model, ir_search, ir_topo);
+  while (!isConnectedAllEnd(ir_model, ir_search)) {
+    routeSinglePath(ir_model, ir_search);
+    updatePathResult(ir_model, ir_search);
+    updateDirectionSet(ir_model, ir_search);
+    resetStartAndEnd(ir_model, ir_search);
+    resetSinglePath(ir_model, ir_search);
+  }
+  updateTaskResult(ir_model, ir_search);
+  resetSingleTask(ir_model, ir_search);
 }
 
-void InitialRouter::initSingleTask(IRModel& ir_model, IRTopo* ir_topo)
+void InitialRouter::initSingleTask(IRModel& ir_model, IRSearch& ir_search, IRTopo* ir_topo)
 {
   std::vector<GridMap<IRNode>>& layer_node_map = ir_model.get_layer_node_map();
 
   // single topo
-  ir_model.set_curr_ir_topo(ir_topo);
+  ir_search.set_curr_ir_topo(ir_topo);
   {
     std::vector<std::vector<IRNode*>> node_list_list;
     std::vector<IRGroup>& ir_group_list = ir_topo->get_ir_group_list();
@@ -449,62 +525,62 @@ void InitialRouter::initSingleTask(IRModel& ir_model, IRTopo* ir_topo)
     }
     for (size_t i = 0; i < node_list_list.size(); i++) {
       if (i == 0) {
-        ir_model.get_start_node_list_list().push_back(node_list_list[i]);
+        ir_search.get_start_node_list_list().push_back(node_list_list[i]);
       } else {
-        ir_model.get_end_node_list_list().push_back(node_list_list[i]);
+        ir_search.get_end_node_list_list().push_back(node_list_list[i]);
       }
     }
   }
-  ir_model.get_path_node_list().clear();
-  ir_model.get_single_topo_visited_node_list().clear();
-  ir_model.get_routing_segment_list().clear();
+  ir_search.get_path_node_list().clear();
+  ir_search.get_single_topo_visited_node_list().clear();
+  ir_search.get_routing_segment_list().clear();
 }
 
-bool InitialRouter::isConnectedAllEnd(IRModel& ir_model)
+bool InitialRouter::isConnectedAllEnd(IRModel& ir_model, IRSearch& ir_search)
 {
-  return ir_model.get_end_node_list_list().empty();
+  return ir_search.get_end_node_list_list().empty();
 }
 
-void InitialRouter::routeSinglePath(IRModel& ir_model)
+void InitialRouter::routeSinglePath(IRModel& ir_model, IRSearch& ir_search)
 {
-  initPathHead(ir_model);
-  while (!searchEnded(ir_model)) {
-    expandSearching(ir_model);
-    resetPathHead(ir_model);
+  initPathHead(ir_model, ir_search);
+  while (!searchEnded(ir_model, ir_search)) {
+    expandSearching(ir_model, ir_search);
+    resetPathHead(ir_model, ir_search);
   }
 }
 
-void InitialRouter::initPathHead(IRModel& ir_model)
+void InitialRouter::initPathHead(IRModel& ir_model, IRSearch& ir_search)
 {
-  std::vector<std::vector<IRNode*>>& start_node_list_list = ir_model.get_start_node_list_list();
-  std::vector<IRNode*>& path_node_list = ir_model.get_path_node_list();
+  std::vector<std::vector<IRNode*>>& start_node_list_list = ir_search.get_start_node_list_list();
+  std::vector<IRNode*>& path_node_list = ir_search.get_path_node_list();
 
   for (std::vector<IRNode*>& start_node_list : start_node_list_list) {
     for (IRNode* start_node : start_node_list) {
-      start_node->set_estimated_cost(getEstimateCostToEnd(ir_model, start_node));
-      pushToOpenList(ir_model, start_node);
+      start_node->set_estimated_cost(getEstimateCostToEnd(ir_model, ir_search, start_node));
+      pushToOpenList(ir_model, ir_search, start_node);
     }
   }
   for (IRNode* path_node : path_node_list) {
-    path_node->set_estimated_cost(getEstimateCostToEnd(ir_model, path_node));
-    pushToOpenList(ir_model, path_node);
+    path_node->set_estimated_cost(getEstimateCostToEnd(ir_model, ir_search, path_node));
+    pushToOpenList(ir_model, ir_search, path_node);
   }
-  resetPathHead(ir_model);
+  resetPathHead(ir_model, ir_search);
 }
 
-bool InitialRouter::searchEnded(IRModel& ir_model)
+bool InitialRouter::searchEnded(IRModel& ir_model, IRSearch& ir_search)
 {
-  std::vector<std::vector<IRNode*>>& end_node_list_list = ir_model.get_end_node_list_list();
-  IRNode* path_head_node = ir_model.get_path_head_node();
+  std::vector<std::vector<IRNode*>>& end_node_list_list = ir_search.get_end_node_list_list();
+  IRNode* path_head_node = ir_search.get_path_head_node();
 
   if (path_head_node == nullptr) {
-    ir_model.set_end_node_list_idx(-1);
+    ir_search.set_end_node_list_idx(-1);
     return true;
   }
   for (size_t i = 0; i < end_node_list_list.size(); i++) {
     for (IRNode* end_node : end_node_list_list[i]) {
       if (path_head_node == end_node) {
-        ir_model.set_end_node_list_idx(static_cast<int32_t>(i));
+        ir_search.set_end_node_list_idx(static_cast<int32_t>(i));
         return true;
       }
     }
@@ -512,16 +588,16 @@ bool InitialRouter::searchEnded(IRModel& ir_model)
   return false;
 }
 
-void InitialRouter::expandSearching(IRModel& ir_model)
+void InitialRouter::expandSearching(IRModel& ir_model, IRSearch& ir_search)
 {
-  PriorityQueue<IRNode*, std::vector<IRNode*>, CmpIRNodeCost>& open_queue = ir_model.get_open_queue();
-  IRNode* path_head_node = ir_model.get_path_head_node();
+  PriorityQueue<IRNode*>& open_queue = ir_search.get_open_queue();
+  IRNode* path_head_node = ir_search.get_path_head_node();
 
   for (auto& [orientation, neighbor_node] : path_head_node->get_neighbor_node_map()) {
     if (neighbor_node == nullptr) {
       continue;
     }
-    if (!RTUTIL.isInside(ir_model.get_curr_ir_topo()->get_bounding_box(), *neighbor_node)) {
+    if (!RTUTIL.isInside(ir_search.get_curr_ir_topo()->get_bounding_box(), *neighbor_node)) {
       continue;
     }
     if (neighbor_node->isClose()) {
@@ -531,33 +607,33 @@ void InitialRouter::expandSearching(IRModel& ir_model)
     if (neighbor_node->isOpen() && know_cost < neighbor_node->get_known_cost()) {
       neighbor_node->set_known_cost(know_cost);
       neighbor_node->set_parent_node(path_head_node);
-      // 对优先队列中的值修改了，需要重新建堆
-      std::make_heap(open_queue.begin(), open_queue.end(), CmpIRNodeCost());
+      // 代价降低后重新入队，旧的入队记录在出队时跳过
+      open_queue.push(neighbor_node, neighbor_node->getTotalCost(), neighbor_node->get_estimated_cost(),
+                      neighbor_node->get_neighbor_node_map().size());
     } else if (neighbor_node->isNone()) {
       neighbor_node->set_known_cost(know_cost);
       neighbor_node->set_parent_node(path_head_node);
-      neighbor_node->set_estimated_cost(getEstimateCostToEnd(ir_model, neighbor_node));
-      pushToOpenList(ir_model, neighbor_node);
+      neighbor_node->set_estimated_cost(getEstimateCostToEnd(ir_model, ir_search, neighbor_node));
+      pushToOpenList(ir_model, ir_search, neighbor_node);
     }
   }
 }
 
-void InitialRouter::resetPathHead(IRModel& ir_model)
+void InitialRouter::resetPathHead(IRModel& ir_model, IRSearch& ir_search)
 {
-  ir_model.set_path_head_node(popFromOpenList(ir_model));
+  ir_search.set_path_head_node(popFromOpenList(ir_model, ir_search));
 }
 
-bool InitialRouter::isRoutingFailed(IRModel& ir_model)
+bool InitialRouter::isRoutingFailed(IRModel& ir_model, IRSearch& ir_search)
 {
-  return ir_model.get_end_node_list_idx() == -1;
+  return ir_search.get_end_node_list_idx() == -1;
 }
 
-void InitialRouter::resetSinglePath(IRModel& ir_model)
+void InitialRouter::resetSinglePath(IRModel& ir_model, IRSearch& ir_search)
 {
-  PriorityQueue<IRNode*, std::vector<IRNode*>, CmpIRNodeCost> empty_queue;
-  ir_model.set_open_queue(empty_queue);
+  ir_search.get_open_queue().clear();
 
-  std::vector<IRNode*>& single_path_visited_node_list = ir_model.get_single_path_visited_node_list();
+  std::vector<IRNode*>& single_path_visited_node_list = ir_search.get_single_path_visited_node_list();
   for (IRNode* visited_node : single_path_visited_node_list) {
     visited_node->set_state(IRNodeState::kNone);
     visited_node->set_parent_node(nullptr);
@@ -566,14 +642,14 @@ void InitialRouter::resetSinglePath(IRModel& ir_model)
   }
   single_path_visited_node_list.clear();
 
-  ir_model.set_path_head_node(nullptr);
-  ir_model.set_end_node_list_idx(-1);
+  ir_search.set_path_head_node(nullptr);
+  ir_search.set_end_node_list_idx(-1);
 }
 
-void InitialRouter::updatePathResult(IRModel& ir_model)
+void InitialRouter::updatePathResult(IRModel& ir_model, IRSearch& ir_search)
 {
-  for (Segment<LayerCoord>& routing_segment : getRoutingSegmentListByNode(ir_model.get_path_head_node())) {
-    ir_model.get_routing_segment_list().push_back(routing_segment);
+  for (Segment<LayerCoord>& routing_segment : getRoutingSegmentListByNode(ir_search.get_path_head_node())) {
+    ir_search.get_routing_segment_list().push_back(routing_segment);
   }
 }
 
@@ -603,9 +679,9 @@ std::vector<Segment<LayerCoord>> InitialRouter::getRoutingSegmentListByNode(IRNo
   return routing_segment_list;
 }
 
-void InitialRouter::updateDirectionSet(IRModel& ir_model)
+void InitialRouter::updateDirectionSet(IRModel& ir_model, IRSearch& ir_search)
 {
-  IRNode* path_head_node = ir_model.get_path_head_node();
+  IRNode* path_head_node = ir_search.get_path_head_node();
 
   IRNode* curr_node = path_head_node;
   IRNode* pre_node = curr_node->get_parent_node();
@@ -617,13 +693,13 @@ void InitialRouter::updateDirectionSet(IRModel& ir_model)
   }
 }
 
-void InitialRouter::resetStartAndEnd(IRModel& ir_model)
+void InitialRouter::resetStartAndEnd(IRModel& ir_model, IRSearch& ir_search)
 {
-  std::vector<std::vector<IRNode*>>& start_node_list_list = ir_model.get_start_node_list_list();
-  std::vector<std::vector<IRNode*>>& end_node_list_list = ir_model.get_end_node_list_list();
-  std::vector<IRNode*>& path_node_list = ir_model.get_path_node_list();
-  IRNode* path_head_node = ir_model.get_path_head_node();
-  int32_t end_node_list_idx = ir_model.get_end_node_list_idx();
+  std::vector<std::vector<IRNode*>>& start_node_list_list = ir_search.get_start_node_list_list();
+  std::vector<std::vector<IRNode*>>& end_node_list_list = ir_search.get_end_node_list_list();
+  std::vector<IRNode*>& path_node_list = ir_search.get_path_node_list();
+  IRNode* path_head_node = ir_search.get_path_head_node();
+  int32_t end_node_list_idx = ir_search.get_end_node_list_idx();
 
   // 对于抵达的终点pin，只保留到达的node
   end_node_list_list[end_node_list_idx].clear();
@@ -650,14 +726,14 @@ void InitialRouter::resetStartAndEnd(IRModel& ir_model)
   end_node_list_list.erase(end_node_list_list.begin() + end_node_list_idx);
 }
 
-void InitialRouter::updateTaskResult(IRModel& ir_model)
+void InitialRouter::updateTaskResult(IRModel& ir_model, IRSearch& ir_search)
 {
-  ir_model.get_curr_ir_topo()->set_routing_segment_list(getRoutingSegmentList(ir_model));
+  ir_search.get_curr_ir_topo()->set_routing_segment_list(getRoutingSegmentList(ir_model, ir_search));
 }
 
-std::vector<Segment<LayerCoord>> InitialRouter::getRoutingSegmentList(IRModel& ir_model)
+std::vector<Segment<LayerCoord>> InitialRouter::getRoutingSegmentList(IRModel& ir_model, IRSearch& ir_search)
 {
-  IRTopo* curr_ir_topo = ir_model.get_curr_ir_topo();
+  IRTopo* curr_ir_topo = ir_search.get_curr_ir_topo();
 
   std::vector<LayerCoord> candidate_root_coord_list;
   std::map<LayerCoord, std::set<int32_t>, CmpLayerCoordByXASC> key_coord_pin_map;
@@ -669,7 +745,7 @@ std::vector<Segment<LayerCoord>> InitialRouter::getRoutingSegmentList(IRModel& i
     }
   }
   MTree<LayerCoord> coord_tree
-      = RTUTIL.getTreeByFullFlow(candidate_root_coord_list, ir_model.get_routing_segment_list(), key_coord_pin_map);
+      = RTUTIL.getTreeByFullFlow(candidate_root_coord_list, ir_search.get_routing_segment_list(), key_coord_pin_map);
 
   std::vector<Segment<LayerCoord>> routing_segment_list;
   for (Segment<TNode<LayerCoord>*>& coord_segment : RTUTIL.getSegListByTree(coord_tree)) {
@@ -678,45 +754,51 @@ std::vector<Segment<LayerCoord>> InitialRouter::getRoutingSegmentList(IRModel& i
   return routing_segment_list;
 }
 
-void InitialRouter::resetSingleTask(IRModel& ir_model)
+void InitialRouter::resetSingleTask(IRModel& ir_model, IRSearch& ir_search)
 {
-  ir_model.set_curr_ir_topo(nullptr);
-  ir_model.get_start_node_list_list().clear();
-  ir_model.get_end_node_list_list().clear();
-  ir_model.get_path_node_list().clear();
+  ir_search.set_curr_ir_topo(nullptr);
+  ir_search.get_start_node_list_list().clear();
+  ir_search.get_end_node_list_list().clear();
+  ir_search.get_path_node_list().clear();
 
-  std::vector<IRNode*>& single_topo_visited_node_list = ir_model.get_single_topo_visited_node_list();
+  std::vector<IRNode*>& single_topo_visited_node_list = ir_search.get_single_topo_visited_node_list();
   for (IRNode* single_topo_visited_node : single_topo_visited_node_list) {
     single_topo_visited_node->get_direction_set().clear();
   }
   single_topo_visited_node_list.clear();
 
-  ir_model.get_routing_segment_list().clear();
+  ir_search.get_routing_segment_list().clear();
 }
 
 // manager open list
 
-void InitialRouter::pushToOpenList(IRModel& ir_model, IRNode* curr_node)
+void InitialRouter::pushToOpenList(IRModel& ir_model, IRSearch& ir_search, IRNode* curr_node)
 {
-  PriorityQueue<IRNode*, std::vector<IRNode*>, CmpIRNodeCost>& open_queue = ir_model.get_open_queue();
-  std::vector<IRNode*>& single_topo_visited_node_list = ir_model.get_single_topo_visited_node_list();
-  std::vector<IRNode*>& single_path_visited_node_list = ir_model.get_single_path_visited_node_list();
+  PriorityQueue<IRNode*>& open_queue = ir_search.get_open_queue();
+  std::vector<IRNode*>& single_topo_visited_node_list = ir_search.get_single_topo_visited_node_list();
+  std::vector<IRNode*>& single_path_visited_node_list = ir_search.get_single_path_visited_node_list();
 
-  open_queue.push(curr_node);
+  open_queue.push(curr_node, curr_node->getTotalCost(), curr_node->get_estimated_cost(), curr_node->get_neighbor_node_map().size());
   curr_node->set_state(IRNodeState::kOpen);
   single_topo_visited_node_list.push_back(curr_node);
   single_path_visited_node_list.push_back(curr_node);
 }
 
-IRNode* InitialRouter::popFromOpenList(IRModel& ir_model)
+IRNode* InitialRouter::popFromOpenList(IRModel& ir_model, IRSearch& ir_search)
 {
-  PriorityQueue<IRNode*, std::vector<IRNode*>, CmpIRNodeCost>& open_queue = ir_model.get_open_queue();
+  PriorityQueue<IRNode*>& open_queue = ir_search.get_open_queue();
 
   IRNode* node = nullptr;
-  if (!open_queue.empty()) {
+  while (!open_queue.empty()) {
     node = open_queue.top();
     open_queue.pop();
+    if (node->isClose()) {
+      // 代价降低时重复入队的旧记录
+      node = nullptr;
+      continue;
+    }
     node->set_state(IRNodeState::kClose);
+    break;
   }
   return node;
 }
@@ -810,9 +892,9 @@ double InitialRouter::getKnowViaCost(IRModel& ir_model, IRNode* start_node, IRNo
 
 // calculate estimate cost
 
-double InitialRouter::getEstimateCostToEnd(IRModel& ir_model, IRNode* curr_node)
+double InitialRouter::getEstimateCostToEnd(IRModel& ir_model, IRSearch& ir_search, IRNode* curr_node)
 {
-  std::vector<std::vector<IRNode*>>& end_node_list_list = ir_model.get_end_node_list_list();
+  std::vector<std::vector<IRNode*>>& end_node_list_list = ir_search.get_end_node_list_list();
 
   double estimate_cost = DBL_MAX;
   for (std::vector<IRNode*>& end_node_list : end_node_list_list) {
@@ -980,8 +1062,8 @@ void InitialRouter::updateSummary(IRModel& ir_model)
     GridMap<IRNode>& ir_node_map = layer_node_map[layer_idx];
     for (int32_t x = 0; x < ir_node_map.get_x_size(); x++) {
       for (int32_t y = 0; y < ir_node_map.get_y_size(); y++) {
-        std::map<Orientation, int32_t>& orient_supply_map = ir_node_map[x][y].get_orient_supply_map();
-        std::map<Orientation, int32_t>& orient_demand_map = ir_node_map[x][y].get_orient_demand_map();
+        OrientArray<int32_t>& orient_supply_map = ir_node_map[x][y].get_orient_supply_map();
+        OrientArray<int32_t>& orient_demand_map = ir_node_map[x][y].get_orient_demand_map();
         int32_t node_demand = 0;
         int32_t node_overflow = 0;
         if (routing_layer_list[layer_idx].isPreferH()) {
@@ -1121,7 +1203,7 @@ void InitialRouter::writeDemandCSV(IRModel& ir_model)
     GridMap<IRNode>& ir_node_map = layer_node_map[routing_layer.get_layer_idx()];
     for (int32_t y = ir_node_map.get_y_size() - 1; y >= 0; y--) {
       for (int32_t x = 0; x < ir_node_map.get_x_size(); x++) {
-        std::map<Orientation, int32_t>& orient_demand_map = ir_node_map[x][y].get_orient_demand_map();
+        OrientArray<int32_t>& orient_demand_map = ir_node_map[x][y].get_orient_demand_map();
         int32_t total_demand = 0;
         if (routing_layer.isPreferH()) {
           total_demand = (orient_demand_map[Orientation::kEast] + orient_demand_map[Orientation::kWest]);
@@ -1152,8 +1234,8 @@ void InitialRouter::writeOverflowCSV(IRModel& ir_model)
     GridMap<IRNode>& ir_node_map = layer_node_map[routing_layer.get_layer_idx()];
     for (int32_t y = ir_node_map.get_y_size() - 1; y >= 0; y--) {
       for (int32_t x = 0; x < ir_node_map.get_x_size(); x++) {
-        std::map<Orientation, int32_t>& orient_supply_map = ir_node_map[x][y].get_orient_supply_map();
-        std::map<Orientation, int32_t>& orient_demand_map = ir_node_map[x][y].get_orient_demand_map();
+        OrientArray<int32_t>& orient_supply_map = ir_node_map[x][y].get_orient_supply_map();
+        OrientArray<int32_t>& orient_demand_map = ir_node_map[x][y].get_orient_demand_map();
         int32_t total_overflow = 0;
         if (routing_layer.isPreferH()) {
           total_overflow = std::max(0, orient_demand_map[Orientation::kEast] - orient_supply_map[Orientation::kEast])
@@ -1182,8 +1264,11 @@ void InitialRouter::debugCheckIRModel(IRModel& ir_model)
       for (int32_t y = 0; y < ir_node_map.get_y_size(); y++) {
         IRNode& ir_node = ir_node_map[x][y];
         for (auto& [orient, neighbor] : ir_node.get_neighbor_node_map()) {
+          if (neighbor == nullptr) {
+            continue;
+          }
           Orientation opposite_orient = RTUTIL.getOppositeOrientation(orient);
-          if (!RTUTIL.exist(neighbor->get_neighbor_node_map(), opposite_orient)) {
+          if (neighbor->getNeighborNode(opposite_orient) == nullptr) {
             RTLOG.error(Loc::current(), "The ir_node neighbor is not bidirectional!");
           }
           if (neighbor->get_neighbor_node_map()[opposite_orient] != &ir_node) {
@@ -56,35 +56,37 @@ class InitialRouter
   void buildIRNodeNeighbor(IRModel& ir_model);
   void buildOrientSupply(IRModel& ir_model);
   void buildTopoTree(IRModel& ir_model);
+  void buildTaskSchedule(IRModel& ir_model);
+  PlanarRect getRoutingRect(IRNet* ir_net);
   void routeIRModel(IRModel& ir_model);
-  void routeIRNet(IRModel& ir_model, IRNet* ir_net);
+  MTree<LayerCoord> routeIRNet(IRModel& ir_model, IRNet* ir_net);
   void makeIRTopoList(IRModel& ir_model, IRNet* ir_net, std::vector<IRTopo>& ir_topo_list,
                       std::vector<Segment<LayerCoord>>& routing_segment_list);
-  void routeIRTopo(IRModel& ir_model, IRTopo* ir_topo);
-  void initSingleTask(IRModel& ir_model, IRTopo* ir_topo);
-  bool isConnectedAllEnd(IRModel& ir_model);
-  void routeSinglePath(IRModel& ir_model);
-  void initPathHead(IRModel& ir_model);
-  bool searchEnded(IRModel& ir_model);
-  void expandSearching(IRModel& ir_model);
-  void resetPathHead(IRModel& ir_model);
-  bool isRoutingFailed(IRModel& ir_model);
-  void resetSinglePath(IRModel& ir_model);
-  void updatePathResult(IRModel& ir_model);
+  void routeIRTopo(IRModel& ir_model, IRSearch& ir_search, IRTopo* ir_topo);
+  void initSingleTask(IRModel& ir_model, IRSearch& ir_search, IRTopo* ir_topo);
+  bool isConnectedAllEnd(IRModel& ir_model, IRSearch& ir_search);
+  void routeSinglePath(IRModel& ir_model, IRSearch& ir_search);
+  void initPathHead(IRModel& ir_model, IRSearch& ir_search);
+  bool searchEnded(IRModel& ir_model, IRSearch& ir_search);
+  void expandSearching(IRModel& ir_model, IRSearch& ir_search);
+  void resetPathHead(IRModel& ir_model, IRSearch& ir_search);
+  bool isRoutingFailed(IRModel& ir_model, IRSearch& ir_search);
+  void resetSinglePath(IRModel& ir_model, IRSearch& ir_search);
+  void updatePathResult(IRModel& ir_model, IRSearch& ir_search);
   std::vector<Segment<LayerCoord>> getRoutingSegmentListByNode(IRNode* node);
-  void updateDirectionSet(IRModel& ir_model);
-  void resetStartAndEnd(IRModel& ir_model);
-  void updateTaskResult(IRModel& ir_model);
-  std::vector<Segment<LayerCoord>> getRoutingSegmentList(IRModel& ir_model);
-  void resetSingleTask(IRModel& ir_model);
-  void pushToOpenList(IRModel& ir_model, IRNode* curr_node);
-  IRNode* popFromOpenList(IRModel& ir_model);
+  void updateDirectionSet(IRModel& ir_model, IRSearch& ir_search);
+  void resetStartAndEnd(IRModel& ir_model, IRSearch& ir_search);
+  void updateTaskResult(IRModel& ir_model, IRSearch& ir_search);
+  std::vector<Segment<LayerCoord>> getRoutingSegmentList(IRModel& ir_model, IRSearch& ir_search);
+  void resetSingleTask(IRModel& ir_model, IRSearch& ir_search);
+  void pushToOpenList(IRModel& ir_model, IRSearch& ir_search, IRNode* curr_node);
+  IRNode* popFromOpenList(IRModel& ir_model, IRSearch& ir_search);
   double getKnowCost(IRModel& ir_model, IRNode* start_node, IRNode* end_node);
   double getNodeCost(IRModel& ir_model, IRNode* curr_node, Orientation orientation);
   double getKnowWireCost(IRModel& ir_model, IRNode* start_node, IRNode* end_node);
   double getKnowCornerCost(IRModel& ir_model, IRNode* start_node, IRNode* end_node);
   double getKnowViaCost(IRModel& ir_model, IRNode* start_node, IRNode* end_node);
-  double getEstimateCostToEnd(IRModel& ir_model, IRNode* curr_node);
+  double getEstimateCostToEnd(IRModel& ir_model, IRSearch& ir_search, IRNode* curr_node);
   double getEstimateCost(IRModel& ir_model, IRNode* start_node, IRNode* end_node);
   double getEstimateWireCost(IRModel& ir_model, IRNode* start_node, IRNode* end_node);
   double getEstimateCornerCost(IRModel& ir_model, IRNode* start_node, IRNode* end_node);
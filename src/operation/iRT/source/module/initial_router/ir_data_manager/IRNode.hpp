@@ -18,6 +18,7 @@
 
 #include "Direction.hpp"
 #include "LayerCoord.hpp"
+#include "OrientArray.hpp"
 #include "Orientation.hpp"
 #include "RTHeader.hpp"
 #include "Utility.hpp"
@@ -39,34 +40,21 @@ class IRNode : public LayerCoord
   IRNode() = default;
   ~IRNode() = default;
   // getter
-  std::map<Orientation, IRNode*>& get_neighbor_node_map() { return _neighbor_node_map; }
-  std::map<Orientation, int32_t>& get_orient_supply_map() { return _orient_supply_map; }
-  std::map<Orientation, int32_t>& get_orient_demand_map() { return _orient_demand_map; }
+  OrientArray<IRNode*>& get_neighbor_node_map() { return _neighbor_node_map; }
+  OrientArray<int32_t>& get_orient_supply_map() { return _orient_supply_map; }
+  OrientArray<int32_t>& get_orient_demand_map() { return _orient_demand_map; }
   // setter
-  void set_neighbor_node_map(const std::map<Orientation, IRNode*>& neighbor_node_map) { _neighbor_node_map = neighbor_node_map; }
-  void set_orient_supply_map(const std::map<Orientation, int32_t>& orient_supply_map) { _orient_supply_map = orient_supply_map; }
-  void set_orient_demand_map(const std::map<Orientation, int32_t>& orient_demand_map) { _orient_demand_map = orient_demand_map; }
+  void set_neighbor_node_map(const OrientArray<IRNode*>& neighbor_node_map) { _neighbor_node_map = neighbor_node_map; }
+  void set_orient_supply_map(const OrientArray<int32_t>& orient_supply_map) { _orient_supply_map = orient_supply_map; }
+  void set_orient_demand_map(const OrientArray<int32_t>& orient_demand_map) { _orient_demand_map = orient_demand_map; }
   // function
-  IRNode* getNeighborNode(Orientation orientation)
-  {
-    IRNode* neighbor_node = nullptr;
-    if (RTUTIL.exist(_neighbor_node_map, orientation)) {
-      neighbor_node = _neighbor_node_map[orientation];
-    }
-    return neighbor_node;
-  }
+  IRNode* getNeighborNode(Orientation orientation) { return _neighbor_node_map.get(orientation); }
   double getCongestionCost(Orientation orientation)
   {
     double cost = 0;
     if (orientation != Orientation::kAbove && orientation != Orientation::kBelow) {
-      int32_t node_demand = 0;
-      if (RTUTIL.exist(_orient_demand_map, orientation)) {
-        node_demand = _orient_demand_map[orientation];
-      }
-      int32_t node_supply = 0;
-      if (RTUTIL.exist(_orient_supply_map, orientation)) {
-        node_supply = _orient_supply_map[orientation];
-      }
+      int32_t node_demand = _orient_demand_map.get(orientation);
+      int32_t node_supply = _orient_supply_map.get(orientation);
       cost += calcCost(node_demand + 1, node_supply);
     }
     return cost;
@@ -112,9 +100,9 @@ class IRNode : public LayerCoord
 #endif
 
  private:
-  std::map<Orientation, IRNode*> _neighbor_node_map;
-  std::map<Orientation, int32_t> _orient_supply_map;
-  std::map<Orientation, int32_t> _orient_demand_map;
+  OrientArray<IRNode*> _neighbor_node_map;
+  OrientArray<int32_t> _orient_supply_map;
+  OrientArray<int32_t> _orient_demand_map;
 #if 1  // astar
   // single task
   std::set<Direction> _direction_set;
@@ -126,22 +114,4 @@ class IRNode : public LayerCoord
 #endif
 };
 
-#if 1  // astar
-struct CmpIRNodeCost
-{
-  bool operator()(IRNode* a, IRNode* b)
-  {
-    if (RTUTIL.equalDoubleByError(a->getTotalCost(), b->getTotalCost(), RT_ERROR)) {
-      if (RTUTIL.equalDoubleByError(a->get_estimated_cost(), b->get_estimated_cost(), RT_ERROR)) {
-        return a->get_neighbor_node_map().size() < b->get_neighbor_node_map().size();
-      } else {
-        return a->get_estimated_cost() > b->get_estimated_cost();
-      }
-    } else {
-      return a->getTotalCost() > b->getTotalCost();
-    }
-  }
-};
-#endif
-
 }  // namespace irt
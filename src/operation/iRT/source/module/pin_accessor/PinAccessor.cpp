@@ -117,48 +117,181 @@ void PinAccessor::initAccessPointList(PAModel& pa_model)
       net_pin_pair_list.emplace_back(pa_net.get_net_idx(), &pa_pin);
     }
   }
+  int32_t pin_num = static_cast<int32_t>(net_pin_pair_list.size());
+  // 同一master同一朝向的inst上pin形状相同，以pin原点为基准的相对形状作为pattern
+  std::vector<PlanarCoord> origin_list(pin_num);
+  std::vector<int32_t> pattern_idx_list(pin_num, -1);
+  std::vector<std::vector<LayerRect>> pattern_shape_list_list;
+  {
+    std::vector<std::vector<LayerRect>> relative_shape_list_list(pin_num);
+#pragma omp parallel for
+    for (int32_t i = 0; i < pin_num; i++) {
+      origin_list[i] = getPinOrigin(net_pin_pair_list[i].second);
+      relative_shape_list_list[i] = getRelativeShapeList(net_pin_pair_list[i].second, origin_list[i]);
+    }
+    struct CmpShapeList
+    {
+      bool operator()(const std::vector<LayerRect>& a, const std::vector<LayerRect>& b) const
+      {
+        return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end(), CmpLayerRectByXASC());
+      }
+    };
+    std::map<std::vector<LayerRect>, int32_t, CmpShapeList> shape_list_pattern_idx_map;
+    for (int32_t i = 0; i < pin_num; i++) {
+      auto [iter, is_new] = shape_list_pattern_idx_map.emplace(relative_shape_list_list[i], pattern_shape_list_list.size());
+      if (is_new) {
+        pattern_shape_list_list.push_back(relative_shape_list_list[i]);
+      }
+      pattern_idx_list[i] = iter->second;
+    }
+  }
+  // 每个pattern只计算一次缩小后的形状与无障碍时的合法形状
+  int32_t pattern_num = static_cast<int32_t>(pattern_shape_list_list.size());
+  std::vector<std::map<int32_t, std::vector<PlanarRect>>> pattern_layer_reduced_rect_map_list(pattern_num);
+  std::vector<std::vector<LayerRect>> pattern_legal_shape_list_list(pattern_num);
 #pragma omp parallel for
-  for (std::pair<int32_t, PAPin*>& net_pin_pair : net_pin_pair_list) {
-    PAPin* pin = net_pin_pair.second;
-    std::vector<AccessPoint>& access_point_list = net_pin_pair.second->get_access_point_list();
-    std::vector<LayerRect> legal_shape_list = getLegalShapeList(pa_model, net_pin_pair.first, pin);
-    for (auto getAccessPointList :
-         {std::bind(&PinAccessor::getAccessPointListByTrackGrid, this, std::placeholders::_1, std::placeholders::_2),
-          std::bind(&PinAccessor::getAccessPointListByOnTrack, this, std::placeholders::_1, std::placeholders::_2),
-          std::bind(&PinAccessor::getAccessPointListByShapeCenter, this, std::placeholders::_1, std::placeholders::_2)}) {
-      for (AccessPoint& access_point : getAccessPointList(pin->get_pin_idx(), legal_shape_list)) {
-        access_point_list.push_back(access_point);
+  for (int32_t i = 0; i < pattern_num; i++) {
+    pattern_layer_reduced_rect_map_list[i] = getLayerReducedRectMap(pattern_shape_list_list[i]);
+    for (auto& [layer_idx, reduced_rect_list] : pattern_layer_reduced_rect_map_list[i]) {
+      for (PlanarRect& merged_rect : getMergedRectList(layer_idx, reduced_rect_list)) {
+        pattern_legal_shape_list_list[i].emplace_back(merged_rect, layer_idx);
       }
-      if (!access_point_list.empty()) {
-        std::sort(access_point_list.begin(), access_point_list.end(),
-                  [](AccessPoint& a, AccessPoint& b) { return CmpLayerCoordByXASC()(a.getRealLayerCoord(), b.getRealLayerCoord()); });
-        break;
+    }
+  }
+  // 被障碍剪裁过的pin需要单独生成ap，未被剪裁的pin按(pattern, track偏移)复用ap
+  std::vector<std::vector<LayerRect>> legal_shape_list_list(pin_num);
+  std::vector<std::vector<int32_t>> track_offset_list_list(pin_num);
+#pragma omp parallel for
+  for (int32_t i = 0; i < pin_num; i++) {
+    PlanarCoord& origin = origin_list[i];
+    int32_t pattern_idx = pattern_idx_list[i];
+    std::map<int32_t, std::vector<PlanarRect>> layer_reduced_rect_map = pattern_layer_reduced_rect_map_list[pattern_idx];
+    for (auto& [layer_idx, reduced_rect_list] : layer_reduced_rect_map) {
+      for (PlanarRect& reduced_rect : reduced_rect_list) {
+        reduced_rect = RTUTIL.getOffsetRect(reduced_rect, origin);
       }
     }
-    if (access_point_list.empty()) {
-      RTLOG.error(Loc::current(), "No access point was generated!");
+    legal_shape_list_list[i] = getLegalShapeList(pa_model, net_pin_pair_list[i].first, net_pin_pair_list[i].second, layer_reduced_rect_map);
+
+    std::vector<LayerRect> uncut_shape_list = pattern_legal_shape_list_list[pattern_idx];
+    for (LayerRect& uncut_shape : uncut_shape_list) {
+      uncut_shape.set_rect(RTUTIL.getOffsetRect(uncut_shape, origin));
+    }
+    if (!uncut_shape_list.empty() && uncut_shape_list == legal_shape_list_list[i]) {
+      track_offset_list_list[i] = getTrackOffsetList(legal_shape_list_list[i], origin);
     }
   }
+  std::vector<int32_t> source_idx_list(pin_num, -1);
+  {
+    std::map<std::pair<int32_t, std::vector<int32_t>>, int32_t> pattern_offset_source_idx_map;
+    for (int32_t i = 0; i < pin_num; i++) {
+      if (track_offset_list_list[i].empty()) {
+        continue;
+      }
+      auto [iter, is_new] = pattern_offset_source_idx_map.emplace(std::make_pair(pattern_idx_list[i], track_offset_list_list[i]), i);
+      if (!is_new) {
+        source_idx_list[i] = iter->second;
+      }
+    }
+  }
+#pragma omp parallel for
+  for (int32_t i = 0; i < pin_num; i++) {
+    if (source_idx_list[i] != -1) {
+      continue;
+    }
+    PAPin* pin = net_pin_pair_list[i].second;
+    pin->set_access_point_list(getAccessPointList(pin->get_pin_idx(), legal_shape_list_list[i]));
+  }
+#pragma omp parallel for
+  for (int32_t i = 0; i < pin_num; i++) {
+    int32_t source_idx = source_idx_list[i];
+    if (source_idx == -1) {
+      continue;
+    }
+    PAPin* pin = net_pin_pair_list[i].second;
+    PlanarCoord& origin = origin_list[i];
+    PlanarCoord& source_origin = origin_list[source_idx];
+    std::vector<AccessPoint>& access_point_list = pin->get_access_point_list();
+    for (AccessPoint& source_access_point : net_pin_pair_list[source_idx].second->get_access_point_list()) {
+      PlanarCoord& source_coord = source_access_point.get_real_coord();
+      LayerCoord layer_coord(source_coord.get_x() - source_origin.get_x() + origin.get_x(),
+                             source_coord.get_y() - source_origin.get_y() + origin.get_y(), source_access_point.get_layer_idx());
+      access_point_list.emplace_back(pin->get_pin_idx(), layer_coord, source_access_point.get_type());
+    }
+  }
+  int32_t reused_pin_num = 0;
+  for (int32_t source_idx : source_idx_list) {
+    if (source_idx != -1) {
+      reused_pin_num++;
+    }
+  }
+  RTLOG.info(Loc::current(), "The pin pattern num is ", pattern_num, ", the access point of ", reused_pin_num, "/", pin_num, "(",
+             RTUTIL.getPercentage(reused_pin_num, pin_num), ") pins is reused");
   RTLOG.info(Loc::current(), "Completed", monitor.getStatsInfo());
 }
 
-std::vector<LayerRect> PinAccessor::getLegalShapeList(PAModel& pa_model, int32_t net_idx, Pin* pin)
+PlanarCoord PinAccessor::getPinOrigin(Pin* pin)
 {
-  std::vector<RoutingLayer>& routing_layer_list = RTDM.getDatabase().get_routing_layer_list();
-  std::map<int32_t, std::vector<EXTLayerRect>> layer_pin_shape_list;
+  if (pin->get_routing_shape_list().empty()) {
+    return PlanarCoord(0, 0);
+  }
+  int32_t origin_x = INT32_MAX;
+  int32_t origin_y = INT32_MAX;
+  for (EXTLayerRect& routing_shape : pin->get_routing_shape_list()) {
+    origin_x = std::min(origin_x, routing_shape.get_real_ll_x());
+    origin_y = std::min(origin_y, routing_shape.get_real_ll_y());
+  }
+  return PlanarCoord(origin_x, origin_y);
+}
+
+std::vector<LayerRect> PinAccessor::getRelativeShapeList(Pin* pin, PlanarCoord& origin)
+{
+  PlanarCoord offset(-origin.get_x(), -origin.get_y());
+
+  std::vector<LayerRect> relative_shape_list;
   for (EXTLayerRect& routing_shape : pin->get_routing_shape_list()) {
-    layer_pin_shape_list[routing_shape.get_layer_idx()].emplace_back(routing_shape);
+    relative_shape_list.emplace_back(RTUTIL.getOffsetRect(routing_shape.get_real_rect(), offset), routing_shape.get_layer_idx());
   }
+  std::sort(relative_shape_list.begin(), relative_shape_list.end(), CmpLayerRectByXASC());
+  relative_shape_list.erase(std::unique(relative_shape_list.begin(), relative_shape_list.end()), relative_shape_list.end());
+  return relative_shape_list;
+}
+
+std::map<int32_t, std::vector<PlanarRect>> PinAccessor::getLayerReducedRectMap(std::vector<LayerRect>& shape_list)
+{
+  std::vector<RoutingLayer>& routing_layer_list = RTDM.getDatabase().get_routing_layer_list();
+
+  std::map<int32_t, std::vector<PlanarRect>> layer_shape_map;
+  for (LayerRect& shape : shape_list) {
+    layer_shape_map[shape.get_layer_idx()].push_back(shape.get_rect());
+  }
+  std::map<int32_t, std::vector<PlanarRect>> layer_reduced_rect_map;
+  for (auto& [layer_idx, planar_shape_list] : layer_shape_map) {
+    int32_t reduced_size = routing_layer_list[layer_idx].get_min_width() / 2;
+    layer_reduced_rect_map[layer_idx] = RTUTIL.getClosedReducedRectListByBoost(planar_shape_list, reduced_size);
+  }
+  return layer_reduced_rect_map;
+}
+
+std::vector<PlanarRect> PinAccessor::getMergedRectList(int32_t layer_idx, std::vector<PlanarRect>& rect_list)
+{
+  std::vector<RoutingLayer>& routing_layer_list = RTDM.getDatabase().get_routing_layer_list();
+
+  // 对legal rect进行融合，prefer横就竖着切，prefer竖就横着切
+  if (routing_layer_list[layer_idx].isPreferH()) {
+    return RTUTIL.mergeRectListByBoost(rect_list, Direction::kVertical);
+  } else {
+    return RTUTIL.mergeRectListByBoost(rect_list, Direction::kHorizontal);
+  }
+}
+
+std::vector<LayerRect> PinAccessor::getLegalShapeList(PAModel& pa_model, int32_t net_idx, Pin* pin,
+                                                      std::map<int32_t, std::vector<PlanarRect>>& layer_reduced_rect_map)
+{
   std::vector<LayerRect> legal_rect_list;
-  for (auto& [layer_idx, pin_shape_list] : layer_pin_shape_list) {
-    std::vector<PlanarRect> planar_legal_rect_list = getPlanarLegalRectList(pa_model, net_idx, pin_shape_list);
-    // 对legal rect进行融合，prefer横就竖着切，prefer竖就横着切
-    if (routing_layer_list[layer_idx].isPreferH()) {
-      planar_legal_rect_list = RTUTIL.mergeRectListByBoost(planar_legal_rect_list, Direction::kVertical);
-    } else {
-      planar_legal_rect_list = RTUTIL.mergeRectListByBoost(planar_legal_rect_list, Direction::kHorizontal);
-    }
-    for (PlanarRect planar_legal_rect : planar_legal_rect_list) {
+  for (auto& [layer_idx, reduced_rect_list] : layer_reduced_rect_map) {
+    std::vector<PlanarRect> planar_legal_rect_list = getPlanarLegalRectList(pa_model, net_idx, layer_idx, reduced_rect_list);
+    for (PlanarRect& planar_legal_rect : getMergedRectList(layer_idx, planar_legal_rect_list)) {
       legal_rect_list.emplace_back(planar_legal_rect, layer_idx);
     }
   }
@@ -172,37 +305,21 @@ std::vector<LayerRect> PinAccessor::getLegalShapeList(PAModel& pa_model, int32_t
   return legal_rect_list;
 }
 
-std::vector<PlanarRect> PinAccessor::getPlanarLegalRectList(PAModel& pa_model, int32_t curr_net_idx,
-                                                            std::vector<EXTLayerRect>& pin_shape_list)
+std::vector<PlanarRect> PinAccessor::getPlanarLegalRectList(PAModel& pa_model, int32_t curr_net_idx, int32_t curr_layer_idx,
+                                                            std::vector<PlanarRect>& reduced_real_rect_list)
 {
   ScaleAxis& gcell_axis = RTDM.getDatabase().get_gcell_axis();
   std::vector<RoutingLayer>& routing_layer_list = RTDM.getDatabase().get_routing_layer_list();
   std::map<int32_t, PlanarRect>& layer_enclosure_map = RTDM.getDatabase().get_layer_enclosure_map();
 
-  int32_t curr_layer_idx;
-  {
-    for (EXTLayerRect& pin_shape : pin_shape_list) {
-      if (pin_shape_list.front().get_layer_idx() != pin_shape.get_layer_idx()) {
-        RTLOG.error(Loc::current(), "The pin_shape_list is not on the same layer!");
-      }
-    }
-    curr_layer_idx = pin_shape_list.front().get_layer_idx();
-  }
   // 当前层缩小后的结果
   std::vector<EXTLayerRect> reduced_rect_list;
-  {
-    std::vector<PlanarRect> origin_pin_shape_list;
-    for (EXTLayerRect& pin_shape : pin_shape_list) {
-      origin_pin_shape_list.push_back(pin_shape.get_real_rect());
-    }
-    int32_t reduced_size = routing_layer_list[curr_layer_idx].get_min_width() / 2;
-    for (PlanarRect& real_rect : RTUTIL.getClosedReducedRectListByBoost(origin_pin_shape_list, reduced_size)) {
-      EXTLayerRect reduced_rect;
-      reduced_rect.set_real_rect(real_rect);
-      reduced_rect.set_grid_rect(RTUTIL.getClosedGCellGridRect(reduced_rect.get_real_rect(), gcell_axis));
-      reduced_rect.set_layer_idx(curr_layer_idx);
-      reduced_rect_list.push_back(reduced_rect);
-    }
+  for (PlanarRect& real_rect : reduced_real_rect_list) {
+    EXTLayerRect reduced_rect;
+    reduced_rect.set_real_rect(real_rect);
+    reduced_rect.set_grid_rect(RTUTIL.getClosedGCellGridRect(reduced_rect.get_real_rect(), gcell_axis));
+    reduced_rect.set_layer_idx(curr_layer_idx);
+    reduced_rect_list.push_back(reduced_rect);
   }
   // 要被剪裁的obstacle的集合 排序按照 本层 上层
   /**
@@ -270,6 +387,68 @@ std::vector<PlanarRect> PinAccessor::getPlanarLegalRectList(PAModel& pa_model, i
   return legal_rect_list;
 }
 
+std::vector<AccessPoint> PinAccessor::getAccessPointList(int32_t pin_idx, std::vector<LayerRect>& legal_shape_list)
+{
+  std::vector<AccessPoint> access_point_list;
+  for (auto getAccessPointList :
+       {std::bind(&PinAccessor::getAccessPointListByTrackGrid, this, std::placeholders::_1, std::placeholders::_2),
+        std::bind(&PinAccessor::getAccessPointListByOnTrack, this, std::placeholders::_1, std::placeholders::_2),
+        std::bind(&PinAccessor::getAccessPointListByShapeCenter, this, std::placeholders::_1, std::placeholders::_2)}) {
+    for (AccessPoint& access_point : getAccessPointList(pin_idx, legal_shape_list)) {
+      access_point_list.push_back(access_point);
+    }
+    if (!access_point_list.empty()) {
+      std::sort(access_point_list.begin(), access_point_list.end(),
+                [](AccessPoint& a, AccessPoint& b) { return CmpLayerCoordByXASC()(a.getRealLayerCoord(), b.getRealLayerCoord()); });
+      break;
+    }
+  }
+  if (access_point_list.empty()) {
+    RTLOG.error(Loc::current(), "No access point was generated!");
+  }
+  return access_point_list;
+}
+
+std::vector<int32_t> PinAccessor::getTrackOffsetList(std::vector<LayerRect>& legal_shape_list, PlanarCoord& origin)
+{
+  std::vector<RoutingLayer>& routing_layer_list = RTDM.getDatabase().get_routing_layer_list();
+
+  // 只有在单一等距track内时，ap随pin平移，返回各层track相对原点的偏移；否则返回空表示不可复用
+  std::map<int32_t, std::pair<int32_t, int32_t>> layer_offset_map;
+  for (LayerRect& legal_shape : legal_shape_list) {
+    if (legal_shape.get_ll_x() < 0 || legal_shape.get_ll_y() < 0) {
+      return {};
+    }
+    RoutingLayer& routing_layer = routing_layer_list[legal_shape.get_layer_idx()];
+    std::vector<ScaleGrid>& x_track_grid_list = routing_layer.getXTrackGridList();
+    std::vector<ScaleGrid>& y_track_grid_list = routing_layer.getYTrackGridList();
+    if (x_track_grid_list.size() != 1 || y_track_grid_list.size() != 1) {
+      return {};
+    }
+    ScaleGrid& x_track_grid = x_track_grid_list.front();
+    ScaleGrid& y_track_grid = y_track_grid_list.front();
+    if (x_track_grid.get_step_length() <= 0 || y_track_grid.get_step_length() <= 0) {
+      return {};
+    }
+    if (legal_shape.get_ll_x() < x_track_grid.get_start_line() || x_track_grid.get_end_line() < legal_shape.get_ur_x()
+        || legal_shape.get_ll_y() < y_track_grid.get_start_line() || y_track_grid.get_end_line() < legal_shape.get_ur_y()) {
+      return {};
+    }
+    int32_t x_step_length = x_track_grid.get_step_length();
+    int32_t y_step_length = y_track_grid.get_step_length();
+    int32_t x_offset = ((origin.get_x() - x_track_grid.get_start_line()) % x_step_length + x_step_length) % x_step_length;
+    int32_t y_offset = ((origin.get_y() - y_track_grid.get_start_line()) % y_step_length + y_step_length) % y_step_length;
+    layer_offset_map[legal_shape.get_layer_idx()] = std::make_pair(x_offset, y_offset);
+  }
+  std::vector<int32_t> track_offset_list;
+  for (auto& [layer_idx, offset_pair] : layer_offset_map) {
+    track_offset_list.push_back(layer_idx);
+    track_offset_list.push_back(offset_pair.first);
+    track_offset_list.push_back(offset_pair.second);
+  }
+  return track_offset_list;
+}
+
 std::vector<AccessPoint> PinAccessor::getAccessPointListByTrackGrid(int32_t pin_idx, std::vector<LayerRect>& legal_shape_list)
 {
   std::vector<RoutingLayer>& routing_layer_list = RTDM.getDatabase().get_routing_layer_list();
@@ -399,6 +578,8 @@ void PinAccessor::buildConflictGroupList(PAModel& pa_model)
   for (auto& [curr_pin, conflict_pin_set] : getPinConlictMap(pa_model)) {
     pin_conflict_map[curr_pin] = conflict_pin_set;
   }
+  // 按连通分量划分group，group之间互不影响
+  std::vector<std::pair<std::map<PAPin*, int32_t>, std::vector<std::pair<PAPin*, PAPin*>>>> pin_idx_conflict_list;
   for (auto& [curr_pin, conflict_pin_set] : pin_conflict_map) {
     if (conflict_pin_set.empty()) {
       continue;
@@ -421,7 +602,15 @@ void PinAccessor::buildConflictGroupList(PAModel& pa_model)
       }
       conflict_pin_set.clear();
     }
-    ConflictGroup conflict_group;
+    pin_idx_conflict_list.emplace_back(pin_idx_map, conflict_list);
+  }
+  conflict_group_list.resize(pin_idx_conflict_list.size());
+#pragma omp parallel for
+  for (size_t i = 0; i < pin_idx_conflict_list.size(); i++) {
+    std::map<PAPin*, int32_t>& pin_idx_map = pin_idx_conflict_list[i].first;
+    std::vector<std::pair<PAPin*, PAPin*>>& conflict_list = pin_idx_conflict_list[i].second;
+
+    ConflictGroup& conflict_group = conflict_group_list[i];
     std::vector<std::vector<ConflictAccessPoint>>& conflict_ap_list_list = conflict_group.get_conflict_ap_list_list();
     conflict_ap_list_list.resize(pin_idx_map.size());
     for (auto& [pa_pin, conflict_ap_list_idx] : pin_idx_map) {
@@ -439,7 +628,6 @@ void PinAccessor::buildConflictGroupList(PAModel& pa_model)
     for (std::pair<PAPin*, PAPin*>& conflict_pair : conflict_list) {
       conflict_map[pin_idx_map[conflict_pair.first]].push_back(pin_idx_map[conflict_pair.second]);
     }
-    conflict_group_list.push_back(conflict_group);
   }
   RTLOG.info(Loc::current(), "Completed", monitor.getStatsInfo());
 }
@@ -538,6 +726,8 @@ void PinAccessor::eliminateConflict(PAModel& pa_model)
   Monitor monitor;
   RTLOG.info(Loc::current(), "Starting...");
 
+  // 每个pin只属于一个group，group之间并行求解
+#pragma omp parallel for
   for (ConflictGroup& conflict_group : pa_model.get_conflict_group_list()) {
     for (ConflictAccessPoint& best_point : getBestPointList(conflict_group)) {
       best_point.get_pa_pin()->set_key_access_point(*best_point.get_access_point());
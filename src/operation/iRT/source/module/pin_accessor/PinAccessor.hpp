@@ -51,8 +51,16 @@ class PinAccessor
   std::vector<PANet> convertToPANetList(std::vector<Net>& net_list);
   PANet convertToPANet(Net& net);
   void initAccessPointList(PAModel& pa_model);
-  std::vector<LayerRect> getLegalShapeList(PAModel& pa_model, int32_t net_idx, Pin* pin);
-  std::vector<PlanarRect> getPlanarLegalRectList(PAModel& pa_model, int32_t curr_net_idx, std::vector<EXTLayerRect>& pin_shape_list);
+  PlanarCoord getPinOrigin(Pin* pin);
+  std::vector<LayerRect> getRelativeShapeList(Pin* pin, PlanarCoord& origin);
+  std::map<int32_t, std::vector<PlanarRect>> getLayerReducedRectMap(std::vector<LayerRect>& shape_list);
+  std::vector<PlanarRect> getMergedRectList(int32_t layer_idx, std::vector<PlanarRect>& rect_list);
+  std::vector<LayerRect> getLegalShapeList(PAModel& pa_model, int32_t net_idx, Pin* pin,
+                                           std::map<int32_t, std::vector<PlanarRect>>& layer_reduced_rect_map);
+  std::vector<PlanarRect> getPlanarLegalRectList(PAModel& pa_model, int32_t curr_net_idx, int32_t curr_layer_idx,
+                                                 std::vector<PlanarRect>& reduced_real_rect_list);
+  std::vector<AccessPoint> getAccessPointList(int32_t pin_idx, std::vector<LayerRect>& legal_shape_list);
+  std::vector<int32_t> getTrackOffsetList(std::vector<LayerRect>& legal_shape_list, PlanarCoord& origin);
   std::vector<AccessPoint> getAccessPointListByTrackGrid(int32_t pin_idx, std::vector<LayerRect>& legal_shape_list);
   std::vector<AccessPoint> getAccessPointListByOnTrack(int32_t pin_idx, std::vector<LayerRect>& legal_shape_list);
   std::vector<AccessPoint> getAccessPointListByShapeCenter(int32_t pin_idx, std::vector<LayerRect>& legal_shape_list);
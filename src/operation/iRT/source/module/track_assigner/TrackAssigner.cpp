@@ -173,15 +173,16 @@ void TrackAssigner::buildPanelSchedule(TAModel& ta_model)
 
   int32_t range = 2;
 
+  // 不同层的panel互不影响，同层间隔的panel互不影响，同色的panel合并为一个批次
   std::vector<std::vector<TAPanelId>> ta_panel_id_list_list;
-  for (int32_t layer_idx = 0; layer_idx < static_cast<int32_t>(layer_panel_list.size()); layer_idx++) {
-    for (int32_t start_i = 0; start_i < range; start_i++) {
-      std::vector<TAPanelId> ta_panel_id_list;
+  for (int32_t start_i = 0; start_i < range; start_i++) {
+    std::vector<TAPanelId> ta_panel_id_list;
+    for (int32_t layer_idx = 0; layer_idx < static_cast<int32_t>(layer_panel_list.size()); layer_idx++) {
       for (int32_t i = start_i; i < static_cast<int32_t>(layer_panel_list[layer_idx].size()); i += range) {
         ta_panel_id_list.emplace_back(layer_idx, i);
       }
-      ta_panel_id_list_list.push_back(ta_panel_id_list);
     }
+    ta_panel_id_list_list.push_back(ta_panel_id_list);
   }
   ta_model.set_ta_panel_id_list_list(ta_panel_id_list_list);
 }
@@ -200,31 +201,19 @@ void TrackAssigner::assignTAPanelMap(TAModel& ta_model)
     total_panel_num += ta_panel_id_list.size();
   }
 
+  // 同一批次内同时存活的panel数上限，控制峰值内存
+  int32_t alive_panel_num = std::max(1, RTDM.getConfig().thread_number) * 4;
+
   size_t assigned_panel_num = 0;
   for (std::vector<TAPanelId>& ta_panel_id_list : ta_model.get_ta_panel_id_list_list()) {
     Monitor stage_monitor;
-#pragma omp parallel for
-    for (TAPanelId& ta_panel_id : ta_panel_id_list) {
-      TAPanel& ta_panel = layer_panel_list[ta_panel_id.get_layer_idx()][ta_panel_id.get_panel_idx()];
-      buildFixedRectList(ta_panel);
-      initTATaskList(ta_model, ta_panel);
-      if (needRouting(ta_panel)) {
-        buildPanelTrackAxis(ta_panel);
-        buildTANodeMap(ta_panel);
-        buildTANodeNeighbor(ta_panel);
-        buildOrientNetMap(ta_panel);
-        // debugCheckTAPanel(ta_panel);
-        // debugPlotTAPanel(ta_panel, -1, "before_routing");
-        if (!enable_lsa) {
-          routeTAPanel(ta_panel);
-        } else {
-          routeByThirdParty(ta_panel);
-        }
-        // debugPlotTAPanel(ta_panel, -1, "after_routing");
-        uploadNetResult(ta_panel);
-        uploadViolation(ta_panel);
+    for (size_t begin_i = 0; begin_i < ta_panel_id_list.size(); begin_i += alive_panel_num) {
+      size_t end_i = std::min(begin_i + alive_panel_num, ta_panel_id_list.size());
+      std::vector<TAPanel*> ta_panel_list;
+      for (size_t i = begin_i; i < end_i; i++) {
+        ta_panel_list.push_back(&layer_panel_list[ta_panel_id_list[i].get_layer_idx()][ta_panel_id_list[i].get_panel_idx()]);
       }
-      freeTAPanel(ta_panel);
+      assignTAPanelList(ta_model, ta_panel_list, enable_lsa);
     }
     assigned_panel_num += ta_panel_id_list.size();
     RTLOG.info(Loc::current(), "Assigned ", assigned_panel_num, "/", total_panel_num, "(",
@@ -234,6 +223,48 @@ void TrackAssigner::assignTAPanelMap(TAModel& ta_model)
   RTLOG.info(Loc::current(), "Completed", monitor.getStatsInfo());
 }
 
+void TrackAssigner::assignTAPanelList(TAModel& ta_model, std::vector<TAPanel*>& ta_panel_list, int32_t enable_lsa)
+{
+#pragma omp parallel for
+  for (TAPanel* ta_panel : ta_panel_list) {
+    buildFixedRectList(*ta_panel);
+    initTATaskList(ta_model, *ta_panel);
+    if (needRouting(*ta_panel)) {
+      buildPanelTrackAxis(*ta_panel);
+      buildTANodeMap(*ta_panel);
+      buildTANodeNeighbor(*ta_panel);
+      buildOrientNetMap(*ta_panel);
+      // debugCheckTAPanel(*ta_panel);
+      // debugPlotTAPanel(*ta_panel, -1, "before_routing");
+    }
+  }
+  std::vector<TAPanel*> routing_panel_list;
+  for (TAPanel* ta_panel : ta_panel_list) {
+    if (needRouting(*ta_panel)) {
+      routing_panel_list.push_back(ta_panel);
+    }
+  }
+  if (!enable_lsa) {
+    routeTAPanelList(routing_panel_list);
+  } else {
+#pragma omp parallel for
+    for (TAPanel* ta_panel : routing_panel_list) {
+      routeByThirdParty(*ta_panel);
+    }
+    updateViolationList(routing_panel_list);
+  }
+  // 不同层的panel会写入相同的gcell，按panel顺序串行提交结果
+  for (TAPanel* ta_panel : routing_panel_list) {
+    // debugPlotTAPanel(*ta_panel, -1, "after_routing");
+    uploadNetResult(*ta_panel);
+    uploadViolation(*ta_panel);
+  }
+#pragma omp parallel for
+  for (TAPanel* ta_panel : ta_panel_list) {
+    freeTAPanel(*ta_panel);
+  }
+}
+
 void TrackAssigner::buildFixedRectList(TAPanel& ta_panel)
 {
   for (auto& [is_routing, layer_net_fixed_rect_map] : RTDM.getTypeLayerNetFixedRectMap(ta_panel.get_panel_rect())) {
@@ -394,7 +425,7 @@ void TrackAssigner::buildTANodeNeighbor(TAPanel& ta_panel)
   GridMap<TANode>& ta_node_map = ta_panel.get_ta_node_map();
   for (int32_t x = 0; x < ta_node_map.get_x_size(); x++) {
     for (int32_t y = 0; y < ta_node_map.get_y_size(); y++) {
-      std::map<Orientation, TANode*>& neighbor_node_map = ta_node_map[x][y].get_neighbor_node_map();
+      OrientArray<TANode*>& neighbor_node_map = ta_node_map[x][y].get_neighbor_node_map();
       if (routing_layer_list[ta_panel.get_panel_rect().get_layer_idx()].isPreferH()) {
         if (x != 0) {
           neighbor_node_map[Orientation::kWest] = &ta_node_map[x - 1][y];
@@ -423,16 +454,39 @@ void TrackAssigner::buildOrientNetMap(TAPanel& ta_panel)
   }
 }
 
-void TrackAssigner::routeTAPanel(TAPanel& ta_panel)
+void TrackAssigner::routeTAPanelList(std::vector<TAPanel*>& ta_panel_list)
 {
-  std::vector<TATask*> ta_task_list = initTaskSchedule(ta_panel);
-  while (!ta_task_list.empty()) {
-    for (TATask* ta_task : ta_task_list) {
-      routeTATask(ta_panel, ta_task);
-      ta_task->addRoutedTimes();
+  std::vector<std::vector<TATask*>> ta_task_list_list(ta_panel_list.size());
+  for (size_t i = 0; i < ta_panel_list.size(); i++) {
+    ta_task_list_list[i] = initTaskSchedule(*ta_panel_list[i]);
+  }
+  while (true) {
+    std::vector<int32_t> routing_idx_list;
+    for (size_t i = 0; i < ta_task_list_list.size(); i++) {
+      if (!ta_task_list_list[i].empty()) {
+        routing_idx_list.push_back(static_cast<int32_t>(i));
+      }
+    }
+    if (routing_idx_list.empty()) {
+      break;
+    }
+#pragma omp parallel for
+    for (int32_t routing_idx : routing_idx_list) {
+      for (TATask* ta_task : ta_task_list_list[routing_idx]) {
+        routeTATask(*ta_panel_list[routing_idx], ta_task);
+        ta_task->addRoutedTimes();
+      }
+    }
+    // 本轮布线的panel合并检查违例
+    std::vector<TAPanel*> routed_panel_list;
+    for (int32_t routing_idx : routing_idx_list) {
+      routed_panel_list.push_back(ta_panel_list[routing_idx]);
+    }
+    updateViolationList(routed_panel_list);
+#pragma omp parallel for
+    for (int32_t routing_idx : routing_idx_list) {
+      ta_task_list_list[routing_idx] = getTaskScheduleByViolation(*ta_panel_list[routing_idx]);
     }
-    updateViolationList(ta_panel);
-    ta_task_list = getTaskScheduleByViolation(ta_panel);
   }
 }
 
@@ -548,7 +602,7 @@ bool TrackAssigner::searchEnded(TAPanel& ta_panel)
 
 void TrackAssigner::expandSearching(TAPanel& ta_panel)
 {
-  PriorityQueue<TANode*, std::vector<TANode*>, CmpTANodeCost>& open_queue = ta_panel.get_open_queue();
+  PriorityQueue<TANode*>& open_queue = ta_panel.get_open_queue();
   TANode* path_head_node = ta_panel.get_path_head_node();
 
   for (auto& [orientation, neighbor_node] : path_head_node->get_neighbor_node_map()) {
@@ -565,8 +619,9 @@ void TrackAssigner::expandSearching(TAPanel& ta_panel)
     if (neighbor_node->isOpen() && know_cost < neighbor_node->get_known_cost()) {
       neighbor_node->set_known_cost(know_cost);
       neighbor_node->set_parent_node(path_head_node);
-      // 对优先队列中的值修改了，需要重新建堆
-      std::make_heap(open_queue.begin(), open_queue.end(), CmpTANodeCost());
+      // 代价降低后重新入队，旧的入队记录在出队时跳过
+      open_queue.push(neighbor_node, neighbor_node->getTotalCost(), neighbor_node->get_estimated_cost(),
+                      neighbor_node->get_neighbor_node_map().size());
     } else if (neighbor_node->isNone()) {
       neighbor_node->set_known_cost(know_cost);
       neighbor_node->set_parent_node(path_head_node);
@@ -588,8 +643,7 @@ bool TrackAssigner::isRoutingFailed(TAPanel& ta_panel)
 
 void TrackAssigner::resetSinglePath(TAPanel& ta_panel)
 {
-  PriorityQueue<TANode*, std::vector<TANode*>, CmpTANodeCost> empty_queue;
-  ta_panel.set_open_queue(empty_queue);
+  ta_panel.get_open_queue().clear();
 
   std::vector<TANode*>& single_path_visited_node_list = ta_panel.get_single_path_visited_node_list();
   for (TANode* visited_node : single_path_visited_node_list) {
@@ -745,11 +799,11 @@ void TrackAssigner::resetSingleTask(TAPanel& ta_panel)
 
 void TrackAssigner::pushToOpenList(TAPanel& ta_panel, TANode* curr_node)
 {
-  PriorityQueue<TANode*, std::vector<TANode*>, CmpTANodeCost>& open_queue = ta_panel.get_open_queue();
+  PriorityQueue<TANode*>& open_queue = ta_panel.get_open_queue();
   std::vector<TANode*>& single_task_visited_node_list = ta_panel.get_single_task_visited_node_list();
   std::vector<TANode*>& single_path_visited_node_list = ta_panel.get_single_path_visited_node_list();
 
-  open_queue.push(curr_node);
+  open_queue.push(curr_node, curr_node->getTotalCost(), curr_node->get_estimated_cost(), curr_node->get_neighbor_node_map().size());
   curr_node->set_state(TANodeState::kOpen);
   single_task_visited_node_list.push_back(curr_node);
   single_path_visited_node_list.push_back(curr_node);
@@ -757,13 +811,19 @@ void TrackAssigner::pushToOpenList(TAPanel& ta_panel, TANode* curr_node)
 
 TANode* TrackAssigner::popFromOpenList(TAPanel& ta_panel)
 {
-  PriorityQueue<TANode*, std::vector<TANode*>, CmpTANodeCost>& open_queue = ta_panel.get_open_queue();
+  PriorityQueue<TANode*>& open_queue = ta_panel.get_open_queue();
 
   TANode* node = nullptr;
-  if (!open_queue.empty()) {
+  while (!open_queue.empty()) {
     node = open_queue.top();
     open_queue.pop();
+    if (node->isClose()) {
+      // 代价降低时重复入队的旧记录
+      node = nullptr;
+      continue;
+    }
     node->set_state(TANodeState::kClose);
+    break;
   }
   return node;
 }
@@ -914,42 +974,91 @@ double TrackAssigner::getEstimateViaCost(TAPanel& ta_panel, TANode* start_node,
   return 0;
 }
 
-void TrackAssigner::updateViolationList(TAPanel& ta_panel)
+void TrackAssigner::updateViolationList(std::vector<TAPanel*>& ta_panel_list)
 {
-  std::vector<Violation> new_violation_list = getViolationList(ta_panel);
+  int32_t thread_number = RTDM.getConfig().thread_number;
 
-  std::vector<Violation>& violation_list = ta_panel.get_violation_list();
-  // 原结果从graph删除
-  for (Violation& violation : violation_list) {
-    updateViolationToGraph(ta_panel, ChangeType::kDel, violation);
+  // 将panel按顺序分组，每组调用一次违例检查，组间并行
+  int32_t group_num = std::max(1, std::min(thread_number, static_cast<int32_t>(ta_panel_list.size())));
+  std::vector<std::vector<TAPanel*>> ta_panel_list_list(group_num);
+  for (size_t i = 0; i < ta_panel_list.size(); i++) {
+    ta_panel_list_list[i * group_num / ta_panel_list.size()].push_back(ta_panel_list[i]);
   }
-  violation_list = new_violation_list;
-  // 新结果添加到graph
-  for (Violation& violation : violation_list) {
-    updateViolationToGraph(ta_panel, ChangeType::kAdd, violation);
+#pragma omp parallel for
+  for (std::vector<TAPanel*>& group_panel_list : ta_panel_list_list) {
+    if (group_panel_list.empty()) {
+      continue;
+    }
+    // 违例分配到所在的panel
+    std::vector<std::vector<Violation>> new_violation_list_list(group_panel_list.size());
+    for (Violation& new_violation : getViolationList(group_panel_list)) {
+      EXTLayerRect& violation_shape = new_violation.get_violation_shape();
+      int32_t panel_idx = -1;
+      int32_t min_distance = INT32_MAX;
+      for (size_t i = 0; i < group_panel_list.size(); i++) {
+        EXTLayerRect& panel_rect = group_panel_list[i]->get_panel_rect();
+        if (panel_rect.get_layer_idx() != violation_shape.get_layer_idx()) {
+          continue;
+        }
+        if (RTUTIL.isClosedOverlap(panel_rect.get_real_rect(), violation_shape.get_real_rect())) {
+          panel_idx = static_cast<int32_t>(i);
+          break;
+        }
+        int32_t distance
+            = RTUTIL.getManhattanDistance(panel_rect.get_real_rect().getMidPoint(), violation_shape.get_real_rect().getMidPoint());
+        if (distance < min_distance) {
+          panel_idx = static_cast<int32_t>(i);
+          min_distance = distance;
+        }
+      }
+      if (panel_idx == -1) {
+        RTLOG.error(Loc::current(), "The violation is not in any panel!");
+      }
+      new_violation_list_list[panel_idx].push_back(new_violation);
+    }
+    for (size_t i = 0; i < group_panel_list.size(); i++) {
+      TAPanel& ta_panel = *group_panel_list[i];
+      std::vector<Violation>& violation_list = ta_panel.get_violation_list();
+      // 原结果从graph删除
+      for (Violation& violation : violation_list) {
+        updateViolationToGraph(ta_panel, ChangeType::kDel, violation);
+      }
+      violation_list = new_violation_list_list[i];
+      // 新结果添加到graph
+      for (Violation& violation : violation_list) {
+        updateViolationToGraph(ta_panel, ChangeType::kAdd, violation);
+      }
+    }
   }
 }
 
-std::vector<Violation> TrackAssigner::getViolationList(TAPanel& ta_panel)
+std::vector<Violation> TrackAssigner::getViolationList(std::vector<TAPanel*>& ta_panel_list)
 {
   std::vector<idb::IdbLayerShape*> env_shape_list;
   std::map<int32_t, std::vector<idb::IdbLayerShape*>> net_pin_shape_map;
-  for (auto& [net_idx, fixed_rect_set] : ta_panel.get_net_fixed_rect_map()) {
-    if (net_idx == -1) {
-      for (auto& fixed_rect : fixed_rect_set) {
-        env_shape_list.push_back(RTDM.getIDBLayerShapeByFixedRect(fixed_rect, true));
-      }
-    } else {
+  // 不同panel查询到的fixed_rect可能重复
+  std::set<EXTLayerRect*> visited_fixed_rect_set;
+  for (TAPanel* ta_panel : ta_panel_list) {
+    for (auto& [net_idx, fixed_rect_set] : ta_panel->get_net_fixed_rect_map()) {
       for (auto& fixed_rect : fixed_rect_set) {
-        net_pin_shape_map[net_idx].push_back(RTDM.getIDBLayerShapeByFixedRect(fixed_rect, true));
+        if (!visited_fixed_rect_set.insert(fixed_rect).second) {
+          continue;
+        }
+        if (net_idx == -1) {
+          env_shape_list.push_back(RTDM.getIDBLayerShapeByFixedRect(fixed_rect, true));
+        } else {
+          net_pin_shape_map[net_idx].push_back(RTDM.getIDBLayerShapeByFixedRect(fixed_rect, true));
+        }
       }
     }
   }
   std::map<int32_t, std::vector<idb::IdbRegularWireSegment*>> net_wire_via_map;
-  for (auto& [net_idx, task_result_map] : ta_panel.get_net_task_result_map()) {
-    for (auto& [task_idx, segment_list] : task_result_map) {
-      for (Segment<LayerCoord>& segment : segment_list) {
-        net_wire_via_map[net_idx].push_back(RTDM.getIDBSegmentByNetResult(net_idx, segment));
+  for (TAPanel* ta_panel : ta_panel_list) {
+    for (auto& [net_idx, task_result_map] : ta_panel->get_net_task_result_map()) {
+      for (auto& [task_idx, segment_list] : task_result_map) {
+        for (Segment<LayerCoord>& segment : segment_list) {
+          net_wire_via_map[net_idx].push_back(RTDM.getIDBSegmentByNetResult(net_idx, segment));
+        }
       }
     }
   }
@@ -1109,10 +1218,6 @@ void TrackAssigner::routeByThirdParty(TAPanel& ta_panel)
       }
     }
   }
-  // 计算violation
-  {
-    updateViolationList(ta_panel);
-  }
 }
 
 void TrackAssigner::uploadNetResult(TAPanel& ta_panel)
@@ -1152,9 +1257,9 @@ void TrackAssigner::updateFixedRectToGraph(TAPanel& ta_panel, ChangeType change_
   for (auto& [ta_node, orientation_set] : getNodeOrientationMap(ta_panel, net_shape)) {
     for (Orientation orientation : orientation_set) {
       if (change_type == ChangeType::kAdd) {
-        ta_node->get_orient_fixed_rect_map()[orientation].insert(net_shape.get_net_idx());
+        ta_node->get_orient_fixed_rect_map().insert(orientation, net_shape.get_net_idx());
       } else if (change_type == ChangeType::kDel) {
-        ta_node->get_orient_fixed_rect_map()[orientation].erase(net_shape.get_net_idx());
+        ta_node->get_orient_fixed_rect_map().erase(orientation, net_shape.get_net_idx());
       }
     }
   }
@@ -1166,9 +1271,9 @@ void TrackAssigner::updateNetResultToGraph(TAPanel& ta_panel, ChangeType change_
     for (auto& [ta_node, orientation_set] : getNodeOrientationMap(ta_panel, net_shape)) {
       for (Orientation orientation : orientation_set) {
         if (change_type == ChangeType::kAdd) {
-          ta_node->get_orient_routed_rect_map()[orientation].insert(net_shape.get_net_idx());
+          ta_node->get_orient_routed_rect_map().insert(orientation, net_shape.get_net_idx());
         } else if (change_type == ChangeType::kDel) {
-          ta_node->get_orient_routed_rect_map()[orientation].erase(net_shape.get_net_idx());
+          ta_node->get_orient_routed_rect_map().erase(orientation, net_shape.get_net_idx());
         }
       }
     }
@@ -1229,7 +1334,7 @@ std::map<TANode*, std::set<Orientation>> TrackAssigner::getRoutingNodeOrientatio
         if (orientation == Orientation::kAbove || orientation == Orientation::kBelow) {
           continue;
         }
-        if (!RTUTIL.exist(node.get_neighbor_node_map(), orientation)) {
+        if (node.getNeighborNode(orientation) == nullptr) {
           continue;
         }
         node_orientation_map[&node].insert(orientation);
@@ -1328,14 +1433,12 @@ void TrackAssigner::writeNetCSV(TAModel& ta_model)
   for (int32_t x = 0; x < gcell_map.get_x_size(); x++) {
     for (int32_t y = 0; y < gcell_map.get_y_size(); y++) {
       std::map<int32_t, std::set<int32_t>> net_layer_map;
-      for (auto& [net_idx, segment_set] : gcell_map[x][y].get_detailed_net_result_map()) {
-        for (Segment<LayerCoord>* segment : segment_set) {
-          int32_t first_layer_idx = segment->get_first().get_layer_idx();
-          int32_t second_layer_idx = segment->get_second().get_layer_idx();
-          RTUTIL.swapByASC(first_layer_idx, second_layer_idx);
-          for (int32_t layer_idx = first_layer_idx; layer_idx <= second_layer_idx; layer_idx++) {
-            net_layer_map[net_idx].insert(layer_idx);
-          }
+      for (auto& net_segment : gcell_map[x][y].get_detailed_net_result_set()) {
+        int32_t first_layer_idx = net_segment.item->get_first().get_layer_idx();
+        int32_t second_layer_idx = net_segment.item->get_second().get_layer_idx();
+        RTUTIL.swapByASC(first_layer_idx, second_layer_idx);
+        for (int32_t layer_idx = first_layer_idx; layer_idx <= second_layer_idx; layer_idx++) {
+          net_layer_map[net_segment.net_idx].insert(layer_idx);
         }
       }
       for (auto& [net_idx, layer_set] : net_layer_map) {
@@ -1413,8 +1516,11 @@ void TrackAssigner::debugCheckTAPanel(TAPanel& ta_panel)
         RTLOG.error(Loc::current(), "The ta_node is out of panel!");
       }
       for (auto& [orient, neighbor] : ta_node.get_neighbor_node_map()) {
+        if (neighbor == nullptr) {
+          continue;
+        }
         Orientation opposite_orient = RTUTIL.getOppositeOrientation(orient);
-        if (!RTUTIL.exist(neighbor->get_neighbor_node_map(), opposite_orient)) {
+        if (neighbor->getNeighborNode(opposite_orient) == nullptr) {
           RTLOG.error(Loc::current(), "The ta_node neighbor is not bidirectional!");
         }
         if (neighbor->get_neighbor_node_map()[opposite_orient] != &ta_node) {
@@ -1573,7 +1679,7 @@ void TrackAssigner::debugPlotTAPanel(TAPanel& ta_panel, int32_t curr_task_idx, s
         gp_text_orient_fixed_rect_map_info.set_coord(real_rect.get_ll_x(), y);
         gp_text_orient_fixed_rect_map_info.set_text_type(static_cast<int32_t>(GPDataType::kInfo));
         std::string orient_fixed_rect_map_info_message = "--";
-        for (auto& [orient, net_set] : ta_node.get_orient_fixed_rect_map()) {
+        for (auto& [orient, net_set] : ta_node.get_orient_fixed_rect_map().getOrientNetMap()) {
           orient_fixed_rect_map_info_message += RTUTIL.getString("(", GetOrientationName()(orient));
           for (int32_t net_idx : net_set) {
             orient_fixed_rect_map_info_message += RTUTIL.getString(",", net_idx);
@@ -1601,7 +1707,7 @@ void TrackAssigner::debugPlotTAPanel(TAPanel& ta_panel, int32_t curr_task_idx, s
         gp_text_orient_routed_rect_map_info.set_coord(real_rect.get_ll_x(), y);
         gp_text_orient_routed_rect_map_info.set_text_type(static_cast<int32_t>(GPDataType::kInfo));
         std::string orient_routed_rect_map_info_message = "--";
-        for (auto& [orient, net_set] : ta_node.get_orient_routed_rect_map()) {
+        for (auto& [orient, net_set] : ta_node.get_orient_routed_rect_map().getOrientNetMap()) {
           orient_routed_rect_map_info_message += RTUTIL.getString("(", GetOrientationName()(orient));
           for (int32_t net_idx : net_set) {
             orient_routed_rect_map_info_message += RTUTIL.getString(",", net_idx);
@@ -1630,6 +1736,9 @@ void TrackAssigner::debugPlotTAPanel(TAPanel& ta_panel, int32_t curr_task_idx, s
         gp_text_orient_violation_number_map_info.set_text_type(static_cast<int32_t>(GPDataType::kInfo));
         std::string orient_violation_number_map_info_message = "--";
         for (auto& [orient, violation_number] : ta_node.get_orient_violation_number_map()) {
+          if (violation_number == 0) {
+            continue;
+          }
           orient_violation_number_map_info_message += RTUTIL.getString("(", GetOrientationName()(orient), ",", violation_number != 0, ")");
         }
         gp_text_orient_violation_number_map_info.set_message(orient_violation_number_map_info_message);
@@ -1683,6 +1792,9 @@ void TrackAssigner::debugPlotTAPanel(TAPanel& ta_panel, int32_t curr_task_idx, s
       int32_t width = std::min(x_reduced_span, y_reduced_span) / 2;
 
       for (auto& [orientation, neighbor_node] : ta_node.get_neighbor_node_map()) {
+        if (neighbor_node == nullptr) {
+          continue;
+        }
         GPPath gp_path;
         switch (orientation) {
           case Orientation::kEast:
@@ -55,6 +55,7 @@ class TrackAssigner
   void initTAPanelMap(TAModel& ta_model);
   void buildPanelSchedule(TAModel& ta_model);
   void assignTAPanelMap(TAModel& ta_model);
+  void assignTAPanelList(TAModel& ta_model, std::vector<TAPanel*>& ta_panel_list, int32_t enable_lsa);
   void initTATaskList(TAModel& ta_model, TAPanel& ta_panel);
   bool needRouting(TAPanel& ta_panel);
   void buildFixedRectList(TAPanel& ta_panel);
@@ -62,7 +63,7 @@ class TrackAssigner
   void buildTANodeMap(TAPanel& ta_panel);
   void buildTANodeNeighbor(TAPanel& ta_panel);
   void buildOrientNetMap(TAPanel& ta_panel);
-  void routeTAPanel(TAPanel& ta_panel);
+  void routeTAPanelList(std::vector<TAPanel*>& ta_panel_list);
   std::vector<TATask*> initTaskSchedule(TAPanel& ta_panel);
   void routeTATask(TAPanel& ta_panel, TATask* ta_task);
   void initSingleTask(TAPanel& ta_panel, TATask* ta_task);
@@ -93,8 +94,8 @@ class TrackAssigner
   double getEstimateWireCost(TAPanel& ta_panel, TANode* start_node, TANode* end_node);
   double getEstimateCornerCost(TAPanel& ta_panel, TANode* start_node, TANode* end_node);
   double getEstimateViaCost(TAPanel& ta_panel, TANode* start_node, TANode* end_node);
-  void updateViolationList(TAPanel& ta_panel);
-  std::vector<Violation> getViolationList(TAPanel& ta_panel);
+  void updateViolationList(std::vector<TAPanel*>& ta_panel_list);
+  std::vector<Violation> getViolationList(std::vector<TAPanel*>& ta_panel_list);
   std::vector<TATask*> getTaskScheduleByViolation(TAPanel& ta_panel);
   void routeByThirdParty(TAPanel& ta_panel);
   void uploadNetResult(TAPanel& ta_panel);
@@ -18,6 +18,8 @@
 
 #include "Direction.hpp"
 #include "LayerCoord.hpp"
+#include "OrientArray.hpp"
+#include "OrientNetSet.hpp"
 #include "Orientation.hpp"
 #include "RTHeader.hpp"
 #include "Utility.hpp"
@@ -39,79 +41,46 @@ class TANode : public LayerCoord
   TANode() = default;
   ~TANode() = default;
   // getter
-  std::map<Orientation, TANode*>& get_neighbor_node_map() { return _neighbor_node_map; }
-  std::map<Orientation, std::set<int32_t>>& get_orient_fixed_rect_map() { return _orient_fixed_rect_map; }
-  std::map<Orientation, std::set<int32_t>>& get_orient_routed_rect_map() { return _orient_routed_rect_map; }
-  std::map<Orientation, int32_t>& get_orient_violation_number_map() { return _orient_violation_number_map; }
+  OrientArray<TANode*>& get_neighbor_node_map() { return _neighbor_node_map; }
+  OrientNetSet& get_orient_fixed_rect_map() { return _orient_fixed_rect_map; }
+  OrientNetSet& get_orient_routed_rect_map() { return _orient_routed_rect_map; }
+  OrientArray<int32_t>& get_orient_violation_number_map() { return _orient_violation_number_map; }
   // setter
-  void set_neighbor_node_map(const std::map<Orientation, TANode*>& neighbor_node_map) { _neighbor_node_map = neighbor_node_map; }
-  void set_orient_fixed_rect_map(const std::map<Orientation, std::set<int32_t>>& orient_fixed_rect_map)
+  void set_neighbor_node_map(const OrientArray<TANode*>& neighbor_node_map) { _neighbor_node_map = neighbor_node_map; }
+  void set_orient_fixed_rect_map(const OrientNetSet& orient_fixed_rect_map)
   {
     _orient_fixed_rect_map = orient_fixed_rect_map;
   }
-  void set_orient_routed_rect_map(const std::map<Orientation, std::set<int32_t>>& orient_routed_rect_map)
+  void set_orient_routed_rect_map(const OrientNetSet& orient_routed_rect_map)
   {
     _orient_routed_rect_map = orient_routed_rect_map;
   }
-  void set_orient_violation_number_map(const std::map<Orientation, int32_t>& orient_violation_number_map)
+  void set_orient_violation_number_map(const OrientArray<int32_t>& orient_violation_number_map)
   {
     _orient_violation_number_map = orient_violation_number_map;
   }
   // function
-  TANode* getNeighborNode(Orientation orientation)
-  {
-    TANode* neighbor_node = nullptr;
-    if (RTUTIL.exist(_neighbor_node_map, orientation)) {
-      neighbor_node = _neighbor_node_map[orientation];
-    }
-    return neighbor_node;
-  }
+  TANode* getNeighborNode(Orientation orientation) { return _neighbor_node_map.get(orientation); }
   double getFixedRectCost(int32_t net_idx, Orientation orientation, double fixed_rect_unit)
   {
-    int32_t fixed_rect_num = 0;
-    if (RTUTIL.exist(_orient_fixed_rect_map, orientation)) {
-      std::set<int32_t>& net_set = _orient_fixed_rect_map[orientation];
-      fixed_rect_num = static_cast<int32_t>(net_set.size());
-      if (RTUTIL.exist(net_set, net_idx)) {
-        fixed_rect_num--;
-      }
-      if (fixed_rect_num < 0) {
-        RTLOG.error(Loc::current(), "The fixed_rect_num < 0!");
-      }
-    }
     double cost = 0;
-    if (fixed_rect_num > 0) {
+    if (_orient_fixed_rect_map.getOtherNetNum(orientation, net_idx) > 0) {
       cost = fixed_rect_unit;
     }
     return cost;
   }
   double getRoutedRectCost(int32_t net_idx, Orientation orientation, double routed_rect_unit)
   {
-    int32_t routed_rect_num = 0;
-    if (RTUTIL.exist(_orient_routed_rect_map, orientation)) {
-      std::set<int32_t>& net_set = _orient_routed_rect_map[orientation];
-      routed_rect_num = static_cast<int32_t>(net_set.size());
-      if (RTUTIL.exist(net_set, net_idx)) {
-        routed_rect_num--;
-      }
-      if (routed_rect_num < 0) {
-        RTLOG.error(Loc::current(), "The routed_rect_num < 0!");
-      }
-    }
     double cost = 0;
-    if (routed_rect_num > 0) {
+    if (_orient_routed_rect_map.getOtherNetNum(orientation, net_idx) > 0) {
       cost = routed_rect_unit;
     }
     return cost;
   }
   double getViolationCost(Orientation orientation, double violation_unit)
   {
-    int32_t violation_num = 0;
-    if (RTUTIL.exist(_orient_violation_number_map, orientation)) {
-      violation_num = _orient_violation_number_map[orientation];
-    }
     double cost = 0;
-    if (violation_num > 0) {
+    if (_orient_violation_number_map.get(orientation) > 0) {
       cost = violation_unit;
     }
     return cost;
@@ -137,13 +106,13 @@ class TANode : public LayerCoord
 #endif
 
  private:
-  std::map<Orientation, TANode*> _neighbor_node_map;
+  OrientArray<TANode*> _neighbor_node_map;
   // obstacle & pin_shape
-  std::map<Orientation, std::set<int32_t>> _orient_fixed_rect_map;
+  OrientNetSet _orient_fixed_rect_map;
   // net_result & patch
-  std::map<Orientation, std::set<int32_t>> _orient_routed_rect_map;
+  OrientNetSet _orient_routed_rect_map;
   // violation
-  std::map<Orientation, int32_t> _orient_violation_number_map;
+  OrientArray<int32_t> _orient_violation_number_map;
 #if 1  // astar
   // single task
   std::set<Direction> _direction_set;
@@ -155,22 +124,4 @@ class TANode : public LayerCoord
 #endif
 };
 
-#if 1  // astar
-struct CmpTANodeCost
-{
-  bool operator()(TANode* a, TANode* b)
-  {
-    if (RTUTIL.equalDoubleByError(a->getTotalCost(), b->getTotalCost(), RT_ERROR)) {
-      if (RTUTIL.equalDoubleByError(a->get_estimated_cost(), b->get_estimated_cost(), RT_ERROR)) {
-        return a->get_neighbor_node_map().size() < b->get_neighbor_node_map().size();
-      } else {
-        return a->get_estimated_cost() > b->get_estimated_cost();
-      }
-    } else {
-      return a->getTotalCost() > b->getTotalCost();
-    }
-  }
-};
-#endif
-
 }  // namespace irt
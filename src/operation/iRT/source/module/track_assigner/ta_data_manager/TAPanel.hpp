@@ -83,11 +83,11 @@ class TAPanel
     _routing_segment_list = routing_segment_list;
   }
   // single path
-  PriorityQueue<TANode*, std::vector<TANode*>, CmpTANodeCost>& get_open_queue() { return _open_queue; }
+  PriorityQueue<TANode*>& get_open_queue() { return _open_queue; }
   std::vector<TANode*>& get_single_path_visited_node_list() { return _single_path_visited_node_list; }
   TANode* get_path_head_node() { return _path_head_node; }
   int32_t get_end_node_list_idx() const { return _end_node_list_idx; }
-  void set_open_queue(const PriorityQueue<TANode*, std::vector<TANode*>, CmpTANodeCost>& open_queue) { _open_queue = open_queue; }
+  void set_open_queue(const PriorityQueue<TANode*>& open_queue) { _open_queue = open_queue; }
   void set_single_path_visited_node_list(const std::vector<TANode*>& single_path_visited_node_list)
   {
     _single_path_visited_node_list = single_path_visited_node_list;
@@ -115,7 +115,7 @@ class TAPanel
   std::vector<TANode*> _single_task_visited_node_list;
   std::vector<Segment<LayerCoord>> _routing_segment_list;
   // single path
-  PriorityQueue<TANode*, std::vector<TANode*>, CmpTANodeCost> _open_queue;
+  PriorityQueue<TANode*> _open_queue;
   std::vector<TANode*> _single_path_visited_node_list;
   TANode* _path_head_node = nullptr;
   int32_t _end_node_list_idx = -1;
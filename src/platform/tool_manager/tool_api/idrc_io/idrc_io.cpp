@@ -33,6 +33,7 @@ bool DrcIO::runDRC(std::string config, std::string report_path)
     /// set config path
     config = flowConfigInst->get_idrc_path();
   }
+  _config_path = config;
 
   flowConfigInst->set_status_stage("iDRC - Design Rule Check");
   ieda::Stats stats;
@@ -84,7 +85,7 @@ std::map<std::string, std::vector<idrc::DrcViolation*>> DrcIO::getDetailCheckRes
 void DrcIO::get_def_drc()
 {
   idrc::DrcApi drc_api;
-  drc_api.init();
+  drc_api.init(_config_path);
   auto violations = drc_api.checkDef();
   for (auto [type, violation_list] : violations) {
     std::string name = idrc::GetViolationTypeName()(type);
@@ -54,6 +54,7 @@ class DrcIO
   static DrcIO* _instance;
 
   std::map<std::string, std::vector<idrc::DrcViolation*>> _detail_drc;
+  std::string _config_path = "";
   void get_def_drc();
 
   DrcIO() {}
@@ -17,8 +17,10 @@
 
 #include "Abacus.hh"
 
+#include <algorithm>
 #include <iostream>
 #include <map>
+#include <sstream>
 
 #include "LGDatabase.hh"
 #include "LGInstance.hh"
@@ -28,10 +30,10 @@ namespace ieda_solver {
 
   Abacus::~Abacus()
   {
-    for (auto pair : _cluster_map) {
-      delete pair.second;
+    for (auto* cluster : _cluster_list) {
+      delete cluster;
     }
-    _cluster_map.clear();
+    _cluster_list.clear();
     _inst_belong_cluster.clear();
     _interval_cluster_root.clear();
     _interval_remain_length.clear();
@@ -40,7 +42,9 @@ namespace ieda_solver {
   void Abacus::initDataRequirement(ipl::LGConfig* lg_config, ipl::LGDatabase* lg_database)
   {
     // clean abacus info first.
-    _cluster_map.clear();
+    _cluster_list.clear();
+    _cluster_id_cursor = 0;
+    _band_id_cursor.clear();
     _inst_belong_cluster.clear();
     _interval_cluster_root.clear();
     _interval_remain_length.clear();
@@ -61,11 +65,19 @@ namespace ieda_solver {
 
     _row_height = _database->get_lg_layout()->get_row_height();
     _site_width = _database->get_lg_layout()->get_site_width();
+
+    // split rows into one band per thread, bands lower than the limit are not worth the reconciliation.
+    int32_t thread_num = std::max(_config->get_thread_num(), 1);
+    int32_t min_band_row_num = 16;
+    _band_row_num = (_database->get_lg_layout()->get_row_num() + thread_num - 1) / thread_num;
+    if (thread_num == 1 || _band_row_num < min_band_row_num) {
+      _band_row_num = _database->get_lg_layout()->get_row_num();
+    }
   }
 
   bool Abacus::isInitialized()
   {
-    return !_cluster_map.empty();
+    return std::any_of(_cluster_list.begin(), _cluster_list.end(), [](AbacusCluster* cluster) { return cluster != nullptr; });
   }
 
   void Abacus::specifyTargetInstList(std::vector<ipl::LGInstance*>& target_inst_list)
@@ -80,19 +92,20 @@ namespace ieda_solver {
     std::vector<ipl::LGInstance*> movable_inst_list;
     pickAndSortMovableInstList(movable_inst_list);
 
-    int32_t inst_id = 0;
-    for (auto* inst : movable_inst_list) {
+    // Legalize row bands concurrently, the instances could not be settled inside their band are left behind.
+    std::vector<ipl::LGInstance*> remain_inst_list;
+    if (obtainBandNum() > 1) {
+      runBandLegalization(movable_inst_list, remain_inst_list);
+    }
+    else {
+      remain_inst_list = std::move(movable_inst_list);
+    }
 
+    int32_t inst_id = 0;
+    for (auto* inst : remain_inst_list) {
       int32_t best_row = INT32_MAX;
       int32_t best_cost = INT32_MAX;
-      for (int32_t row_idx = 0; row_idx < _database->get_lg_layout()->get_row_num(); row_idx++) {
-        int32_t cost = placeRow(inst, row_idx, true, false);
-
-        if (cost < best_cost) {
-          best_cost = cost;
-          best_row = row_idx;
-        }
-      }
+      searchBestRow(inst, 0, _database->get_lg_layout()->get_row_num(), best_row, best_cost);
 
       if (best_row == INT32_MAX) {
         LOG_ERROR << "Instance: " << inst->get_name() << "Cannot find a row for placement";
@@ -130,12 +143,14 @@ namespace ieda_solver {
 
       int32_t best_row = INT32_MAX;
       int32_t best_cost = INT32_MAX;
-      for (int32_t row_idx = min_row_idx; row_idx < max_row_idx; row_idx++) {
-        int32_t cost = placeRow(inst, row_idx, true, false);
-        if (cost < best_cost) {
-          best_cost = cost;
-          best_row = row_idx;
-        }
+      searchBestRow(inst, min_row_idx, max_row_idx, best_row, best_cost);
+      if (best_row == INT32_MAX) {
+        // no room around the instance, widen to the whole core.
+        searchBestRow(inst, 0, row_num, best_row, best_cost);
+      }
+      if (best_row == INT32_MAX) {
+        LOG_ERROR << "Instance: " << inst->get_name() << "Cannot find a row for placement";
+        return false;
       }
       placeRow(inst, best_row, false, true);
     }
@@ -156,12 +171,114 @@ namespace ieda_solver {
       [](ipl::LGInstance* l_inst, ipl::LGInstance* r_inst) { return (l_inst->get_coordi().get_x() < r_inst->get_coordi().get_x()); });
   }
 
+  int32_t Abacus::obtainBandNum()
+  {
+    int32_t row_num = _database->get_lg_layout()->get_row_num();
+    if (_band_row_num <= 0 || row_num <= 0) {
+      return 1;
+    }
+    return (row_num + _band_row_num - 1) / _band_row_num;
+  }
+
+  void Abacus::runBandLegalization(std::vector<ipl::LGInstance*>& movable_inst_list, std::vector<ipl::LGInstance*>& remain_inst_list)
+  {
+    int32_t row_num = _database->get_lg_layout()->get_row_num();
+    int32_t band_num = obtainBandNum();
+
+    // keep the x order inside each band, so the result only depends on the band partition.
+    std::vector<std::vector<ipl::LGInstance*>> band_inst_list(band_num);
+    for (auto* inst : movable_inst_list) {
+      band_inst_list[obtainBaseRowIdx(inst) / _band_row_num].push_back(inst);
+    }
+
+    // every new cluster in a band comes from one instance, reserve disjoint id ranges for the bands.
+    _band_id_cursor.resize(band_num);
+    int32_t id_cursor = _cluster_id_cursor;
+    for (int32_t band_idx = 0; band_idx < band_num; band_idx++) {
+      _band_id_cursor[band_idx] = id_cursor;
+      id_cursor += band_inst_list[band_idx].size();
+    }
+    if (static_cast<int32_t>(_cluster_list.size()) < id_cursor) {
+      _cluster_list.resize(id_cursor, nullptr);
+    }
+
+    std::vector<std::vector<ipl::LGInstance*>> band_remain_list(band_num);
+#pragma omp parallel for num_threads(_config->get_thread_num()) schedule(dynamic, 1)
+    for (int32_t band_idx = 0; band_idx < band_num; band_idx++) {
+      int32_t min_row_idx = band_idx * _band_row_num;
+      int32_t max_row_idx = std::min(min_row_idx + _band_row_num, row_num);
+      for (auto* inst : band_inst_list[band_idx]) {
+        int32_t best_row = INT32_MAX;
+        int32_t best_cost = INT32_MAX;
+        bool is_closed = searchBestRow(inst, min_row_idx, max_row_idx, best_row, best_cost);
+
+        // the rows outside the band may be cheaper, reconcile it after all bands are done.
+        bool is_lower_closed = (min_row_idx == 0 || calRowDistance(inst, min_row_idx - 1) > best_cost);
+        bool is_upper_closed = (max_row_idx == row_num || calRowDistance(inst, max_row_idx) > best_cost);
+        if (best_row == INT32_MAX || !(is_closed || (is_lower_closed && is_upper_closed))) {
+          band_remain_list[band_idx].push_back(inst);
+          continue;
+        }
+        placeRow(inst, best_row, false, false);
+      }
+    }
+
+    _band_id_cursor.clear();
+    _cluster_id_cursor = _cluster_list.size();
+
+    for (auto& inst_list : band_remain_list) {
+      remain_inst_list.insert(remain_inst_list.end(), inst_list.begin(), inst_list.end());
+    }
+    std::stable_sort(remain_inst_list.begin(), remain_inst_list.end(),
+      [](ipl::LGInstance* l_inst, ipl::LGInstance* r_inst) { return (l_inst->get_coordi().get_x() < r_inst->get_coordi().get_x()); });
+    LOG_INFO << "Band Legalization : " << band_num << " bands, " << remain_inst_list.size() << " instances left for reconciliation";
+  }
+
+  bool Abacus::searchBestRow(ipl::LGInstance* inst, int32_t min_row_idx, int32_t max_row_idx, int32_t& best_row, int32_t& best_cost)
+  {
+    // The cost is no less than the vertical displacement, so visit rows from the nearest one and stop
+    // once the vertical displacement alone exceeds the best cost. Ties go to the lower row as before.
+    if (min_row_idx >= max_row_idx) {
+      return false;
+    }
+    int32_t base_row_idx = std::clamp(obtainBaseRowIdx(inst), min_row_idx, max_row_idx - 1);
+    int32_t lower_idx = base_row_idx;
+    int32_t upper_idx = base_row_idx + 1;
+    while (lower_idx >= min_row_idx || upper_idx < max_row_idx) {
+      int32_t lower_distance = (lower_idx >= min_row_idx) ? calRowDistance(inst, lower_idx) : INT32_MAX;
+      int32_t upper_distance = (upper_idx < max_row_idx) ? calRowDistance(inst, upper_idx) : INT32_MAX;
+      int32_t row_distance = std::min(lower_distance, upper_distance);
+      if (row_distance > best_cost) {
+        return true;
+      }
+      int32_t row_idx = (lower_distance <= upper_distance) ? lower_idx-- : upper_idx++;
+
+      int32_t cost = placeRow(inst, row_idx, true, false);
+      if (cost < best_cost || (cost == best_cost && cost != INT32_MAX && row_idx < best_row)) {
+        best_cost = cost;
+        best_row = row_idx;
+      }
+    }
+    return false;
+  }
+
+  int32_t Abacus::obtainBaseRowIdx(ipl::LGInstance* inst)
+  {
+    int32_t row_idx = inst->get_coordi().get_y() / _row_height;
+    return std::clamp(row_idx, 0, _database->get_lg_layout()->get_row_num() - 1);
+  }
+
+  int32_t Abacus::calRowDistance(ipl::LGInstance* inst, int32_t row_idx)
+  {
+    return std::abs(row_idx * _row_height - inst->get_coordi().get_y());
+  }
+
   int32_t Abacus::placeRow(ipl::LGInstance* inst, int32_t row_idx, bool is_trial, bool is_record_cluster)
   {
     ipl::Rectangle<int32_t> inst_shape = std::move(inst->get_shape());
 
     // Determine clusters and their optimal positions x_c(c):
-    std::vector<ipl::LGInterval*> interval_list = _database->get_lg_layout()->get_interval_2d_list()[row_idx];
+    std::vector<ipl::LGInterval*>& interval_list = _database->get_lg_layout()->get_interval_2d_list()[row_idx];
 
     // Select the nearest interval for the instance
     int32_t row_interval_idx = searchNearestIntervalIndex(interval_list, inst_shape);
@@ -229,24 +346,30 @@ namespace ieda_solver {
       return 0;
     }
 
-    int32_t prev_distance = INT32_MAX;
-    int32_t segment_idx = INT32_MAX;
-    for (size_t i = 0; i < segment_list.size(); i++) {
-      int32_t cur_distance
-        = calDistanceWithBox(inst_shape.get_ll_x(), inst_shape.get_ur_x(), segment_list[i]->get_min_x(), segment_list[i]->get_max_x());
+    // segments are sorted by x, bisect to the first segment not on the left of the instance.
+    auto iter = std::lower_bound(segment_list.begin(), segment_list.end(), inst_shape.get_ll_x(),
+                                 [](ipl::LGInterval* segment, int32_t min_x) { return segment->get_max_x() < min_x; });
+    if (iter == segment_list.end()) {
+      return INT32_MAX;
+    }
+
+    int32_t segment_idx = std::distance(segment_list.begin(), iter);
+    int32_t cur_distance = calDistanceWithBox(inst_shape.get_ll_x(), inst_shape.get_ur_x(), (*iter)->get_min_x(), (*iter)->get_max_x());
+    if (cur_distance == 0) {
+      return segment_idx;
+    }
+    if (segment_idx > 0) {
+      auto* prev_segment = segment_list[segment_idx - 1];
+      int32_t prev_distance = calDistanceWithBox(inst_shape.get_ll_x(), inst_shape.get_ur_x(), prev_segment->get_min_x(), prev_segment->get_max_x());
       if (cur_distance > prev_distance) {
-        segment_idx = i - 1;
-        break;
+        return segment_idx - 1;
       }
-      if (cur_distance == 0) {
-        segment_idx = i;
-        break;
-      }
-
-      prev_distance = cur_distance;
+    }
+    if (segment_idx + 1 < static_cast<int32_t>(segment_list.size())) {
+      return segment_idx;
     }
 
-    return segment_idx;
+    return INT32_MAX;
   }
 
   int32_t Abacus::calDistanceWithBox(int32_t min_x, int32_t max_x, int32_t box_min_x, int32_t box_max_x)
@@ -339,23 +462,12 @@ namespace ieda_solver {
 
     if (!is_collapse) {
       // Create new cluster
-      std::string cluster_name = obtainUniqueClusterName(inst->get_name());
-      record_cluster = AbacusCluster(cluster_name);
-
-      // auto* exist_cluster = findCluster(inst->get_name());
-      // if (exist_cluster) {
-      //   record_cluster = AbacusCluster(exist_cluster->get_name() + "_2024");
-      // }
-      // else {
-      //   record_cluster = AbacusCluster(inst->get_name());
-      // }
-      // // record_cluster = AbacusCluster(inst->get_name());
-
+      record_cluster = AbacusCluster(obtainNewClusterId(interval));
       record_cluster.add_inst(inst);
       record_cluster.appendInst(inst);
       record_cluster.set_belong_interval(interval);
       if (last_cluster) {
-        record_cluster.set_front_cluster(last_cluster->get_name());
+        record_cluster.set_front_cluster(last_cluster->get_id());
       }
       legalizeCluster(record_cluster);
     }
@@ -407,7 +519,7 @@ namespace ieda_solver {
   }
 
   void Abacus::mergeWithPreviousCluster(AbacusCluster& cluster, AbacusCluster prev_cluster) {
-    AbacusCluster tmp_cluster(cluster.get_name());
+    AbacusCluster tmp_cluster(cluster.get_id());
     tmp_cluster.set_belong_interval(cluster.get_belong_interval());
     tmp_cluster.appendInstList(prev_cluster.get_inst_list());
     tmp_cluster.appendCluster(cluster);
@@ -477,11 +589,11 @@ namespace ieda_solver {
     // record rollback info
     RollbackInfo rollback_info;
 
-    auto* cluster_ptr = this->findCluster(modify_cluster.get_name());
-    std::string origin_back_cluster_name = "";
+    auto* cluster_ptr = this->findCluster(modify_cluster.get_id());
+    int32_t origin_back_cluster_id = -1;
     if (!cluster_ptr) {
       AbacusCluster* new_cluster = new AbacusCluster(modify_cluster);
-      this->insertCluster(new_cluster->get_name(), new_cluster);
+      this->insertCluster(new_cluster);
       cluster_ptr = new_cluster;
 
       if (is_record_cluster) {
@@ -494,15 +606,13 @@ namespace ieda_solver {
         rollback_info.addition_clusters.push_back(modify_cluster);
       }
 
-      origin_back_cluster_name = cluster_ptr->get_back_cluster();
+      origin_back_cluster_id = cluster_ptr->get_back_cluster();
       *cluster_ptr = std::move(modify_cluster);
     }
 
     auto* origin_root = _interval_cluster_root[origin_interval->get_index()];
-    std::string front_cluster_name = cluster_ptr->get_front_cluster();
-    std::string back_cluster_name = cluster_ptr->get_back_cluster();
-    auto* front_cluster = this->findCluster(front_cluster_name);
-    auto* back_cluster = this->findCluster(back_cluster_name);
+    auto* front_cluster = this->findCluster(cluster_ptr->get_front_cluster());
+    auto* back_cluster = this->findCluster(cluster_ptr->get_back_cluster());
 
     // front cluster case
     if (!origin_root && !front_cluster) {
@@ -512,14 +622,14 @@ namespace ieda_solver {
     else if (origin_root && !front_cluster) {
       // from origin root to cur cluster need to erase.
       auto* tmp_cluster = origin_root;
-      while (tmp_cluster->get_name() != cluster_ptr->get_name()) {
+      while (tmp_cluster->get_id() != cluster_ptr->get_id()) {
         if (is_record_cluster) {
           rollback_info.origin_clusters.push_back(*tmp_cluster);
         }
 
-        std::string delete_cluster_name = tmp_cluster->get_name();
+        int32_t delete_cluster_id = tmp_cluster->get_id();
         tmp_cluster = this->findCluster(tmp_cluster->get_back_cluster());
-        this->deleteCluster(delete_cluster_name);
+        this->deleteCluster(delete_cluster_id);
         if (!tmp_cluster) {
           break;
         }
@@ -532,19 +642,19 @@ namespace ieda_solver {
     else {
       // from front cluster to cur cluster need to erase.
       auto* tmp_cluster = this->findCluster(front_cluster->get_back_cluster());
-      while (tmp_cluster && (tmp_cluster->get_name() != cluster_ptr->get_name())) {
+      while (tmp_cluster && (tmp_cluster->get_id() != cluster_ptr->get_id())) {
         if (is_record_cluster) {
           rollback_info.origin_clusters.push_back(*tmp_cluster);
         }
 
-        std::string delete_cluster_name = tmp_cluster->get_name();
+        int32_t delete_cluster_id = tmp_cluster->get_id();
         tmp_cluster = this->findCluster(tmp_cluster->get_back_cluster());
-        this->deleteCluster(delete_cluster_name);
+        this->deleteCluster(delete_cluster_id);
       }
     }
 
     // back cluster case
-    auto* origin_back_cluster = this->findCluster(origin_back_cluster_name);
+    auto* origin_back_cluster = this->findCluster(origin_back_cluster_id);
     if (!back_cluster && !origin_back_cluster) {
       //
     }
@@ -558,32 +668,32 @@ namespace ieda_solver {
           rollback_info.origin_clusters.push_back(*tmp_cluster);
         }
 
-        std::string delete_cluster_name = tmp_cluster->get_name();
+        int32_t delete_cluster_id = tmp_cluster->get_id();
         tmp_cluster = this->findCluster(tmp_cluster->get_back_cluster());
-        this->deleteCluster(delete_cluster_name);
+        this->deleteCluster(delete_cluster_id);
       }
     }
     else {
       // from origin_back_cluster to back_cluster need to erase.
       auto* tmp_cluster = origin_back_cluster;
-      while (tmp_cluster && (tmp_cluster->get_name() != back_cluster->get_name())) {
+      while (tmp_cluster && (tmp_cluster->get_id() != back_cluster->get_id())) {
         if (is_record_cluster) {
           rollback_info.origin_clusters.push_back(*tmp_cluster);
         }
 
-        std::string delete_cluster_name = tmp_cluster->get_name();
+        int32_t delete_cluster_id = tmp_cluster->get_id();
         tmp_cluster = this->findCluster(tmp_cluster->get_back_cluster());
-        this->deleteCluster(delete_cluster_name);
+        this->deleteCluster(delete_cluster_id);
       }
 
 
     }
 
     if (front_cluster) {
-      front_cluster->set_back_cluster(cluster_ptr->get_name());
+      front_cluster->set_back_cluster(cluster_ptr->get_id());
     }
     if (back_cluster) {
-      back_cluster->set_front_cluster(cluster_ptr->get_name());
+      back_cluster->set_front_cluster(cluster_ptr->get_id());
     }
 
     // update all inst info
@@ -602,158 +712,54 @@ namespace ieda_solver {
 
   }
 
-  // void Abacus::replaceClusterInfo(AbacusCluster& modify_cluster, bool is_record_cluster)
-  // {
-  //   auto* origin_interval = modify_cluster.get_belong_interval();
-  //   int32_t coordi_y = origin_interval->get_belong_row()->get_coordinate().get_y();
-
-  //   auto* cluster_ptr = this->findCluster(modify_cluster.get_name());
-  //   if (!cluster_ptr) {
-  //     AbacusCluster* new_cluster = new AbacusCluster(std::move(modify_cluster));
-  //     auto inst_list = new_cluster->get_inst_list();
-  //     if (inst_list.size() > 1 || inst_list.size() == 0) {
-  //       std::cout << "Cluster Inst is not correctly set" << std::endl;
-  //     }
-
-  //     // cluster setting.
-  //     _inst_belong_cluster[inst_list[0]->get_index()] = new_cluster;
-  //     inst_list[0]->updateCoordi(new_cluster->get_min_x(), coordi_y);
-
-  //     this->insertCluster(new_cluster->get_name(), new_cluster);
-
-  //     // front cluster.
-  //     std::string front_cluster_name = new_cluster->get_front_cluster();
-  //     std::string back_cluster_name = new_cluster->get_back_cluster();
-  //     auto* front_cluster = findCluster(front_cluster_name);
-  //     auto* back_cluster = findCluster(back_cluster_name);
-  //     if (front_cluster) {
-  //       front_cluster->set_back_cluster(new_cluster->get_name());
-
-  //       // assert
-  //       if (back_cluster) {
-  //         if (back_cluster_name != new_cluster->get_back_cluster()) {
-  //           LOG_WARNING << "Unrecord back cluster!!!";
-  //         }
-  //       }
-  //     }
-  //     else {
-  //       if (_interval_cluster_root[origin_interval->get_index()]) {
-  //         LOG_WARNING << "Unrecord front cluster!!!";
-  //       }
-  //       else {
-  //         _interval_cluster_root[origin_interval->get_index()] = new_cluster;
-  //       }
-  //     }
-
-  //     if (back_cluster) {
-  //       back_cluster->set_front_cluster(new_cluster->get_name());
-  //     }
-
-  //     if (is_record_cluster) {
-  //       RollbackInfo rollback_info;
-  //       rollback_info.is_dirty = true;
-  //       rollback_info.addition_clusters.push_back(*new_cluster);
-  //       _rollback_stack.push(rollback_info);
-  //     }
-  //     return;
-  //   }
-
-  //   auto& origin_cluster = *(cluster_ptr);
-  //   auto* origin_root = _interval_cluster_root[origin_interval->get_index()];
-
-  //   // record rollback info
-  //   RollbackInfo rollback_info;
-
-  //   // may be collapsing with front or back cluster
-  //   AbacusCluster* front_origin = this->findCluster(origin_cluster.get_front_cluster());
-  //   AbacusCluster* front_modify = this->findCluster(modify_cluster.get_front_cluster());
-  //   while (front_origin != front_modify) {
-  //     if (is_record_cluster && front_origin) {
-  //       rollback_info.origin_clusters.push_back(*front_origin);
-  //     }
-
-  //     if (front_origin == origin_root) {
-  //       _interval_cluster_root[origin_interval->get_index()] = &origin_cluster;
-  //     }
-
-  //     std::string delete_cluster = front_origin->get_name();
-  //     front_origin = this->findCluster(front_origin->get_front_cluster());
-  //     if (front_origin) {
-  //       front_origin->set_back_cluster(origin_cluster.get_name());
-  //     }
-  //     this->deleteCluster(delete_cluster);
-  //   }
-
-  //   // test
-  //   if (is_record_cluster) {
-  //     rollback_info.addition_clusters.push_back(modify_cluster);
-  //     rollback_info.origin_clusters.push_back(origin_cluster);
-  //   }
-
-  //   AbacusCluster* back_origin = this->findCluster(origin_cluster.get_back_cluster());
-  //   AbacusCluster* back_modify = this->findCluster(modify_cluster.get_back_cluster());
-  //   while (back_origin != back_modify) {
-  //     if (is_record_cluster && back_origin) {
-  //       rollback_info.origin_clusters.push_back(*back_origin);
-  //     }
-
-  //     std::string delete_cluster = back_origin->get_name();
-
-  //     back_origin = this->findCluster(back_origin->get_back_cluster());
-  //     if (back_origin) {
-  //       back_origin->set_front_cluster(origin_cluster.get_name());
-  //     }
-  //     this->deleteCluster(delete_cluster);
-  //   }
-
-  //   // update all inst info
-  //   origin_cluster = std::move(modify_cluster);
-  //   int32_t coordi_x = origin_cluster.get_min_x();
-  //   for (auto* inst : origin_cluster.get_inst_list()) {
-  //     _inst_belong_cluster[inst->get_index()] = &origin_cluster;
-  //     inst->updateCoordi(coordi_x, coordi_y);
-  //     coordi_x += inst->get_shape().get_width();
-  //   }
-
-  //   // final push rollback stack
-  //   if (is_record_cluster) {
-  //     rollback_info.is_dirty = true;
-  //     _rollback_stack.push(rollback_info);
-  //   }
-  // }
-
-  AbacusCluster* Abacus::findCluster(std::string cluster_name)
+  AbacusCluster* Abacus::findCluster(int32_t cluster_id)
   {
-    if (cluster_name == "") {
+    if (cluster_id < 0 || cluster_id >= static_cast<int32_t>(_cluster_list.size())) {
       return nullptr;
     }
-    AbacusCluster* cluster = nullptr;
-    auto it = _cluster_map.find(cluster_name);
-    if (it != _cluster_map.end()) {
-      cluster = it->second;
-    }
-
-    return cluster;
+    return _cluster_list[cluster_id];
   }
 
-  void Abacus::insertCluster(std::string name, AbacusCluster* cluster)
+  void Abacus::insertCluster(AbacusCluster* cluster)
   {
-    auto it = _cluster_map.find(name);
-    if (it != _cluster_map.end()) {
-      std::cout << "Cluster : " << name << " was added before" << std::endl;
+    int32_t cluster_id = cluster->get_id();
+    if (cluster_id >= static_cast<int32_t>(_cluster_list.size())) {
+      // band legalization reserves the slots in advance, only the serial path grows the list.
+      _cluster_list.resize(cluster_id + 1, nullptr);
+    }
+    if (_cluster_list[cluster_id]) {
+      std::cout << "Cluster : " << cluster_id << " was added before" << std::endl;
+    }
+    _cluster_list[cluster_id] = cluster;
+
+    int32_t& id_cursor = obtainClusterIdCursor(cluster->get_belong_interval());
+    if (cluster_id >= id_cursor) {
+      id_cursor = cluster_id + 1;
     }
-    _cluster_map.emplace(name, cluster);
   }
 
-  void Abacus::deleteCluster(std::string name)
+  void Abacus::deleteCluster(int32_t cluster_id)
   {
-    auto it = _cluster_map.find(name);
-    if (it != _cluster_map.end()) {
-      _cluster_map.erase(it);
+    if (findCluster(cluster_id)) {
+      _cluster_list[cluster_id] = nullptr;
     }
     else {
-      std::cout << "Cluster: " << name << " has not been insert" << std::endl;
+      std::cout << "Cluster: " << cluster_id << " has not been insert" << std::endl;
+    }
+  }
+
+  int32_t& Abacus::obtainClusterIdCursor(ipl::LGInterval* interval)
+  {
+    if (_band_id_cursor.empty() || !interval) {
+      return _cluster_id_cursor;
     }
+    int32_t row_idx = interval->get_belong_row()->get_coordinate().get_y() / _row_height;
+    return _band_id_cursor[row_idx / _band_row_num];
+  }
+
+  int32_t Abacus::obtainNewClusterId(ipl::LGInterval* interval)
+  {
+    return obtainClusterIdCursor(interval);
   }
 
   void Abacus::updateRemainLength(ipl::LGInterval* interval, int32_t delta)
@@ -778,22 +784,22 @@ namespace ieda_solver {
         //
       }
       else if (!front_cluster && back_cluster) {
-        back_cluster->set_front_cluster("");
+        back_cluster->set_front_cluster(-1);
       }
       else if (front_cluster && !back_cluster) {
-        front_cluster->set_back_cluster("");
+        front_cluster->set_back_cluster(-1);
       }
       else {
-        front_cluster->set_back_cluster(back_cluster->get_name());
-        back_cluster->set_front_cluster(front_cluster->get_name());
+        front_cluster->set_back_cluster(back_cluster->get_id());
+        back_cluster->set_front_cluster(front_cluster->get_id());
       }
 
       // move the root
-      if (_interval_cluster_root[target_interval->get_index()]->get_name() == target_cluster->get_name()) {
+      if (_interval_cluster_root[target_interval->get_index()]->get_id() == target_cluster->get_id()) {
         _interval_cluster_root[target_interval->get_index()] = back_cluster;
       }
 
-      deleteCluster(target_cluster->get_name());
+      deleteCluster(target_cluster->get_id());
     }
     else {
       int32_t inst_idx = target_cluster->obtainInstIdx(inst);
@@ -818,18 +824,7 @@ namespace ieda_solver {
         // add new cluster
         ipl::LGInstance* flag_inst = new_inst_list[0];
 
-        AbacusCluster* new_cluster;
-        std::string cluster_name = obtainUniqueClusterName(flag_inst->get_name());
-        new_cluster = new AbacusCluster(cluster_name);
-
-        // auto* exist_cluster = findCluster(flag_inst->get_name());
-        // if (exist_cluster) {
-        //   new_cluster = new AbacusCluster(exist_cluster->get_name() + "_2024");
-        // }
-        // else {
-        //   new_cluster = new AbacusCluster(flag_inst->get_name());
-        // }
-
+        AbacusCluster* new_cluster = new AbacusCluster(obtainNewClusterId(target_interval));
         new_cluster->appendInstList(new_inst_list);
         new_cluster->set_min_x(flag_inst->get_coordi().get_x());
         // update inst to cluster
@@ -839,16 +834,16 @@ namespace ieda_solver {
 
         new_cluster->updateAbacusInfo();
         new_cluster->set_belong_interval(target_interval);
-        new_cluster->set_front_cluster(target_cluster->get_name());
-        std::string back_cluster_name = target_cluster->get_back_cluster();
-        auto* back_cluster = findCluster(back_cluster_name);
+        new_cluster->set_front_cluster(target_cluster->get_id());
+        int32_t back_cluster_id = target_cluster->get_back_cluster();
+        auto* back_cluster = findCluster(back_cluster_id);
         if (back_cluster) {
-          new_cluster->set_back_cluster(back_cluster_name);
-          back_cluster->set_front_cluster(new_cluster->get_name());
+          new_cluster->set_back_cluster(back_cluster_id);
+          back_cluster->set_front_cluster(new_cluster->get_id());
         }
-        target_cluster->set_back_cluster(new_cluster->get_name());
+        target_cluster->set_back_cluster(new_cluster->get_id());
 
-        this->insertCluster(new_cluster->get_name(), new_cluster);
+        this->insertCluster(new_cluster);
         rollback_info.addition_clusters.push_back(*new_cluster);
       }
       rollback_info.addition_clusters.push_back(*target_cluster);
@@ -953,31 +948,31 @@ namespace ieda_solver {
     AbacusCluster* back_cluster = nullptr;
 
     while (cur_cluster) {
-      std::string back_cluster_name = cur_cluster->get_back_cluster();
-      back_cluster = this->findCluster(back_cluster_name);
-      std::string prev_cluster_name = cur_cluster->get_front_cluster();
-      prev_cluster = this->findCluster(prev_cluster_name);
+      int32_t back_cluster_id = cur_cluster->get_back_cluster();
+      back_cluster = this->findCluster(back_cluster_id);
+      int32_t prev_cluster_id = cur_cluster->get_front_cluster();
+      prev_cluster = this->findCluster(prev_cluster_id);
 
       bool changed_flag = false;
       for (auto& target_cluster : cluster_list) {
-        if (cur_cluster->get_name() == target_cluster.get_name()) {
+        if (cur_cluster->get_id() == target_cluster.get_id()) {
           // change topo of cur_cluster
           if (!prev_cluster && !back_cluster) {
             _interval_cluster_root[interval_idx] = nullptr;
           }
           else if (prev_cluster && !back_cluster) {
-            prev_cluster->set_back_cluster("");
+            prev_cluster->set_back_cluster(-1);
           }
           else if (!prev_cluster && back_cluster) {
             _interval_cluster_root[interval_idx] = back_cluster;
-            back_cluster->set_front_cluster("");
+            back_cluster->set_front_cluster(-1);
           }
           else {
-            prev_cluster->set_back_cluster(back_cluster_name);
-            back_cluster->set_front_cluster(prev_cluster_name);
+            prev_cluster->set_back_cluster(back_cluster_id);
+            back_cluster->set_front_cluster(prev_cluster_id);
           }
           changed_flag = true;
-          this->deleteCluster(cur_cluster->get_name());
+          this->deleteCluster(cur_cluster->get_id());
           break;
         }
       }
@@ -1003,8 +998,8 @@ namespace ieda_solver {
         //
         break;
       }
-      std::string back_name = cluster_list[i].get_back_cluster();
-      if (back_name == cluster_list[j].get_name()) {
+      int32_t back_id = cluster_list[i].get_back_cluster();
+      if (back_id == cluster_list[j].get_id()) {
         chain_list[chain_idx].push_back(cluster_list[j]);
       }
       else {
@@ -1016,7 +1011,7 @@ namespace ieda_solver {
     for (auto& chain : chain_list) {
       std::vector<AbacusCluster*> cluster_chain;
       for (auto& cluster : chain) {
-        AbacusCluster* c = new AbacusCluster(cluster.get_name());
+        AbacusCluster* c = new AbacusCluster(cluster.get_id());
         // need to set coordi
         *c = cluster;
 
@@ -1045,7 +1040,7 @@ namespace ieda_solver {
     auto* cur_cluster = interval_root;
     if (!cur_cluster) {
       for (auto* c : cluster_chain) {
-        this->insertCluster(c->get_name(), c);
+        this->insertCluster(c);
       }
       _interval_cluster_root[interval_idx] = c_head;
       return;
@@ -1054,32 +1049,31 @@ namespace ieda_solver {
     // front case
     if (c_head->get_min_x() < cur_cluster->get_min_x()) {
       for (auto* c : cluster_chain) {
-        this->insertCluster(c->get_name(), c);
+        this->insertCluster(c);
       }
       _interval_cluster_root[interval_idx] = c_head;
-      cur_cluster->set_front_cluster(c_tail->get_name());
+      cur_cluster->set_front_cluster(c_tail->get_id());
       return;
     }
 
     while (cur_cluster) {
       // not front case
-      std::string back_cluster_name = cur_cluster->get_back_cluster();
-      auto* back_cluster = this->findCluster(back_cluster_name);
+      auto* back_cluster = this->findCluster(cur_cluster->get_back_cluster());
       if (!back_cluster) {
         // direct add chain list.
-        cur_cluster->set_back_cluster(c_head->get_name());
+        cur_cluster->set_back_cluster(c_head->get_id());
         for (auto* c : cluster_chain) {
-          this->insertCluster(c->get_name(), c);
+          this->insertCluster(c);
         }
         break;
       }
       else {
         if (c_head->get_min_x() >= cur_cluster->get_max_x() && c_head->get_max_x() <= back_cluster->get_min_x()) {
           // insert chain list.
-          cur_cluster->set_back_cluster(c_head->get_name());
-          back_cluster->set_front_cluster(c_tail->get_name());
+          cur_cluster->set_back_cluster(c_head->get_id());
+          back_cluster->set_front_cluster(c_tail->get_id());
           for (auto* c : cluster_chain) {
-            this->insertCluster(c->get_name(), c);
+            this->insertCluster(c);
           }
           break;
         }
@@ -1098,8 +1092,7 @@ namespace ieda_solver {
     AbacusCluster* cur_cluster = interval_root;
     AbacusCluster* back_cluster = nullptr;
     while (cur_cluster) {
-      std::string back_cluster_name = cur_cluster->get_back_cluster();
-      back_cluster = this->findCluster(back_cluster_name);
+      back_cluster = this->findCluster(cur_cluster->get_back_cluster());
 
       int32_t cluster_width = cur_cluster->get_total_width();
       remain_length -= cluster_width;
@@ -1120,10 +1113,9 @@ namespace ieda_solver {
     std::stringstream info;
     info << interval_name << " --- ";
     while (cur_cluster) {
-      info << cur_cluster->get_name() << "(" << cur_cluster->get_inst_list().size() << "," << cur_cluster->get_total_width() << ")" << " -> ";
+      info << cur_cluster->get_id() << "(" << cur_cluster->get_inst_list().size() << "," << cur_cluster->get_total_width() << ")" << " -> ";
 
-      std::string back_cluster_name = cur_cluster->get_back_cluster();
-      back_cluster = this->findCluster(back_cluster_name);
+      back_cluster = this->findCluster(cur_cluster->get_back_cluster());
       int32_t cluster_width = cur_cluster->get_total_width();
       remain_length -= cluster_width;
       cur_cluster = back_cluster;
@@ -1134,14 +1126,4 @@ namespace ieda_solver {
     LOG_INFO << info.str();
   }
 
-  std::string Abacus::obtainUniqueClusterName(std::string origin_name){
-    std::string unique_name = origin_name;
-    auto* cluster = this->findCluster(unique_name);
-    while(cluster){
-      unique_name += "_2024";
-      cluster = this->findCluster(unique_name);
-    }
-    return unique_name;
-  }
-
 }  // namespace ieda_solver
\ No newline at end of file
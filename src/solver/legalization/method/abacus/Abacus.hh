@@ -18,8 +18,9 @@
 #pragma once
 
 #include <map>
-#include <unordered_map>
 #include <stack>
+#include <string>
+#include <vector>
 
 #include "AbacusCluster.hh"
 #include "LGMethodInterface.hh"
@@ -63,7 +64,13 @@ class Abacus : public LGMethodInterface
   bool runRollback(bool clear_but_not_rollback) override;
 
  private:
-  std::unordered_map<std::string, AbacusCluster*> _cluster_map;
+  // cluster id -> cluster, deleted clusters leave a nullptr slot.
+  std::vector<AbacusCluster*> _cluster_list;
+  int32_t _cluster_id_cursor = 0;
+  // row band parallel legalization, each band allocates cluster id in its own range.
+  int32_t _band_row_num = 0;
+  std::vector<int32_t> _band_id_cursor;
+
   std::vector<AbacusCluster*> _inst_belong_cluster;
   std::vector<AbacusCluster*> _interval_cluster_root;
   std::vector<int32_t> _interval_remain_length;
@@ -74,6 +81,11 @@ class Abacus : public LGMethodInterface
   std::stack<RollbackInfo> _rollback_stack;
 
   void pickAndSortMovableInstList(std::vector<ipl::LGInstance*>& movable_inst_list);
+  int32_t obtainBandNum();
+  void runBandLegalization(std::vector<ipl::LGInstance*>& movable_inst_list, std::vector<ipl::LGInstance*>& remain_inst_list);
+  bool searchBestRow(ipl::LGInstance* inst, int32_t min_row_idx, int32_t max_row_idx, int32_t& best_row, int32_t& best_cost);
+  int32_t obtainBaseRowIdx(ipl::LGInstance* inst);
+  int32_t calRowDistance(ipl::LGInstance* inst, int32_t row_idx);
   int32_t placeRow(ipl::LGInstance* inst, int32_t row_idx, bool is_trial, bool is_record_cluster);
   int32_t searchNearestIntervalIndex(std::vector<ipl::LGInterval*>& segment_list, ipl::Rectangle<int32_t>& inst_shape);
   int32_t searchRemainSpaceSegIndex(std::vector<ipl::LGInterval*>& segment_list, ipl::Rectangle<int32_t>& inst_shape, int32_t origin_index);
@@ -89,9 +101,10 @@ class Abacus : public LGMethodInterface
   int32_t calDistanceWithBox(int32_t min_x, int32_t max_x, int32_t box_min_x, int32_t box_max_x);
   bool checkOverlapWithBox(int32_t min_x, int32_t max_x, int32_t box_min_x, int32_t box_max_x);
 
-  AbacusCluster* findCluster(std::string cluster_name);
-  void insertCluster(std::string name, AbacusCluster* cluster);
-  void deleteCluster(std::string name);
+  AbacusCluster* findCluster(int32_t cluster_id);
+  void insertCluster(AbacusCluster* cluster);
+  void deleteCluster(int32_t cluster_id);
+  int32_t& obtainClusterIdCursor(ipl::LGInterval* interval);
 
   void updateRemainLength(ipl::LGInterval* interval, int32_t delta);
   void splitTargetInst(ipl::LGInstance* inst, RollbackInfo& rollback_info);
@@ -99,7 +112,7 @@ class Abacus : public LGMethodInterface
   void insertTargetIntervalClusters(ipl::LGInterval* interval, std::vector<AbacusCluster>& cluster_list);
   void insertClusterChainIntoInterval(ipl::LGInterval* interval, std::vector<AbacusCluster*>& cluster_chain);
   void reCalIntervalRemainLength(ipl::LGInterval* interval);
-  std::string obtainUniqueClusterName(std::string origin_name);
+  int32_t obtainNewClusterId(ipl::LGInterval* interval);
 
   void debugIntervalRemainLength(std::string interval_name);
 };
@@ -24,15 +24,15 @@
 
 namespace ieda_solver {
 
-AbacusCluster::AbacusCluster(std::string name)
-    : _name(name),
+AbacusCluster::AbacusCluster(int32_t id)
+    : _id(id),
       _belong_segment(nullptr),
       _min_x(INT32_MAX),
       _weight_e(0.0),
       _weight_q(0.0),
       _total_width(0),
-      _front_cluster(""),
-      _back_cluster("")
+      _front_cluster(-1),
+      _back_cluster(-1)
 {
 }
 
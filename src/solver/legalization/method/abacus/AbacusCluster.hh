@@ -16,7 +16,7 @@
 // ***************************************************************************************
 #pragma once
 
-#include <string>
+#include <cstdint>
 #include <vector>
 
 namespace ipl {
@@ -30,11 +30,11 @@ class AbacusCluster
 {
  public:
   AbacusCluster() = default;
-  explicit AbacusCluster(std::string name);
+  explicit AbacusCluster(int32_t id);
 
   AbacusCluster(const AbacusCluster& other)
   {
-    _name = other._name;
+    _id = other._id;
     _inst_list = other._inst_list;
     _belong_segment = other._belong_segment;
     _min_x = other._min_x;
@@ -46,7 +46,7 @@ class AbacusCluster
   }
   AbacusCluster(AbacusCluster&& other)
   {
-    _name = std::move(other._name);
+    _id = std::move(other._id);
     _inst_list = std::move(other._inst_list);
     _belong_segment = std::move(other._belong_segment);
     _min_x = std::move(other._min_x);
@@ -60,7 +60,7 @@ class AbacusCluster
 
   AbacusCluster& operator=(const AbacusCluster& other)
   {
-    _name = other._name;
+    _id = other._id;
     _inst_list = other._inst_list;
     _belong_segment = other._belong_segment;
     _min_x = other._min_x;
@@ -73,7 +73,7 @@ class AbacusCluster
   }
   AbacusCluster& operator=(AbacusCluster&& other)
   {
-    _name = std::move(other._name);
+    _id = std::move(other._id);
     _inst_list = std::move(other._inst_list);
     _belong_segment = std::move(other._belong_segment);
     _min_x = std::move(other._min_x);
@@ -86,26 +86,24 @@ class AbacusCluster
   }
 
   // getter
-  std::string get_name() const { return _name; }
-  std::vector<ipl::LGInstance*> get_inst_list() const { return _inst_list; }
+  int32_t get_id() const { return _id; }
+  const std::vector<ipl::LGInstance*>& get_inst_list() const { return _inst_list; }
   ipl::LGInterval* get_belong_interval() const { return _belong_segment; }
   int32_t get_min_x() const { return _min_x; }
   int32_t get_max_x();
   double get_weight_e() const { return _weight_e; }
   double get_weight_q() const { return _weight_q; }
   int32_t get_total_width() const { return _total_width; }
-  std::string get_front_cluster() const { return _front_cluster; }
-  std::string get_back_cluster() const { return _back_cluster; }
+  int32_t get_front_cluster() const { return _front_cluster; }
+  int32_t get_back_cluster() const { return _back_cluster; }
 
   // setter
-  void set_name(std::string name) { _name = name; }
+  void set_id(int32_t id) { _id = id; }
   void add_inst(ipl::LGInstance* inst) { _inst_list.push_back(inst); }
   void set_belong_interval(ipl::LGInterval* seg) { _belong_segment = seg; }
   void set_min_x(int32_t min_x) { _min_x = min_x; }
-  void set_front_cluster(std::string cluster) { _front_cluster = cluster; }
-  void set_back_cluster(std::string cluster) {
-    _back_cluster = cluster; 
-  }
+  void set_front_cluster(int32_t cluster) { _front_cluster = cluster; }
+  void set_back_cluster(int32_t cluster) { _back_cluster = cluster; }
 
 
   // function
@@ -120,16 +118,17 @@ class AbacusCluster
   void eraseTargetInstByIdxPair(int32_t begin_idx, int32_t end_idx);
 
  private:
-  std::string _name;
+  int32_t _id = -1;
   std::vector<ipl::LGInstance*> _inst_list;
-  ipl::LGInterval* _belong_segment;
+  ipl::LGInterval* _belong_segment = nullptr;
 
-  int32_t _min_x;
-  double _weight_e;
-  double _weight_q;
-  int32_t _total_width;
+  int32_t _min_x = INT32_MAX;
+  double _weight_e = 0.0;
+  double _weight_q = 0.0;
+  int32_t _total_width = 0;
 
-  std::string _front_cluster;
-  std::string _back_cluster;
+  // cluster id of the neighbors in the same interval, -1 means none.
+  int32_t _front_cluster = -1;
+  int32_t _back_cluster = -1;
 };
 }  // namespace ieda_solver
@@ -37,6 +37,9 @@
 #include <math.h>
 #include <string>
 #include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <unordered_set>
 #include "flute.h"
 
 namespace Flute {
@@ -67,8 +70,8 @@ typedef struct csoln ***LUT_TYPE;
 typedef int **NUMSOLN_TYPE;
 
 // Dynamically allocate LUTs.
-LUT_TYPE LUT;
-NUMSOLN_TYPE numsoln;
+LUT_TYPE LUT = nullptr;
+NUMSOLN_TYPE numsoln = nullptr;
 
 struct point {
         DTYPE x, y;
@@ -139,7 +142,7 @@ readLUTfiles(LUT_TYPE LUT,
                         } else {
                                 fgetc(fpwv);  // '\n'
                                 numsoln[d][k] = ns;
-                                p = (struct csoln *)malloc(ns * sizeof(struct csoln));
+                                p = new struct csoln[ns];
                                 LUT[d][k] = p;
                                 for (i = 1; i <= ns; i++) {
                                         linep = (unsigned char *)fgets((char *)line, 32, fpwv);
@@ -184,9 +187,11 @@ makeLUT(LUT_TYPE &LUT,
 	NUMSOLN_TYPE &numsoln);
 static void
 deleteLUT(LUT_TYPE &LUT,
-	  NUMSOLN_TYPE &numsoln);
+	  NUMSOLN_TYPE &numsoln,
+	  int valid_d);
 static void
-initLUT(int to_d,
+initLUT(int from_d,
+        int to_d,
         LUT_TYPE LUT,
 	NUMSOLN_TYPE numsoln);
 static void
@@ -201,7 +206,11 @@ checkLUT(LUT_TYPE LUT1,
 
 // LUTs are initialized to this order at startup.
 static constexpr int lut_initial_d = 8;
-static int lut_valid_d = 0;
+// LUTs of degree <= lut_valid_d are built and never written again,
+// readers load it with acquire and see the LUTs it was published with.
+static std::atomic<int> lut_valid_d = 0;
+// Serializes readLUT, deleteLUT and extending the LUTs.
+static std::mutex lut_mutex;
 
 // Use flute LUT file reader.
 #define LUT_FILE 1
@@ -219,25 +228,33 @@ static int lut_valid_d = 0;
 extern std::string post9;
 extern std::string powv9;
 
+// Build the LUTs once, later calls keep the LUTs that other threads may be reading.
 void readLUT() {
+  std::lock_guard<std::mutex> lock(lut_mutex);
+  if (LUT != nullptr)
+    return;
+
   makeLUT(LUT, numsoln);
 
 #if LUT_SOURCE==LUT_FILE
   readLUTfiles(LUT, numsoln);
-  lut_valid_d = FLUTE_D;
+  lut_valid_d.store(FLUTE_D, std::memory_order_release);
 
 #elif LUT_SOURCE==LUT_VAR
   // Only init to d=8 on startup because d=9 is big and slow.
-  initLUT(lut_initial_d, LUT, numsoln);
+  initLUT(4, lut_initial_d, LUT, numsoln);
+  lut_valid_d.store(lut_initial_d, std::memory_order_release);
 
 #elif LUT_SOURCE==LUT_VAR_CHECK
   readLUTfiles(LUT, numsoln);
+  lut_valid_d.store(FLUTE_D, std::memory_order_release);
   // Temporaries to compare to file results.
   LUT_TYPE LUT_;
   NUMSOLN_TYPE numsoln_;
   makeLUT(LUT_, numsoln_);
-  initLUT(FLUTE_D, LUT_, numsoln_);
+  initLUT(4, FLUTE_D, LUT_, numsoln_);
   checkLUT(LUT, numsoln, LUT_, numsoln_);
+  deleteLUT(LUT_, numsoln_, FLUTE_D);
 #endif
 }
 
@@ -256,19 +273,34 @@ makeLUT(LUT_TYPE &LUT,
 void
 deleteLUT()
 {
-  deleteLUT(LUT, numsoln);
+  std::lock_guard<std::mutex> lock(lut_mutex);
+  if (LUT == nullptr)
+    return;
+  deleteLUT(LUT, numsoln, lut_valid_d.load(std::memory_order_relaxed));
+  lut_valid_d.store(0, std::memory_order_release);
 }
 
+// Solutions of degree <= valid_d are built, groups same as a previous group share its solutions.
 static void
 deleteLUT(LUT_TYPE &LUT,
-	  NUMSOLN_TYPE &numsoln)
+	  NUMSOLN_TYPE &numsoln,
+	  int valid_d)
 {
   for (int d = 4; d <= FLUTE_D; d++) {
+    if (d <= valid_d) {
+      std::unordered_set<struct csoln *> deleted;
+      for (int k = 0; k < numgrp[d]; k++) {
+	if (deleted.insert(LUT[d][k]).second)
+	  delete [] LUT[d][k];
+      }
+    }
     delete [] LUT[d];
     delete [] numsoln[d];
   }
   delete [] numsoln;
   delete [] LUT;
+  LUT = nullptr;
+  numsoln = nullptr;
 }
 
 static unsigned char
@@ -282,9 +314,11 @@ charNum(unsigned char c)
     return 0;
 }
 
-// Init LUTs from base64 encoded string variables.
+// Init LUTs of degree from_d .. to_d from base64 encoded string variables,
+// lower degrees are only parsed past and their LUTs are left untouched.
 static void
-initLUT(int to_d,
+initLUT(int from_d,
+        int to_d,
         LUT_TYPE LUT,
 	NUMSOLN_TYPE numsoln) {
   std::string pwv_string = base64_decode(powv9);
@@ -303,19 +337,26 @@ initLUT(int to_d,
     sscanf(prt, "d=%d%n", &d, &char_cnt);
     prt += char_cnt + 1;
 #endif
+    bool is_built = d < from_d;
     for (int k = 0; k < numgrp[d]; k++) {
       int ns = charNum(*pwv++);
       if (ns == 0) {  // same as some previous group
 	int kk;
 	sscanf(pwv, "%d%n", &kk, &char_cnt);
 	pwv += char_cnt + 1;
-	numsoln[d][k] = numsoln[d][kk];
-	LUT[d][k] = LUT[d][kk];
+	if (!is_built) {
+	  numsoln[d][k] = numsoln[d][kk];
+	  LUT[d][k] = LUT[d][kk];
+	}
       } else {
 	pwv++;   // '\n'
-	numsoln[d][k] = ns;
-	struct csoln *p = new struct csoln[ns];
-	LUT[d][k] = p;
+	struct csoln skipped;
+	struct csoln *p = &skipped;
+	if (!is_built) {
+	  p = new struct csoln[ns];
+	  numsoln[d][k] = ns;
+	  LUT[d][k] = p;
+	}
 	for (int i = 1; i <= ns; i++) {
 	  p->parent = charNum(*pwv++);
 
@@ -350,18 +391,24 @@ initLUT(int to_d,
 	  }
 	  prt++;  // \n
 #endif
-	  p++;
+	  if (!is_built)
+	    p++;
 	}
       }
     }
   }
-  lut_valid_d = to_d;
 }
 
+// Build the missing degrees up to d and publish them, concurrent callers build them only once.
 static void
 ensureLUT(int d) {
-  if (d > lut_valid_d && d <= FLUTE_D) {
-    initLUT(FLUTE_D, LUT, numsoln);
+  if (d > lut_valid_d.load(std::memory_order_acquire) && d <= FLUTE_D) {
+    std::lock_guard<std::mutex> lock(lut_mutex);
+    int valid_d = lut_valid_d.load(std::memory_order_relaxed);
+    if (d > valid_d) {
+      initLUT(valid_d + 1, d, LUT, numsoln);
+      lut_valid_d.store(d, std::memory_order_release);
+    }
   }
 }
 
@@ -7,12 +7,9 @@
 #define MAXD 300000        // max. degree that can be handled
 void salt::FluteBuilder::Run(const salt::Net& net, salt::Tree& saltTree)
 {
-  // load LUT
-  static bool once = false;
-  if (!once) {
-    Flute::readLUT();
-    once = true;
-  }
+  // load LUT, the static initialization is thread-safe
+  static const bool once = (Flute::readLUT(), true);
+  (void) once;
 
   // Obtain flute tree
   Flute::Tree flute_tree;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <cmath>
 #include <map>
 #include <set>
@@ -30,7 +31,7 @@ class InnerNode
   double angle;  // [-pi, pi]
   InnerNode(const shared_ptr<TreeNode>& treeNode) : tn(treeNode), dist(abs(tn->loc.x) + abs(tn->loc.y)), angle(atan2(tn->loc.y, tn->loc.x))
   {
-    static unsigned gid = 0;
+    static std::atomic<unsigned> gid = 0;
     id = gid++;
   }  // use id instead of pointer to make it deterministic
 };